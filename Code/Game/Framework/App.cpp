@@ -5,6 +5,7 @@
 #include "Engine/Audio/AudioSubsystem.hpp"
 #include "Engine/Core/Clock.hpp"
 #include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/Rgba8.hpp"
 #include "Engine/Core/Engine.hpp"
 #include "Engine/Input/InputSystem.hpp"
@@ -38,6 +39,8 @@
 #include "Engine/Graphic/Bundle/Integration/ShaderBundleSubsystem.hpp"
 #include "Engine/Graphic/Bundle/Integration/ShaderBundleSubsystemConfiguration.hpp"
 #include "Game/GameCommon.hpp"
+#include "Game/Framework/PerfCapture/PerfCapture.hpp"
+#include "Game/Framework/Scheduling/TaskScheduler.hpp"
 #include "Game/Gameplay/Game.hpp"
 
 // Windows API for testing
@@ -53,6 +56,8 @@ InputSystem*           g_theInput    = nullptr;
 AudioSubsystem*        g_theAudio    = nullptr;
 Game*                  g_theGame     = nullptr;
 
+enigma::core::YamlConfiguration settings;
+
 App::App()
 {
     // Create Engine instance
@@ -63,7 +68,7 @@ App::~App()
 {
 }
 
-void App::Startup(char*)
+void App::Startup(char* commandLineString)
 {
     // ========================================================================
     // Initialize GEngine - Provide a global access point to the Log system
@@ -75,6 +80,9 @@ void App::Startup(char*)
         enigma::core::Engine::CreateInstance();
     }
 
+    // settings.yml is parsed once here, before any subsystem reads the shared configuration
+    LoadConfigurations();
+
     // Create and register RegisterSubsystem first (needed for block registry)
     auto registerSubsystem = std::make_unique<RegisterSubsystem>();
     GEngine->RegisterSubsystem(std::move(registerSubsystem));
@@ -109,9 +117,11 @@ void App::Startup(char*)
     g_theInput = new InputSystem(inputConfig);
 
     // Create and register ScheduleSubsystem (Phase 2: YAML-driven)
-    ScheduleConfig scheduleConfig;
+    // The engine pools are resized to share settings.yml scheduler.threadBudget with the game pool
+    ScheduleConfig    scheduleConfig;
+    const std::string schedulePath = TaskScheduler::SizeEngineSchedule(settings, ".enigma/config/engine/schedule.yml");
     // Try to load from YAML config file
-    if (!scheduleConfig.LoadFromFile(".enigma/config/engine/schedule.yml"))
+    if (!scheduleConfig.LoadFromFile(schedulePath.c_str()))
     {
         // Fallback to default configuration if file not found
         scheduleConfig = ScheduleConfig::GetDefaultConfig();
@@ -171,9 +181,15 @@ void App::Startup(char*)
 
     g_theLogger->SetGlobalLogLevel(LogLevel::ERROR_);
 
+    // Game-side worker pool (settings.yml scheduler), the game submits to it from its constructor on
+    TaskScheduler::Startup(settings);
+
     m_game    = std::make_unique<Game>();
     g_theGame = m_game.get();
     ApplyClientAspectToGameCameras(g_theWindow->GetClientDimensions());
+
+    // Unattended capture (settings.yml perfCapture or "perfCapture" on the command line)
+    PerfCapture::Startup(settings, commandLineString);
 }
 
 void App::Shutdown()
@@ -196,9 +212,14 @@ void App::Shutdown()
         m_windowClientSizeChangedHandle = 0;
     }
 
+    PerfCapture::Shutdown();
+
     m_game.reset();
     g_theGame = nullptr;
 
+    // Drains tasks the game left queued (cache flushes, benchmark) before the engine goes away
+    TaskScheduler::Shutdown();
+
     // Shutdown Engine subsystems (handles ResourceSubsystem and AudioSubsystem)
     GEngine->Shutdown();
 
@@ -281,7 +302,14 @@ void App::HandleKeyBoardEvent()
 
 void App::LoadConfigurations()
 {
-    settings = YamlConfiguration::LoadFromFile(".enigma/settings.yml");
+    try
+    {
+        settings = YamlConfiguration::LoadFromFile(".enigma/settings.yml");
+    }
+    catch (const std::exception& e)
+    {
+        DebuggerPrintf("[App] Failed to read .enigma/settings.yml: %s\n", e.what());
+    }
 }
 
 bool App::Event_ConsoleStartup(EventArgs& args)
@@ -332,6 +360,7 @@ void App::Update()
 
     HandleKeyBoardEvent();
 
+    PerfCapture::ApplyCameraPath();
     if (m_game) m_game->Update();
 }
 
@@ -346,4 +375,9 @@ void App::EndFrame()
 {
     if (g_theInput) g_theInput->EndFrame();
     GEngine->EndFrame();
+
+    if (PerfCapture::EndFrame(Clock::GetSystemClock().GetDeltaSeconds()))
+    {
+        HandleQuitRequested();
+    }
 }
@@ -14,7 +14,7 @@ namespace enigma::window
     struct WindowCloseRequest;
 }
 
-static enigma::core::YamlConfiguration settings; // Minecraft Style global configuration
+extern enigma::core::YamlConfiguration settings; // Minecraft Style global configuration, read once by App::LoadConfigurations()
 
 // Forward declaration for resource system
 namespace enigma::resource
@@ -0,0 +1,512 @@
+/**
+ * @file ChunkCodec.cpp
+ * @brief LZ4 block format codec with optional prefix dictionary, and dictionary training
+ * @date 2026-10-16
+ */
+
+#include "ChunkCodec.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "Game/Framework/ChunkStore/ChunkPayload.hpp"
+
+namespace
+{
+    constexpr size_t   MIN_MATCH          = 4;
+    constexpr size_t   LAST_LITERALS      = 5;  // LZ4 block format: the last 5 bytes are always literals
+    constexpr size_t   MATCH_FIND_LIMIT   = 12; // ... and no match starts within the last 12 bytes
+    constexpr size_t   MAX_OFFSET         = 65535;
+    constexpr int      HASH_BITS          = 16;
+    constexpr size_t   SIZE_PREFIX_BYTES  = 4;
+    constexpr uint32_t DICTIONARY_MAGIC   = 0x31444345; // "ECD1"
+    constexpr size_t   TRAIN_KMER_BYTES   = 8;
+    constexpr size_t   TRAIN_SEGMENT_SIZE = 64;
+
+    uint32_t Read32(const uint8_t* p)
+    {
+        uint32_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    uint32_t HashSequence(uint32_t sequence)
+    {
+        return (sequence * 2654435761u) >> (32 - HASH_BITS);
+    }
+
+    void WriteLength(std::vector<uint8_t>& out, size_t length)
+    {
+        while (length >= 255)
+        {
+            out.push_back(255);
+            length -= 255;
+        }
+        out.push_back(static_cast<uint8_t>(length));
+    }
+
+    void EmitSequence(std::vector<uint8_t>& out, const uint8_t* literals, size_t literalLength, size_t offset, size_t matchLength)
+    {
+        const size_t matchCode = matchLength - MIN_MATCH;
+        out.push_back(static_cast<uint8_t>((std::min<size_t>(literalLength, 15) << 4) | std::min<size_t>(matchCode, 15)));
+        if (literalLength >= 15)
+            WriteLength(out, literalLength - 15);
+        out.insert(out.end(), literals, literals + literalLength);
+        out.push_back(static_cast<uint8_t>(offset & 0xFF));
+        out.push_back(static_cast<uint8_t>(offset >> 8));
+        if (matchCode >= 15)
+            WriteLength(out, matchCode - 15);
+    }
+
+    void EmitLastLiterals(std::vector<uint8_t>& out, const uint8_t* literals, size_t literalLength)
+    {
+        out.push_back(static_cast<uint8_t>(std::min<size_t>(literalLength, 15) << 4));
+        if (literalLength >= 15)
+            WriteLength(out, literalLength - 15);
+        out.insert(out.end(), literals, literals + literalLength);
+    }
+
+    /// LZ4 block compression of base[dictSize, total), allowed to match into base[0, dictSize)
+    void CompressBlock(const uint8_t* base, size_t dictSize, size_t total, int level, std::vector<uint8_t>& out)
+    {
+        const size_t inputSize = total - dictSize;
+        out.reserve(out.size() + inputSize / 2 + 16);
+        if (inputSize < MATCH_FIND_LIMIT + 1)
+        {
+            EmitLastLiterals(out, base + dictSize, inputSize);
+            return;
+        }
+
+        // Level 1 probes one candidate and skips ahead on misses; higher levels walk a hash chain
+        const int  searchDepth  = 1 << (std::clamp(level, ChunkCodec::MIN_LEVEL, ChunkCodec::MAX_LEVEL) - 1);
+        const bool insertAll    = level > 1;
+        const size_t matchLimit = total - LAST_LITERALS;
+        const size_t findLimit  = total - MATCH_FIND_LIMIT;
+
+        std::vector<int32_t> head(size_t(1) << HASH_BITS, -1);
+        std::vector<int32_t> chain(total, -1);
+        const auto           insert = [&](size_t position)
+        {
+            const uint32_t hash = HashSequence(Read32(base + position));
+            chain[position]     = head[hash];
+            head[hash]          = static_cast<int32_t>(position);
+        };
+        for (size_t position = 0; position + MIN_MATCH <= dictSize; ++position)
+        {
+            insert(position);
+        }
+
+        size_t   anchor   = dictSize;
+        size_t   position = dictSize;
+        uint32_t misses   = 0;
+        while (position < findLimit)
+        {
+            size_t  bestLength = 0;
+            size_t  bestSource = 0;
+            int32_t candidate  = head[HashSequence(Read32(base + position))];
+            for (int depth = 0; candidate >= 0 && depth < searchDepth; ++depth)
+            {
+                const size_t source = static_cast<size_t>(candidate);
+                if (position - source > MAX_OFFSET)
+                    break;
+                if (Read32(base + source) == Read32(base + position))
+                {
+                    size_t length = MIN_MATCH;
+                    while (position + length < matchLimit && base[source + length] == base[position + length])
+                        ++length;
+                    if (length > bestLength)
+                    {
+                        bestLength = length;
+                        bestSource = source;
+                    }
+                }
+                candidate = chain[source];
+            }
+
+            if (bestLength < MIN_MATCH)
+            {
+                insert(position);
+                position += insertAll ? 1 : 1 + (misses++ >> 6);
+                continue;
+            }
+            misses = 0;
+
+            // Extend backwards over literals that also match
+            while (position > anchor && bestSource > 0 && base[position - 1] == base[bestSource - 1])
+            {
+                --position;
+                --bestSource;
+                ++bestLength;
+            }
+
+            EmitSequence(out, base + anchor, position - anchor, position - bestSource, bestLength);
+
+            const size_t matchEnd = position + bestLength;
+            if (insertAll)
+            {
+                for (size_t p = position; p < matchEnd && p + MIN_MATCH <= total; ++p)
+                    insert(p);
+            }
+            else
+            {
+                insert(position);
+                if (matchEnd >= 2 && matchEnd - 2 > position && matchEnd - 2 + MIN_MATCH <= total)
+                    insert(matchEnd - 2);
+            }
+            position = matchEnd;
+            anchor   = matchEnd;
+        }
+
+        EmitLastLiterals(out, base + anchor, total - anchor);
+    }
+
+    bool ReadLength(const uint8_t*& in, const uint8_t* end, size_t& length)
+    {
+        uint8_t byte = 255;
+        while (byte == 255)
+        {
+            if (in >= end)
+                return false;
+            byte = *in++;
+            length += byte;
+        }
+        return true;
+    }
+
+    bool DecompressBlock(const uint8_t* in, size_t inSize, uint8_t* out, size_t outSize, const uint8_t* dict, size_t dictSize)
+    {
+        const uint8_t* inEnd = in + inSize;
+        size_t         op    = 0;
+        while (in < inEnd)
+        {
+            const uint8_t token         = *in++;
+            size_t        literalLength = token >> 4;
+            if (literalLength == 15 && !ReadLength(in, inEnd, literalLength))
+                return false;
+            if (literalLength > static_cast<size_t>(inEnd - in) || literalLength > outSize - op)
+                return false;
+            if (literalLength > 0)
+                std::memcpy(out + op, in, literalLength); // out is null for an empty chunk
+            in += literalLength;
+            op += literalLength;
+            if (in == inEnd)
+                break; // Last sequence has no match
+
+            if (inEnd - in < 2)
+                return false;
+            const size_t offset = static_cast<size_t>(in[0]) | (static_cast<size_t>(in[1]) << 8);
+            in += 2;
+            size_t matchLength = (token & 0x0F);
+            if (matchLength == 15 && !ReadLength(in, inEnd, matchLength))
+                return false;
+            matchLength += MIN_MATCH;
+            if (offset == 0 || matchLength > outSize - op || offset > op + dictSize)
+                return false;
+
+            if (offset > op)
+            {
+                // Starts inside the dictionary and may run on into the output
+                for (size_t i = 0; i < matchLength; ++i, ++op)
+                    out[op] = op >= offset ? out[op - offset] : dict[dictSize - (offset - op)];
+            }
+            else if (offset == 1)
+            {
+                std::memset(out + op, out[op - 1], matchLength);
+                op += matchLength;
+            }
+            else if (offset >= matchLength)
+            {
+                std::memcpy(out + op, out + op - offset, matchLength);
+                op += matchLength;
+            }
+            else
+            {
+                // Short repeat: lay down one period, then keep doubling the copied run of whole periods
+                std::memcpy(out + op, out + op - offset, offset);
+                size_t copied = offset;
+                while (copied < matchLength)
+                {
+                    const size_t chunk = std::min(copied, matchLength - copied);
+                    std::memcpy(out + op + copied, out + op, chunk);
+                    copied += chunk;
+                }
+                op += matchLength;
+            }
+        }
+        return op == outSize;
+    }
+
+    uint16_t HashDictionary(const std::vector<uint8_t>& bytes)
+    {
+        uint32_t hash = 2166136261u;
+        for (uint8_t byte : bytes)
+        {
+            hash ^= byte;
+            hash *= 16777619u;
+        }
+        const uint16_t folded = static_cast<uint16_t>((hash >> 16) ^ (hash & 0xFFFFu));
+        return folded == 0 ? 1 : folded;
+    }
+
+    std::mutex& GetDictionaryMutex()
+    {
+        static std::mutex s_mutex;
+        return s_mutex;
+    }
+
+    std::unordered_map<uint16_t, std::shared_ptr<ChunkDictionary>>& GetDictionaries()
+    {
+        static std::unordered_map<uint16_t, std::shared_ptr<ChunkDictionary>> s_dictionaries;
+        return s_dictionaries;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+ChunkDictionary::ChunkDictionary(std::vector<uint8_t> bytes)
+    : m_bytes(std::move(bytes))
+{
+    if (m_bytes.size() > MAX_OFFSET)
+    {
+        // Only the last 64 KB are reachable by LZ4 offsets
+        m_bytes.erase(m_bytes.begin(), m_bytes.end() - static_cast<std::ptrdiff_t>(MAX_OFFSET));
+    }
+    m_id = HashDictionary(m_bytes);
+}
+
+// ------------------------------------------------------------------------------------------------
+std::shared_ptr<ChunkDictionary> ChunkDictionary::Train(const std::vector<std::vector<uint8_t>>& samples, size_t capacity)
+{
+    capacity = std::min(capacity, MAX_OFFSET);
+
+    // [STEP 1] In how many samples does each k-mer occur
+    std::unordered_map<uint64_t, uint32_t> frequency;
+    for (const std::vector<uint8_t>& sample : samples)
+    {
+        std::unordered_set<uint64_t> seen;
+        for (size_t i = 0; i + TRAIN_KMER_BYTES <= sample.size(); ++i)
+        {
+            uint64_t kmer;
+            std::memcpy(&kmer, sample.data() + i, sizeof(kmer));
+            if (seen.insert(kmer).second)
+                ++frequency[kmer];
+        }
+    }
+
+    // [STEP 2] Greedy segment selection; a chosen segment's k-mers stop counting for the others
+    struct Candidate
+    {
+        uint64_t score;
+        size_t   sample;
+        size_t   offset;
+        bool     operator<(const Candidate& other) const { return score < other.score; }
+    };
+    const auto scoreSegment = [&](size_t sampleIndex, size_t offset)
+    {
+        const std::vector<uint8_t>&  sample = samples[sampleIndex];
+        const size_t                 end    = std::min(offset + TRAIN_SEGMENT_SIZE, sample.size());
+        std::unordered_set<uint64_t> counted;
+        uint64_t                     score = 0;
+        for (size_t i = offset; i + TRAIN_KMER_BYTES <= end; ++i)
+        {
+            uint64_t kmer;
+            std::memcpy(&kmer, sample.data() + i, sizeof(kmer));
+            if (!counted.insert(kmer).second)
+                continue;
+            auto found = frequency.find(kmer);
+            // A pattern seen in a single sample does not help the others
+            if (found != frequency.end() && found->second > 1)
+                score += found->second;
+        }
+        return score;
+    };
+
+    std::priority_queue<Candidate> candidates;
+    for (size_t sampleIndex = 0; sampleIndex < samples.size(); ++sampleIndex)
+    {
+        for (size_t offset = 0; offset + TRAIN_SEGMENT_SIZE <= samples[sampleIndex].size(); offset += TRAIN_SEGMENT_SIZE)
+        {
+            const uint64_t score = scoreSegment(sampleIndex, offset);
+            if (score > 0)
+                candidates.push({score, sampleIndex, offset});
+        }
+    }
+
+    std::vector<const uint8_t*> chosen;
+    while (!candidates.empty() && chosen.size() * TRAIN_SEGMENT_SIZE + TRAIN_SEGMENT_SIZE <= capacity)
+    {
+        Candidate top = candidates.top();
+        candidates.pop();
+        top.score = scoreSegment(top.sample, top.offset);
+        if (top.score == 0)
+            continue;
+        if (!candidates.empty() && top.score < candidates.top().score)
+        {
+            candidates.push(top); // Stale score, retry once the others are re-evaluated
+            continue;
+        }
+
+        const uint8_t* segment = samples[top.sample].data() + top.offset;
+        chosen.push_back(segment);
+        for (size_t i = 0; i + TRAIN_KMER_BYTES <= TRAIN_SEGMENT_SIZE; ++i)
+        {
+            uint64_t kmer;
+            std::memcpy(&kmer, segment + i, sizeof(kmer));
+            frequency.erase(kmer);
+        }
+    }
+
+    // Best segments last: they end up at the shortest offsets from the data
+    std::vector<uint8_t> bytes;
+    bytes.reserve(chosen.size() * TRAIN_SEGMENT_SIZE);
+    for (auto it = chosen.rbegin(); it != chosen.rend(); ++it)
+        bytes.insert(bytes.end(), *it, *it + TRAIN_SEGMENT_SIZE);
+    return std::make_shared<ChunkDictionary>(std::move(bytes));
+}
+
+// ------------------------------------------------------------------------------------------------
+std::shared_ptr<ChunkDictionary> ChunkDictionary::Load(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    uint32_t      header[2] = {};
+    if (!file.read(reinterpret_cast<char*>(header), sizeof(header)) || header[0] != DICTIONARY_MAGIC || header[1] > MAX_OFFSET)
+        return nullptr;
+
+    std::vector<uint8_t> bytes(header[1]);
+    if (!file.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size())))
+        return nullptr;
+    return std::make_shared<ChunkDictionary>(std::move(bytes));
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ChunkDictionary::Save(const std::string& path) const
+{
+    std::ofstream  file(path, std::ios::binary | std::ios::trunc);
+    const uint32_t header[2] = {DICTIONARY_MAGIC, static_cast<uint32_t>(m_bytes.size())};
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(m_bytes.data()), static_cast<std::streamsize>(m_bytes.size()));
+    return static_cast<bool>(file);
+}
+
+// ------------------------------------------------------------------------------------------------
+uint32_t ChunkCodec::Encode(ChunkCodecId codec, int level, const uint8_t* data, size_t size, std::vector<uint8_t>& outPayload, const ChunkDictionary* dictionary)
+{
+    if (codec == ChunkCodecId::Lz4Dictionary && (!dictionary || dictionary->GetBytes().empty()))
+        codec = ChunkCodecId::Lz4;
+    level = std::clamp(level, MIN_LEVEL, MAX_LEVEL);
+
+    outPayload.clear();
+    const uint32_t decodedSize = static_cast<uint32_t>(size);
+    outPayload.resize(SIZE_PREFIX_BYTES);
+    std::memcpy(outPayload.data(), &decodedSize, SIZE_PREFIX_BYTES);
+
+    switch (codec)
+    {
+    case ChunkCodecId::Lz4:
+        CompressBlock(data, 0, size, level, outPayload);
+        return static_cast<uint32_t>(codec) | (static_cast<uint32_t>(level) << 8);
+
+    case ChunkCodecId::Lz4Dictionary:
+        {
+            const std::vector<uint8_t>& dictBytes = dictionary->GetBytes();
+            std::vector<uint8_t>        window(dictBytes.size() + size);
+            std::memcpy(window.data(), dictBytes.data(), dictBytes.size());
+            if (size > 0)
+                std::memcpy(window.data() + dictBytes.size(), data, size);
+            CompressBlock(window.data(), dictBytes.size(), window.size(), level, outPayload);
+            return static_cast<uint32_t>(codec) | (static_cast<uint32_t>(level) << 8) | (static_cast<uint32_t>(dictionary->GetId()) << 16);
+        }
+
+    case ChunkCodecId::Raw:
+    default:
+        outPayload.insert(outPayload.end(), data, data + size);
+        return static_cast<uint32_t>(ChunkCodecId::Raw);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ChunkCodec::Decode(uint32_t tag, const uint8_t* payload, size_t size, std::vector<uint8_t>& outData)
+{
+    if (size < SIZE_PREFIX_BYTES)
+        return false;
+    uint32_t decodedSize = 0;
+    std::memcpy(&decodedSize, payload, SIZE_PREFIX_BYTES);
+    // The size prefix is untrusted; nothing a chunk serializes to is larger than this
+    if (decodedSize > ChunkPayload::GetMaxSerializedSize())
+        return false;
+    const uint8_t* stream     = payload + SIZE_PREFIX_BYTES;
+    const size_t   streamSize = size - SIZE_PREFIX_BYTES;
+    outData.resize(decodedSize);
+
+    switch (GetCodec(tag))
+    {
+    case ChunkCodecId::Raw:
+        if (streamSize != decodedSize)
+            return false;
+        if (decodedSize > 0)
+            std::memcpy(outData.data(), stream, decodedSize);
+        return true;
+
+    case ChunkCodecId::Lz4:
+        return DecompressBlock(stream, streamSize, outData.data(), decodedSize, nullptr, 0);
+
+    case ChunkCodecId::Lz4Dictionary:
+        {
+            const std::shared_ptr<ChunkDictionary> dictionary = FindDictionary(GetDictionaryId(tag));
+            if (!dictionary)
+                return false;
+            const std::vector<uint8_t>& dictBytes = dictionary->GetBytes();
+            return DecompressBlock(stream, streamSize, outData.data(), decodedSize, dictBytes.data(), dictBytes.size());
+        }
+
+    default:
+        return false;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void ChunkCodec::RegisterDictionary(std::shared_ptr<ChunkDictionary> dictionary)
+{
+    if (!dictionary)
+        return;
+    std::lock_guard<std::mutex> lock(GetDictionaryMutex());
+    GetDictionaries()[dictionary->GetId()] = std::move(dictionary);
+}
+
+// ------------------------------------------------------------------------------------------------
+std::shared_ptr<ChunkDictionary> ChunkCodec::FindDictionary(uint16_t id)
+{
+    std::lock_guard<std::mutex> lock(GetDictionaryMutex());
+    auto                        found = GetDictionaries().find(id);
+    return found != GetDictionaries().end() ? found->second : nullptr;
+}
+
+// ------------------------------------------------------------------------------------------------
+const char* ChunkCodec::GetCodecName(ChunkCodecId codec)
+{
+    switch (codec)
+    {
+    case ChunkCodecId::Raw: return "raw";
+    case ChunkCodecId::Lz4: return "lz4";
+    case ChunkCodecId::Lz4Dictionary: return "lz4dict";
+    default: return "unknown";
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ChunkCodec::ParseCodecName(const std::string& name, ChunkCodecId& outCodec)
+{
+    for (ChunkCodecId codec : {ChunkCodecId::Raw, ChunkCodecId::Lz4, ChunkCodecId::Lz4Dictionary})
+    {
+        if (name == GetCodecName(codec))
+        {
+            outCodec = codec;
+            return true;
+        }
+    }
+    return false;
+}
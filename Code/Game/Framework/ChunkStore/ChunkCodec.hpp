@@ -0,0 +1,81 @@
+/**
+ * @file ChunkCodec.hpp
+ * @brief Chunk payload codecs: raw, LZ4 block format and LZ4 with a trained dictionary
+ * @date 2026-10-16
+ *
+ * Decompression is on the chunk load critical path, so the codecs here are LZ4 block format (byte
+ * aligned, no entropy stage) with the level selecting how hard the encoder searches for matches.
+ * The decoder is the same for every level.
+ *
+ * Small, palette-heavy chunks share most of their byte patterns (air columns, stone layers, the
+ * palette names). ChunkDictionary::Train() distills those patterns from sample chunks into a prefix
+ * dictionary that the encoder may reference like earlier input, so even the first bytes of a chunk
+ * compress well.
+ *
+ * Every encoded payload carries its codec, level and dictionary id in a 32-bit tag (stored per chunk
+ * by RegionChunkStore), so worlds with chunks written by different codecs keep decoding. Dictionaries
+ * must be registered before payloads that reference them are decoded.
+ *
+ * Tag layout: bits 0-7 codec, bits 8-15 level, bits 16-31 dictionary id (0 = none)
+ * Payload layout: uint32 decoded size + codec stream
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+enum class ChunkCodecId : uint8_t
+{
+    Raw           = 0,
+    Lz4           = 1,
+    Lz4Dictionary = 2,
+};
+
+class ChunkDictionary
+{
+public:
+    /// Pick the most shared byte segments of the samples, up to capacity bytes
+    static std::shared_ptr<ChunkDictionary> Train(const std::vector<std::vector<uint8_t>>& samples, size_t capacity);
+    static std::shared_ptr<ChunkDictionary> Load(const std::string& path);
+
+    explicit ChunkDictionary(std::vector<uint8_t> bytes);
+
+    bool Save(const std::string& path) const;
+
+    uint16_t                    GetId() const { return m_id; }
+    const std::vector<uint8_t>& GetBytes() const { return m_bytes; }
+
+private:
+    std::vector<uint8_t> m_bytes;
+    uint16_t             m_id = 0; // Content hash, never 0
+};
+
+class ChunkCodec
+{
+public:
+    ChunkCodec()                             = delete; // Prevent instantiation
+    ChunkCodec(const ChunkCodec&)            = delete; // Prevent copy
+    ChunkCodec& operator=(const ChunkCodec&) = delete; // Prevent assignment
+
+    static constexpr int MIN_LEVEL = 1;
+    static constexpr int MAX_LEVEL = 9;
+
+    /// Encode into outPayload and return the tag to store with it. Lz4Dictionary needs a dictionary.
+    static uint32_t Encode(ChunkCodecId codec, int level, const uint8_t* data, size_t size, std::vector<uint8_t>& outPayload, const ChunkDictionary* dictionary = nullptr);
+
+    /// Decode a payload written by Encode(). Returns false on corrupt input, a decoded size above
+    /// ChunkPayload::GetMaxSerializedSize() or an unknown dictionary.
+    static bool Decode(uint32_t tag, const uint8_t* payload, size_t size, std::vector<uint8_t>& outData);
+
+    static void                             RegisterDictionary(std::shared_ptr<ChunkDictionary> dictionary);
+    static std::shared_ptr<ChunkDictionary> FindDictionary(uint16_t id);
+
+    static ChunkCodecId GetCodec(uint32_t tag) { return static_cast<ChunkCodecId>(tag & 0xFFu); }
+    static int          GetLevel(uint32_t tag) { return static_cast<int>((tag >> 8) & 0xFFu); }
+    static uint16_t     GetDictionaryId(uint32_t tag) { return static_cast<uint16_t>(tag >> 16); }
+    static const char*  GetCodecName(ChunkCodecId codec);
+    static bool         ParseCodecName(const std::string& name, ChunkCodecId& outCodec);
+};
@@ -0,0 +1,205 @@
+/**
+ * @file ChunkCodecBenchmark.cpp
+ * @brief Chunk codec ratio and throughput comparison on generated chunks
+ * @date 2026-10-16
+ */
+
+#include "ChunkCodecBenchmark.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <unordered_set>
+#include <vector>
+
+#include "ChunkCodec.hpp"
+#include "ChunkPayload.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Core/Yaml.hpp"
+#include "Engine/Voxel/Chunk/Chunk.hpp"
+#include "Engine/Voxel/World/World.hpp"
+#include "Game/Framework/Scheduling/TaskScheduler.hpp"
+
+using namespace enigma::core;
+
+ChunkCodecBenchmarkSettings ChunkCodecBenchmark::s_settings;
+
+namespace
+{
+    constexpr int      PASSES                 = 3; // Timed passes over the evaluation half
+    constexpr uint32_t MAX_CAPTURES_PER_FRAME = 8;
+
+    struct BenchmarkCase
+    {
+        ChunkCodecId codec;
+        int          level;
+    };
+
+    constexpr BenchmarkCase CASES[] = {
+        {ChunkCodecId::Raw, 0},
+        {ChunkCodecId::Lz4, 1},
+        {ChunkCodecId::Lz4, 3},
+        {ChunkCodecId::Lz4, 6},
+        {ChunkCodecId::Lz4, 9},
+        {ChunkCodecId::Lz4Dictionary, 1},
+        {ChunkCodecId::Lz4Dictionary, 9},
+    };
+
+    // Main thread only; Run() reads the corpus after capturing has stopped
+    std::vector<std::vector<uint8_t>> s_corpus;
+    std::unordered_set<uint64_t>      s_capturedChunks;
+    bool                              s_capturing = false;
+
+    double ToMegabytesPerSecond(size_t bytes, double seconds)
+    {
+        return seconds > 0.0 ? static_cast<double>(bytes) / (1024.0 * 1024.0) / seconds : 0.0;
+    }
+
+    uint64_t MakeChunkKey(int32_t chunkX, int32_t chunkY)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(chunkX)) << 32) | static_cast<uint32_t>(chunkY);
+    }
+
+    /// Floor division, so negative block coordinates map to the chunk below zero
+    int32_t FloorDiv(int32_t value, int32_t divisor)
+    {
+        const int32_t quotient = value / divisor;
+        return (value % divisor != 0 && (value < 0) != (divisor < 0)) ? quotient - 1 : quotient;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void ChunkCodecBenchmark::LoadSettings(const YamlConfiguration& config)
+{
+    s_settings.enabled         = config.GetBoolean("chunkCodecBenchmark.enabled", s_settings.enabled);
+    s_settings.corpusChunks    = static_cast<uint32_t>(std::max(config.GetInt("chunkCodecBenchmark.corpusChunks", static_cast<int>(s_settings.corpusChunks)), 2));
+    s_settings.dictionaryBytes = static_cast<uint32_t>(std::max(config.GetInt("chunkCodecBenchmark.dictionaryBytes", static_cast<int>(s_settings.dictionaryBytes)), 0));
+    s_settings.outputPath      = config.GetString("chunkCodecBenchmark.output", s_settings.outputPath);
+
+    s_capturing = s_settings.enabled;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ChunkCodecBenchmark::Update(enigma::voxel::World& world, const Vec3& playerPosition)
+{
+    using enigma::voxel::Chunk;
+    if (!s_capturing)
+        return;
+
+    // Square around the player just large enough for the corpus; chunks still generating are picked up later
+    const int32_t radius   = static_cast<int32_t>(std::ceil(std::sqrt(static_cast<double>(s_settings.corpusChunks)) * 0.5));
+    const int32_t centerX  = FloorDiv(static_cast<int32_t>(std::floor(playerPosition.x)), Chunk::CHUNK_SIZE_X);
+    const int32_t centerY  = FloorDiv(static_cast<int32_t>(std::floor(playerPosition.y)), Chunk::CHUNK_SIZE_Y);
+    uint32_t      captures = 0;
+    for (int32_t chunkY = centerY - radius; chunkY <= centerY + radius && s_capturing && captures < MAX_CAPTURES_PER_FRAME; ++chunkY)
+    {
+        for (int32_t chunkX = centerX - radius; chunkX <= centerX + radius && s_capturing && captures < MAX_CAPTURES_PER_FRAME; ++chunkX)
+        {
+            Chunk* chunk = world.GetChunk(chunkX, chunkY);
+            if (!chunk || !chunk->IsGenerated() || s_capturedChunks.count(MakeChunkKey(chunkX, chunkY)) != 0)
+                continue;
+            Capture(chunk, chunkX, chunkY);
+            ++captures;
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void ChunkCodecBenchmark::Capture(enigma::voxel::Chunk* chunk, int32_t chunkX, int32_t chunkY)
+{
+    std::vector<uint8_t> payload;
+    ChunkPayload::Serialize(chunk, payload);
+    s_capturedChunks.insert(MakeChunkKey(chunkX, chunkY));
+    s_corpus.push_back(std::move(payload));
+    if (s_corpus.size() >= s_settings.corpusChunks)
+    {
+        s_capturing = false;
+        TaskScheduler::Submit(TaskType::Background, &ChunkCodecBenchmark::Run);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void ChunkCodecBenchmark::Shutdown()
+{
+    s_capturing = false;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ChunkCodecBenchmark::Run()
+{
+    using Clock = std::chrono::steady_clock;
+
+    // [STEP 1] Train on the first half, evaluate on the second so the dictionary is not scored on its own samples
+    const size_t                            half = s_corpus.size() / 2;
+    const std::vector<std::vector<uint8_t>> training(s_corpus.begin(), s_corpus.begin() + static_cast<std::ptrdiff_t>(half));
+    const std::vector<std::vector<uint8_t>> evaluation(s_corpus.begin() + static_cast<std::ptrdiff_t>(half), s_corpus.end());
+
+    const auto                             trainStart = Clock::now();
+    const std::shared_ptr<ChunkDictionary> dictionary = ChunkDictionary::Train(training, s_settings.dictionaryBytes);
+    const double                           trainMs    = std::chrono::duration<double, std::milli>(Clock::now() - trainStart).count();
+    ChunkCodec::RegisterDictionary(dictionary);
+
+    size_t corpusBytes = 0;
+    for (const std::vector<uint8_t>& chunk : evaluation)
+        corpusBytes += chunk.size();
+
+    // [STEP 2] Round trip every codec over the evaluation chunks
+    std::string results;
+    for (const BenchmarkCase& benchmarkCase : CASES)
+    {
+        size_t               encodedBytes  = 0;
+        double               encodeSeconds = 0.0;
+        double               decodeSeconds = 0.0;
+        bool                 roundTrip     = true;
+        std::vector<uint8_t> encoded;
+        std::vector<uint8_t> decoded;
+        for (int pass = 0; pass < PASSES; ++pass)
+        {
+            for (const std::vector<uint8_t>& chunk : evaluation)
+            {
+                const auto     encodeStart = Clock::now();
+                const uint32_t tag         = ChunkCodec::Encode(benchmarkCase.codec, benchmarkCase.level, chunk.data(), chunk.size(), encoded, dictionary.get());
+                const auto     decodeStart = Clock::now();
+                const bool     decodedOk   = ChunkCodec::Decode(tag, encoded.data(), encoded.size(), decoded);
+                const auto     decodeEnd   = Clock::now();
+
+                encodeSeconds += std::chrono::duration<double>(decodeStart - encodeStart).count();
+                decodeSeconds += std::chrono::duration<double>(decodeEnd - decodeStart).count();
+                roundTrip     = roundTrip && decodedOk && decoded == chunk;
+                if (pass == 0)
+                    encodedBytes += encoded.size();
+            }
+        }
+
+        const double ratio      = encodedBytes > 0 ? static_cast<double>(corpusBytes) / static_cast<double>(encodedBytes) : 0.0;
+        const double encodeMBps = ToMegabytesPerSecond(corpusBytes * PASSES, encodeSeconds);
+        const double decodeMBps = ToMegabytesPerSecond(corpusBytes * PASSES, decodeSeconds);
+        DebuggerPrintf("[ChunkCodecBenchmark] %-8s level %d: ratio %6.2f, encode %8.1f MB/s, decode %8.1f MB/s%s\n",
+                       ChunkCodec::GetCodecName(benchmarkCase.codec), benchmarkCase.level, ratio, encodeMBps, decodeMBps,
+                       roundTrip ? "" : " ROUND TRIP FAILED");
+
+        results += Stringf("%s\n    {\"codec\": \"%s\", \"level\": %d, \"encodedBytes\": %zu, \"ratio\": %.3f, \"encodeMBps\": %.1f, \"decodeMBps\": %.1f, \"roundTrip\": %s}",
+                           results.empty() ? "" : ",", ChunkCodec::GetCodecName(benchmarkCase.codec), benchmarkCase.level, encodedBytes, ratio,
+                           encodeMBps, decodeMBps, roundTrip ? "true" : "false");
+    }
+
+    // [STEP 3] Report, and keep the dictionary next to it
+    const std::filesystem::path outputPath(s_settings.outputPath);
+    std::error_code             ec;
+    std::filesystem::create_directories(outputPath.parent_path(), ec);
+
+    std::filesystem::path dictionaryPath = outputPath;
+    dictionaryPath.replace_extension(".dict");
+    dictionary->Save(dictionaryPath.string());
+
+    std::ofstream output(outputPath, std::ios::trunc);
+    output << Stringf("{\n  \"trainingChunks\": %zu,\n  \"evaluationChunks\": %zu,\n  \"evaluationBytes\": %zu,\n"
+                      "  \"dictionaryBytes\": %zu,\n  \"dictionaryId\": %u,\n  \"trainMs\": %.1f,\n  \"results\": [",
+                      training.size(), evaluation.size(), corpusBytes, dictionary->GetBytes().size(),
+                      static_cast<unsigned>(dictionary->GetId()), trainMs);
+    output << results << "\n  ]\n}\n";
+    DebuggerPrintf("[ChunkCodecBenchmark] Finished, wrote %s\n", s_settings.outputPath.c_str());
+}
@@ -0,0 +1,60 @@
+/**
+ * @file ChunkCodecBenchmark.hpp
+ * @brief Compares the chunk codecs on a corpus of freshly generated chunks
+ * @date 2026-10-16
+ *
+ * When chunkCodecBenchmark.enabled is set, Update() serializes generated chunks loaded around the
+ * player until corpusChunks are collected; a corpus larger than the loaded area fills as the player
+ * moves. Once the corpus is full a Background scheduler task trains a dictionary on the first
+ * half, then encodes and decodes the second half with every codec/level pair and writes compression
+ * ratio and encode/decode throughput to the output JSON file. The trained dictionary is saved next
+ * to it so it can be shipped and registered with ChunkCodec.
+ *
+ * Every codec is the in-house LZ4 block format: raw, lz4, and lz4dict (LZ4 with a trained prefix
+ * dictionary). The tree ships no third-party compressor, so no zstd numbers are produced.
+ */
+
+#pragma once
+#include <cstdint>
+#include <string>
+
+#include "Engine/Core/Yaml.hpp"
+#include "Engine/Math/Vec3.hpp"
+
+namespace enigma::voxel
+{
+    class Chunk;
+    class World;
+}
+
+struct ChunkCodecBenchmarkSettings
+{
+    bool        enabled         = false;
+    uint32_t    corpusChunks    = 256;
+    uint32_t    dictionaryBytes = 16 * 1024;
+    std::string outputPath      = "Logs/chunk_codec_benchmark.json";
+};
+
+class ChunkCodecBenchmark
+{
+public:
+    ChunkCodecBenchmark()                                      = delete; // Prevent instantiation
+    ChunkCodecBenchmark(const ChunkCodecBenchmark&)            = delete; // Prevent copy
+    ChunkCodecBenchmark& operator=(const ChunkCodecBenchmark&) = delete; // Prevent assignment
+
+    static void LoadSettings(const enigma::core::YamlConfiguration& config);
+
+    /// Main thread, after World::Update: captures generated chunks around the player; no-op unless enabled
+    static void Update(enigma::voxel::World& world, const Vec3& playerPosition);
+
+    /// Stops capturing; a benchmark already queued finishes when TaskScheduler::Shutdown() drains
+    static void Shutdown();
+
+    static const ChunkCodecBenchmarkSettings& GetSettings() { return s_settings; }
+
+private:
+    static void Capture(enigma::voxel::Chunk* chunk, int32_t chunkX, int32_t chunkY);
+    static void Run();
+
+    static ChunkCodecBenchmarkSettings s_settings;
+};
@@ -0,0 +1,186 @@
+/**
+ * @file ChunkPayload.cpp
+ * @brief Palette serialization of chunk blocks
+ * @date 2026-10-16
+ */
+
+#include "ChunkPayload.hpp"
+
+#include <string>
+#include <unordered_map>
+
+#include "Engine/Registry/Block/BlockRegistry.hpp"
+#include "Engine/Voxel/Chunk/Chunk.hpp"
+
+using namespace enigma::registry::block;
+using namespace enigma::voxel;
+
+namespace
+{
+    constexpr size_t BLOCK_COUNT = static_cast<size_t>(Chunk::CHUNK_SIZE_X) * Chunk::CHUNK_SIZE_Y * Chunk::CHUNK_SIZE_Z;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t ChunkPayload::GetMaxSerializedSize()
+{
+    // Header and width byte, palette entries (length byte + name), then index + LEB128 run per block
+    constexpr size_t MAX_PALETTE_SIZE = BLOCK_COUNT < 0xFFFF ? BLOCK_COUNT : 0xFFFF;
+    return 3 + MAX_PALETTE_SIZE * 256 + 1 + BLOCK_COUNT * 3;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ChunkPayload::Serialize(Chunk* chunk, std::vector<uint8_t>& outData, bool runLength)
+{
+    std::vector<std::string>                  palette;
+    std::unordered_map<std::string, uint16_t> paletteIndex;
+    std::vector<uint16_t>                     indices;
+    indices.reserve(BLOCK_COUNT);
+
+    for (int z = 0; z < Chunk::CHUNK_SIZE_Z; ++z)
+    {
+        for (int y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+        {
+            for (int x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+            {
+                auto*       blockState = chunk->GetBlock(x, y, z);
+                std::string name       = blockState ? blockState->GetBlock()->GetRegistryName() : "air";
+                auto        found      = paletteIndex.find(name);
+                if (found == paletteIndex.end())
+                {
+                    found = paletteIndex.emplace(name, static_cast<uint16_t>(palette.size())).first;
+                    palette.push_back(std::move(name));
+                }
+                indices.push_back(found->second);
+            }
+        }
+    }
+
+    outData.clear();
+    outData.push_back(FORMAT_VERSION);
+    outData.push_back(static_cast<uint8_t>(palette.size() & 0xFF));
+    outData.push_back(static_cast<uint8_t>(palette.size() >> 8));
+    for (const std::string& name : palette)
+    {
+        outData.push_back(static_cast<uint8_t>(name.size()));
+        outData.insert(outData.end(), name.begin(), name.end());
+    }
+
+    const uint8_t indexWidth = palette.size() > 256 ? 2 : 1;
+    const auto    pushIndex  = [&](uint16_t index)
+    {
+        outData.push_back(static_cast<uint8_t>(index & 0xFF));
+        if (indexWidth == 2)
+            outData.push_back(static_cast<uint8_t>(index >> 8));
+    };
+
+    if (!runLength)
+    {
+        outData.push_back(indexWidth);
+        outData.reserve(outData.size() + indices.size() * indexWidth);
+        for (uint16_t index : indices)
+            pushIndex(index);
+        return;
+    }
+
+    outData.push_back(indexWidth | RUN_LENGTH_FLAG);
+    for (size_t start = 0; start < indices.size();)
+    {
+        size_t end = start + 1;
+        while (end < indices.size() && indices[end] == indices[start])
+            ++end;
+        pushIndex(indices[start]);
+        for (size_t run = end - start; ; run >>= 7)
+        {
+            const uint8_t low = static_cast<uint8_t>(run & 0x7F);
+            if (run < 0x80)
+            {
+                outData.push_back(low);
+                break;
+            }
+            outData.push_back(low | 0x80);
+        }
+        start = end;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ChunkPayload::Deserialize(const uint8_t* data, size_t size, Chunk* chunk)
+{
+    const uint8_t* cursor = data;
+    const uint8_t* end    = data + size;
+    if (end - cursor < 3 || cursor[0] != FORMAT_VERSION)
+        return false;
+    const size_t paletteSize = static_cast<size_t>(cursor[1]) | (static_cast<size_t>(cursor[2]) << 8);
+    cursor += 3;
+
+    std::vector<decltype(chunk->GetBlock(0, 0, 0))> palette;
+    palette.reserve(paletteSize);
+    for (size_t i = 0; i < paletteSize; ++i)
+    {
+        if (cursor >= end || static_cast<size_t>(end - cursor - 1) < *cursor)
+            return false;
+        const std::string name(reinterpret_cast<const char*>(cursor + 1), *cursor);
+        cursor += 1 + *cursor;
+
+        auto block = BlockRegistry::GetBlock("simpleminer", name);
+        if (!block)
+            return false;
+        palette.push_back(block->GetDefaultState());
+    }
+
+    if (cursor >= end)
+        return false;
+    const bool   runLength  = (*cursor & RUN_LENGTH_FLAG) != 0;
+    const size_t indexWidth = *cursor++ & ~RUN_LENGTH_FLAG;
+    if (indexWidth != 1 && indexWidth != 2)
+        return false;
+    if (!runLength && static_cast<size_t>(end - cursor) != BLOCK_COUNT * indexWidth)
+        return false;
+
+    // Expand to one palette index per block first, so a malformed payload leaves the chunk untouched
+    std::vector<uint16_t> indices;
+    indices.reserve(BLOCK_COUNT);
+    while (indices.size() < BLOCK_COUNT)
+    {
+        if (static_cast<size_t>(end - cursor) < indexWidth)
+            return false;
+        uint16_t index = *cursor++;
+        if (indexWidth == 2)
+            index = static_cast<uint16_t>(index | (*cursor++ << 8));
+        if (index >= palette.size())
+            return false;
+
+        size_t run = 1;
+        if (runLength)
+        {
+            run = 0;
+            for (int shift = 0;; shift += 7)
+            {
+                if (cursor >= end || shift > 28)
+                    return false;
+                const uint8_t byte = *cursor++;
+                run |= static_cast<size_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0)
+                    break;
+            }
+            if (run == 0 || run > BLOCK_COUNT - indices.size())
+                return false;
+        }
+        indices.insert(indices.end(), run, index);
+    }
+    if (cursor != end)
+        return false;
+
+    size_t blockIndex = 0;
+    for (int z = 0; z < Chunk::CHUNK_SIZE_Z; ++z)
+    {
+        for (int y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+        {
+            for (int x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+            {
+                chunk->SetBlock(x, y, z, palette[indices[blockIndex++]]);
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,43 @@
+/**
+ * @file ChunkPayload.hpp
+ * @brief Palette serialization of chunk blocks, the uncompressed input of the chunk codecs
+ * @date 2026-10-16
+ *
+ * Layout: uint8 version, uint16 palette size, palette entries (uint8 length + block registry name),
+ * uint8 index width (1 or 2 bytes), then one palette index per block, z outer, y, x inner.
+ * With RUN_LENGTH_FLAG set in the width byte the indices are runs instead: palette index + LEB128
+ * run length. Runs suit chunks with long air and stone spans and keep cache payloads small even
+ * before compression.
+ *
+ * Blocks are stored by name in their default state, which is all the generators produce. Names
+ * instead of numeric ids keep payloads valid across registry order changes.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace enigma::voxel
+{
+    class Chunk;
+}
+
+class ChunkPayload
+{
+public:
+    ChunkPayload()                               = delete; // Prevent instantiation
+    ChunkPayload(const ChunkPayload&)            = delete; // Prevent copy
+    ChunkPayload& operator=(const ChunkPayload&) = delete; // Prevent assignment
+
+    static constexpr uint8_t FORMAT_VERSION  = 1;
+    static constexpr uint8_t RUN_LENGTH_FLAG = 0x80;
+
+    static void Serialize(enigma::voxel::Chunk* chunk, std::vector<uint8_t>& outData, bool runLength = false);
+
+    /// Upper bound of a Serialize() payload: a full palette of 255-byte names and 3 bytes per block
+    static size_t GetMaxSerializedSize();
+
+    /// Fill chunk from a Serialize() payload. Returns false on a malformed payload or an unknown block.
+    static bool Deserialize(const uint8_t* data, size_t size, enigma::voxel::Chunk* chunk);
+};
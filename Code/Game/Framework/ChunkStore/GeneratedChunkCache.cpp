@@ -0,0 +1,337 @@
+/**
+ * @file GeneratedChunkCache.cpp
+ * @brief Bounded on-disk cache of generated, unmodified chunks
+ * @date 2026-10-16
+ */
+
+#include "GeneratedChunkCache.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include "ChunkCodec.hpp"
+#include "ChunkPayload.hpp"
+#include "RegionChunkStore.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/Yaml.hpp"
+#include "Game/Framework/Scheduling/TaskScheduler.hpp"
+
+using namespace enigma::core;
+
+GeneratedChunkCacheSettings GeneratedChunkCache::s_settings;
+
+namespace
+{
+    constexpr uint32_t PAYLOAD_MAGIC = 0x31434745; // "EGC1"
+
+    struct PayloadHeader
+    {
+        uint32_t magic      = PAYLOAD_MAGIC;
+        uint32_t seed       = 0;
+        uint64_t configHash = 0;
+        int32_t  chunkX     = 0;
+        int32_t  chunkY     = 0;
+    };
+    static_assert(sizeof(PayloadHeader) == 24, "PayloadHeader is stored as-is");
+
+    struct RegionUse
+    {
+        uint64_t bytes   = 0;
+        uint64_t lastUse = 0;
+    };
+
+    // s_mutex guards the active store and the region bookkeeping
+    std::mutex                        s_mutex;
+    std::shared_ptr<RegionChunkStore> s_store;
+    std::filesystem::path             s_storeDirectory;
+    uint32_t                          s_storeSeed = 0;
+    uint64_t                          s_storeHash = 0;
+    std::map<std::string, RegionUse>  s_regions; // Every cache region file on disk, keyed by path
+    std::set<std::string>             s_touchedRegions; // Written since the last flush, sizes need a refresh
+    uint64_t                          s_diskBytes   = 0;
+    uint64_t                          s_useClock    = 0;
+    uint32_t                          s_queued      = 0;
+    bool                              s_scanned     = false;
+    ChunkCodecId                      s_codec       = ChunkCodecId::Lz4;
+    std::mutex                        s_flushMutex;
+    std::atomic<bool>                 s_flushQueued{false}; // A FileIO flush task is pending
+
+    std::atomic<uint64_t> s_hits{0};
+    std::atomic<uint64_t> s_misses{0};
+    std::atomic<uint64_t> s_rejected{0};
+    std::atomic<uint64_t> s_stores{0};
+    std::atomic<uint64_t> s_evictedRegions{0};
+
+    bool ParseRegionFileName(const std::string& name, int32_t& outRegionX, int32_t& outRegionY)
+    {
+        // r.<x>.<y>.ecr
+        if (name.size() < 9 || name.compare(0, 2, "r.") != 0 || name.compare(name.size() - 4, 4, ".ecr") != 0)
+            return false;
+        const char* begin  = name.data() + 2;
+        const char* end    = name.data() + name.size() - 4;
+        const auto  first  = std::from_chars(begin, end, outRegionX);
+        if (first.ec != std::errc() || first.ptr == end || *first.ptr != '.')
+            return false;
+        const auto second = std::from_chars(first.ptr + 1, end, outRegionY);
+        return second.ec == std::errc() && second.ptr == end;
+    }
+
+    /// First use: pick up region files left by earlier sessions, oldest first in the LRU
+    void ScanDirectory(const std::string& directory)
+    {
+        std::error_code                                                         ec;
+        std::vector<std::pair<std::filesystem::file_time_type, std::string>> files;
+        for (auto it = std::filesystem::recursive_directory_iterator(directory, ec); !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec))
+        {
+            if (!it->is_regular_file(ec) || it->path().extension() != ".ecr")
+                continue;
+            files.emplace_back(it->last_write_time(ec), it->path().generic_string());
+        }
+        std::sort(files.begin(), files.end());
+        for (const auto& [writeTime, path] : files)
+        {
+            RegionUse& use = s_regions[path];
+            use.bytes      = std::filesystem::file_size(path, ec);
+            use.lastUse    = ++s_useClock;
+            s_diskBytes += ec ? 0 : use.bytes;
+        }
+    }
+
+    /// Store for this seed and generator; switches (and flushes the old one) when either changes
+    std::shared_ptr<RegionChunkStore> AcquireStore(uint32_t seed, uint64_t configHash, const GeneratedChunkCacheSettings& settings)
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        if (!s_scanned)
+        {
+            ScanDirectory(settings.directory);
+            s_scanned = true;
+        }
+        if (s_store && s_storeSeed == seed && s_storeHash == configHash)
+            return s_store;
+
+        char keyName[32];
+        snprintf(keyName, sizeof(keyName), "%u_%016llx", seed, static_cast<unsigned long long>(configHash));
+        s_storeDirectory = std::filesystem::path(settings.directory) / keyName;
+        s_storeSeed      = seed;
+        s_storeHash      = configHash;
+
+        RegionChunkStoreConfig config;
+        config.directory = s_storeDirectory.string();
+        s_store          = std::make_shared<RegionChunkStore>(config);
+        return s_store;
+    }
+
+    void TouchRegion(int32_t chunkX, int32_t chunkY, bool written)
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        const std::string           path = (s_storeDirectory / RegionChunkStore::GetRegionFileName(
+            RegionChunkStore::GetRegionCoord(chunkX), RegionChunkStore::GetRegionCoord(chunkY))).generic_string();
+        if (written)
+        {
+            s_regions[path].lastUse = ++s_useClock;
+            s_touchedRegions.insert(path);
+            ++s_queued;
+            return;
+        }
+        auto found = s_regions.find(path);
+        if (found != s_regions.end())
+            found->second.lastUse = ++s_useClock;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void GeneratedChunkCache::LoadSettings(const YamlConfiguration& config)
+{
+    s_settings.enabled    = config.GetBoolean("generatedChunkCache.enabled", s_settings.enabled);
+    s_settings.directory  = config.GetString("generatedChunkCache.directory", s_settings.directory);
+    s_settings.maxBytes   = static_cast<uint64_t>(std::max(config.GetInt("generatedChunkCache.maxMegabytes", static_cast<int>(s_settings.maxBytes >> 20)), 1)) << 20;
+    s_settings.codec      = config.GetString("generatedChunkCache.codec", s_settings.codec);
+    s_settings.level      = config.GetInt("generatedChunkCache.level", s_settings.level);
+    s_settings.flushBatch = static_cast<uint32_t>(std::max(config.GetInt("generatedChunkCache.flushBatch", static_cast<int>(s_settings.flushBatch)), 1));
+
+    // Dictionaries are not persisted with the cache, so only the self-contained codecs are allowed
+    if (!ChunkCodec::ParseCodecName(s_settings.codec, s_codec) || s_codec == ChunkCodecId::Lz4Dictionary)
+    {
+        DebuggerPrintf("[GeneratedChunkCache] Unsupported codec '%s', using lz4\n", s_settings.codec.c_str());
+        s_codec          = ChunkCodecId::Lz4;
+        s_settings.codec = ChunkCodec::GetCodecName(s_codec);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+bool GeneratedChunkCache::TryLoad(enigma::voxel::Chunk* chunk, int32_t chunkX, int32_t chunkY, uint32_t seed, uint64_t configHash)
+{
+    if (!s_settings.enabled || !chunk)
+        return false;
+
+    const std::shared_ptr<RegionChunkStore> store = AcquireStore(seed, configHash, s_settings);
+    std::vector<uint8_t>                    decoded;
+    bool                                    decodedOk = false;
+    const bool                              found     = store->Read(chunkX, chunkY, [&](const uint8_t* data, size_t size, uint32_t tag)
+    {
+        decodedOk = ChunkCodec::Decode(tag, data, size, decoded);
+    });
+    if (!found)
+    {
+        s_misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    PayloadHeader header;
+    if (decodedOk && decoded.size() >= sizeof(header))
+        std::memcpy(&header, decoded.data(), sizeof(header));
+    const bool verified = decodedOk && decoded.size() >= sizeof(header) && header.magic == PAYLOAD_MAGIC && header.seed == seed &&
+        header.configHash == configHash && header.chunkX == chunkX && header.chunkY == chunkY;
+    if (!verified || !ChunkPayload::Deserialize(decoded.data() + sizeof(header), decoded.size() - sizeof(header), chunk))
+    {
+        s_rejected.fetch_add(1, std::memory_order_relaxed);
+        s_misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    TouchRegion(chunkX, chunkY, false);
+    s_hits.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void GeneratedChunkCache::Store(enigma::voxel::Chunk* chunk, int32_t chunkX, int32_t chunkY, uint32_t seed, uint64_t configHash)
+{
+    if (!s_settings.enabled || !chunk)
+        return;
+
+    PayloadHeader header;
+    header.seed       = seed;
+    header.configHash = configHash;
+    header.chunkX     = chunkX;
+    header.chunkY     = chunkY;
+
+    std::vector<uint8_t> blocks;
+    ChunkPayload::Serialize(chunk, blocks, true);
+    std::vector<uint8_t> raw(sizeof(header) + blocks.size());
+    std::memcpy(raw.data(), &header, sizeof(header));
+    std::memcpy(raw.data() + sizeof(header), blocks.data(), blocks.size());
+
+    std::vector<uint8_t> payload;
+    const uint32_t       tag = ChunkCodec::Encode(s_codec, s_settings.level, raw.data(), raw.size(), payload);
+
+    const std::shared_ptr<RegionChunkStore> store = AcquireStore(seed, configHash, s_settings);
+    store->Write(chunkX, chunkY, std::move(payload), tag);
+    s_stores.fetch_add(1, std::memory_order_relaxed);
+    TouchRegion(chunkX, chunkY, true);
+
+    bool flushDue;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        flushDue = s_queued >= s_settings.flushBatch;
+    }
+    // Hand the append and eviction to a FileIO task so the generator worker goes back to terrain
+    if (flushDue && !s_flushQueued.exchange(true))
+    {
+        TaskScheduler::Submit(TaskType::FileIO, []()
+        {
+            s_flushQueued = false;
+            FlushAndEvict();
+        });
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void GeneratedChunkCache::Shutdown()
+{
+    FlushAndEvict();
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_store.reset();
+}
+
+// ------------------------------------------------------------------------------------------------
+GeneratedChunkCacheStats GeneratedChunkCache::GetStats()
+{
+    GeneratedChunkCacheStats stats;
+    stats.hits           = s_hits.load(std::memory_order_relaxed);
+    stats.misses         = s_misses.load(std::memory_order_relaxed);
+    stats.rejected       = s_rejected.load(std::memory_order_relaxed);
+    stats.stores         = s_stores.load(std::memory_order_relaxed);
+    stats.evictedRegions = s_evictedRegions.load(std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    stats.diskBytes   = s_diskBytes;
+    stats.regionFiles = static_cast<uint32_t>(s_regions.size());
+    return stats;
+}
+
+// ------------------------------------------------------------------------------------------------
+void GeneratedChunkCache::FlushAndEvict()
+{
+    // One flusher at a time; workers that find it busy leave their chunks to it or the next one
+    std::unique_lock<std::mutex> flushLock(s_flushMutex, std::try_to_lock);
+    if (!flushLock.owns_lock())
+        return;
+
+    std::shared_ptr<RegionChunkStore> store;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        store    = s_store;
+        s_queued = 0;
+    }
+    if (!store)
+        return;
+    store->Flush();
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    // [STEP 1] Refresh the sizes of the regions written since the last flush
+    std::error_code ec;
+    for (const std::string& path : s_touchedRegions)
+    {
+        RegionUse&     use  = s_regions[path];
+        const uint64_t size = std::filesystem::file_size(path, ec);
+        s_diskBytes         = s_diskBytes - use.bytes + (ec ? 0 : size);
+        use.bytes           = ec ? 0 : size;
+    }
+    s_touchedRegions.clear();
+
+    // [STEP 2] Drop least recently used regions until the cache fits
+    while (s_diskBytes > s_settings.maxBytes && !s_regions.empty())
+    {
+        auto victim = s_regions.begin();
+        for (auto it = s_regions.begin(); it != s_regions.end(); ++it)
+        {
+            if (it->second.lastUse < victim->second.lastUse)
+                victim = it;
+        }
+
+        const std::filesystem::path victimPath(victim->first);
+        int32_t                     regionX = 0;
+        int32_t                     regionY = 0;
+        bool                        removed;
+        if (s_store && victimPath.parent_path().generic_string() == s_storeDirectory.generic_string() &&
+            ParseRegionFileName(victimPath.filename().string(), regionX, regionY))
+        {
+            removed = s_store->EraseRegion(regionX, regionY);
+        }
+        else
+        {
+            removed = std::filesystem::remove(victimPath, ec) || !std::filesystem::exists(victimPath, ec);
+        }
+
+        if (!removed)
+        {
+            // Still open elsewhere (Windows keeps mapped files); retry on a later flush
+            victim->second.lastUse = ++s_useClock;
+            break;
+        }
+        s_diskBytes -= victim->second.bytes;
+        s_regions.erase(victim);
+        s_evictedRegions.fetch_add(1, std::memory_order_relaxed);
+    }
+}
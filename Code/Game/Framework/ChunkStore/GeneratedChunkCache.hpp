@@ -0,0 +1,78 @@
+/**
+ * @file GeneratedChunkCache.hpp
+ * @brief Bounded on-disk cache of generated, unmodified chunks
+ * @date 2026-10-16
+ *
+ * With save_strategy PlayerModifiedOnly the world only saves chunks the player touched, so every
+ * other chunk is regenerated from noise each time it is revisited. The generator asks this cache
+ * first and stores what it generates, turning a revisit into a region read plus a decode.
+ *
+ * Entries live in RegionChunkStore files under <directory>/<seed>_<generator config hash>/, so a
+ * new seed or a generator change never serves stale terrain. Each payload also repeats seed, config
+ * hash and coordinates ahead of the run-length palette blocks and is rejected on mismatch.
+ *
+ * The cache is bounded by maxBytes across all seeds. Eviction is least recently used at region
+ * file granularity (REGION_SIZE^2 chunks), which keeps the on-disk format append-only.
+ *
+ * Thread safety: TryLoad() and Store() are called from chunk generation workers concurrently.
+ */
+
+#pragma once
+#include <cstdint>
+#include <string>
+
+#include "Engine/Core/Yaml.hpp"
+
+namespace enigma::voxel
+{
+    class Chunk;
+}
+
+struct GeneratedChunkCacheSettings
+{
+    bool        enabled    = false;
+    std::string directory  = ".enigma/cache/generated";
+    uint64_t    maxBytes   = 256ull * 1024ull * 1024ull;
+    std::string codec      = "lz4";
+    int         level      = 1;
+    uint32_t    flushBatch = 64; // Stored chunks queued before they are appended to disk
+};
+
+struct GeneratedChunkCacheStats
+{
+    uint64_t hits           = 0;
+    uint64_t misses         = 0;
+    uint64_t rejected       = 0; // Present but failed verification or decoding, counted as misses too
+    uint64_t stores         = 0;
+    uint64_t evictedRegions = 0;
+    uint64_t diskBytes      = 0;
+    uint32_t regionFiles    = 0;
+};
+
+class GeneratedChunkCache
+{
+public:
+    GeneratedChunkCache()                                      = delete; // Prevent instantiation
+    GeneratedChunkCache(const GeneratedChunkCache&)            = delete; // Prevent copy
+    GeneratedChunkCache& operator=(const GeneratedChunkCache&) = delete; // Prevent assignment
+
+    static void LoadSettings(const enigma::core::YamlConfiguration& config);
+
+    /// Fill chunk from the cache. Returns false on a miss; the chunk is then left untouched.
+    static bool TryLoad(enigma::voxel::Chunk* chunk, int32_t chunkX, int32_t chunkY, uint32_t seed, uint64_t configHash);
+
+    /// Queue a freshly generated chunk for the cache
+    static void Store(enigma::voxel::Chunk* chunk, int32_t chunkX, int32_t chunkY, uint32_t seed, uint64_t configHash);
+
+    /// Append queued chunks and release the region files
+    static void Shutdown();
+
+    static bool                               IsEnabled() { return s_settings.enabled; }
+    static const GeneratedChunkCacheSettings& GetSettings() { return s_settings; }
+    static GeneratedChunkCacheStats           GetStats();
+
+private:
+    static void FlushAndEvict();
+
+    static GeneratedChunkCacheSettings s_settings;
+};
@@ -0,0 +1,752 @@
+/**
+ * @file RegionChunkStore.cpp
+ * @brief Append-only, memory-mapped region file chunk store implementation
+ * @date 2026-10-16
+ */
+
+#include "RegionChunkStore.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <shared_mutex>
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr uint32_t FILE_MAGIC          = 0x31524345; // "ECR1"
+    constexpr uint32_t FILE_VERSION        = 1;
+    constexpr uint32_t RECORD_MAGIC        = 0x43524345; // "ECRC"
+    constexpr size_t   FILE_HEADER_BYTES   = 16;
+    constexpr size_t   RECORD_HEADER_BYTES = 24;
+
+    struct IndexEntry
+    {
+        uint64_t offset = 0; // Record header offset, 0 = chunk not stored
+        uint32_t size   = 0; // Payload bytes
+        uint32_t tag    = 0;
+    };
+    static_assert(sizeof(IndexEntry) == 16, "IndexEntry is written to disk as-is");
+
+    struct RecordHeader
+    {
+        uint32_t magic    = RECORD_MAGIC;
+        int32_t  chunkX   = 0;
+        int32_t  chunkY   = 0;
+        uint32_t size     = 0;
+        uint32_t tag      = 0;
+        uint32_t checksum = 0; // FNV-1a of the payload, verified by Read()
+    };
+    static_assert(sizeof(RecordHeader) == RECORD_HEADER_BYTES, "RecordHeader is written to disk as-is");
+
+    int32_t FloorDiv(int32_t value, int32_t divisor)
+    {
+        const int32_t quotient = value / divisor;
+        return (value % divisor != 0 && (value < 0) != (divisor < 0)) ? quotient - 1 : quotient;
+    }
+
+    uint32_t Fnv1a(const uint8_t* data, size_t size)
+    {
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= data[i];
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    /// Minimal platform file: positional writes, sync and a read-only mapping of the whole file
+    class RegionFile
+    {
+    public:
+        RegionFile() = default;
+        ~RegionFile() { Close(); }
+
+        RegionFile(const RegionFile&)            = delete;
+        RegionFile& operator=(const RegionFile&) = delete;
+
+        bool Open(const std::filesystem::path& path)
+        {
+#ifdef _WIN32
+            m_file = CreateFileW(path.wstring().c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+            return m_file != INVALID_HANDLE_VALUE;
+#else
+            m_fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+            return m_fd >= 0;
+#endif
+        }
+
+        void Close()
+        {
+            Unmap();
+#ifdef _WIN32
+            if (m_file != INVALID_HANDLE_VALUE)
+            {
+                CloseHandle(m_file);
+                m_file = INVALID_HANDLE_VALUE;
+            }
+#else
+            if (m_fd >= 0)
+            {
+                ::close(m_fd);
+                m_fd = -1;
+            }
+#endif
+        }
+
+        uint64_t GetSize() const
+        {
+#ifdef _WIN32
+            LARGE_INTEGER size = {};
+            return GetFileSizeEx(m_file, &size) ? static_cast<uint64_t>(size.QuadPart) : 0;
+#else
+            struct stat info = {};
+            return fstat(m_fd, &info) == 0 ? static_cast<uint64_t>(info.st_size) : 0;
+#endif
+        }
+
+        bool WriteAt(uint64_t offset, const void* data, size_t size)
+        {
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+            while (size > 0)
+            {
+#ifdef _WIN32
+                OVERLAPPED overlapped = {};
+                overlapped.Offset     = static_cast<DWORD>(offset & 0xFFFFFFFFull);
+                overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+                DWORD       written   = 0;
+                const DWORD request   = static_cast<DWORD>(std::min<size_t>(size, 1u << 30));
+                if (!WriteFile(m_file, bytes, request, &written, &overlapped) || written == 0)
+                    return false;
+#else
+                const ssize_t written = ::pwrite(m_fd, bytes, size, static_cast<off_t>(offset));
+                if (written <= 0)
+                    return false;
+#endif
+                bytes += written;
+                offset += static_cast<uint64_t>(written);
+                size -= static_cast<size_t>(written);
+            }
+            return true;
+        }
+
+        bool Sync()
+        {
+#ifdef _WIN32
+            return FlushFileBuffers(m_file) != 0;
+#else
+            return ::fsync(m_fd) == 0;
+#endif
+        }
+
+        /// Map the file as it is now; later appends need another Remap() to become readable
+        bool Remap()
+        {
+            Unmap();
+            const uint64_t size = GetSize();
+            if (size == 0)
+                return false;
+#ifdef _WIN32
+            m_mapping = CreateFileMappingW(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (!m_mapping)
+                return false;
+            m_view = static_cast<const uint8_t*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+            if (!m_view)
+            {
+                CloseHandle(m_mapping);
+                m_mapping = nullptr;
+                return false;
+            }
+#else
+            void* view = ::mmap(nullptr, static_cast<size_t>(size), PROT_READ, MAP_SHARED, m_fd, 0);
+            if (view == MAP_FAILED)
+                return false;
+            m_view = static_cast<const uint8_t*>(view);
+#endif
+            m_viewSize = static_cast<size_t>(size);
+            return true;
+        }
+
+        void Unmap()
+        {
+            if (!m_view)
+                return;
+#ifdef _WIN32
+            UnmapViewOfFile(m_view);
+            CloseHandle(m_mapping);
+            m_mapping = nullptr;
+#else
+            ::munmap(const_cast<uint8_t*>(m_view), m_viewSize);
+#endif
+            m_view     = nullptr;
+            m_viewSize = 0;
+        }
+
+        const uint8_t* GetView() const { return m_view; }
+        size_t         GetViewSize() const { return m_viewSize; }
+
+    private:
+#ifdef _WIN32
+        HANDLE m_file    = INVALID_HANDLE_VALUE;
+        HANDLE m_mapping = nullptr;
+#else
+        int m_fd = -1;
+#endif
+        const uint8_t* m_view     = nullptr;
+        size_t         m_viewSize = 0;
+    };
+}
+
+// ------------------------------------------------------------------------------------------------
+struct RegionChunkStore::Region
+{
+    int32_t                             regionX = 0;
+    int32_t                             regionY = 0;
+    std::filesystem::path               path;
+    RegionFile                          file;
+    std::array<IndexEntry, INDEX_COUNT> index     = {};
+    uint64_t                            fileSize  = 0;
+    uint64_t                            liveBytes = 0; // Record headers + payloads referenced by the index
+    uint64_t                            lastUse   = 0;
+    std::shared_mutex                   mutex;      // Shared: reads through the mapping. Exclusive: index update, remap, compaction
+    std::mutex                          writeMutex; // Serializes appends and compaction
+
+    static size_t LocalIndex(int32_t chunkX, int32_t chunkY, int32_t regionX, int32_t regionY)
+    {
+        return static_cast<size_t>(chunkY - regionY * REGION_SIZE) * REGION_SIZE + static_cast<size_t>(chunkX - regionX * REGION_SIZE);
+    }
+
+    uint64_t GetDeadBytes() const
+    {
+        const uint64_t used = static_cast<uint64_t>(HEADER_BYTES) + liveBytes;
+        return fileSize > used ? fileSize - used : 0;
+    }
+
+    bool WriteEmptyHeader()
+    {
+        std::vector<uint8_t> header(HEADER_BYTES, 0);
+        const uint32_t       fields[4] = {FILE_MAGIC, FILE_VERSION, static_cast<uint32_t>(REGION_SIZE), 0};
+        std::memcpy(header.data(), fields, sizeof(fields));
+        index.fill(IndexEntry{});
+        liveBytes = 0;
+        fileSize  = HEADER_BYTES;
+        return file.WriteAt(0, header.data(), header.size()) && file.Sync() && file.Remap();
+    }
+
+    /// Load the index from an existing file; entries pointing past the end (torn writes) are dropped
+    bool LoadHeader()
+    {
+        fileSize = file.GetSize();
+        if (fileSize < HEADER_BYTES || !file.Remap())
+            return false;
+
+        uint32_t fields[4] = {};
+        std::memcpy(fields, file.GetView(), sizeof(fields));
+        if (fields[0] != FILE_MAGIC || fields[1] != FILE_VERSION || fields[2] != static_cast<uint32_t>(REGION_SIZE))
+            return false;
+
+        std::memcpy(index.data(), file.GetView() + FILE_HEADER_BYTES, INDEX_COUNT * sizeof(IndexEntry));
+        liveBytes = 0;
+        for (IndexEntry& entry : index)
+        {
+            if (entry.offset == 0)
+                continue;
+            if (entry.offset < HEADER_BYTES || entry.offset + RECORD_HEADER_BYTES + entry.size > fileSize)
+            {
+                entry = IndexEntry{};
+                continue;
+            }
+            liveBytes += RECORD_HEADER_BYTES + entry.size;
+        }
+        return true;
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+RegionChunkStore::RegionChunkStore(RegionChunkStoreConfig config)
+    : m_config(std::move(config))
+{
+    std::error_code ec;
+    std::filesystem::create_directories(m_config.directory, ec);
+    if (ec)
+    {
+        DebuggerPrintf("[RegionChunkStore] Cannot create %s: %s\n", m_config.directory.c_str(), ec.message().c_str());
+    }
+    m_config.maxOpenRegions = std::max<uint32_t>(m_config.maxOpenRegions, 1);
+}
+
+// ------------------------------------------------------------------------------------------------
+RegionChunkStore::~RegionChunkStore()
+{
+    Flush();
+}
+
+// ------------------------------------------------------------------------------------------------
+uint64_t RegionChunkStore::MakeKey(int32_t x, int32_t y)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+}
+
+// ------------------------------------------------------------------------------------------------
+std::shared_ptr<RegionChunkStore::Region> RegionChunkStore::AcquireRegion(int32_t regionX, int32_t regionY, bool createIfMissing)
+{
+    const uint64_t              key = MakeKey(regionX, regionY);
+    std::lock_guard<std::mutex> lock(m_regionsMutex);
+
+    auto found = m_regions.find(key);
+    if (found != m_regions.end())
+    {
+        found->second->lastUse = ++m_useClock;
+        return found->second;
+    }
+
+    auto region     = std::make_shared<Region>();
+    region->regionX = regionX;
+    region->regionY = regionY;
+    region->path    = std::filesystem::path(m_config.directory) / GetRegionFileName(regionX, regionY);
+
+    std::error_code ec;
+    const bool      exists = std::filesystem::exists(region->path, ec);
+    if (!exists && !createIfMissing)
+        return nullptr;
+
+    if (!region->file.Open(region->path))
+    {
+        DebuggerPrintf("[RegionChunkStore] Cannot open %s\n", region->path.string().c_str());
+        return nullptr;
+    }
+    m_regionOpens.fetch_add(1, std::memory_order_relaxed);
+
+    if (exists && !region->LoadHeader())
+    {
+        // Keep the damaged file for inspection and start the region over
+        DebuggerPrintf("[RegionChunkStore] %s is not a valid region file, moving it aside\n", region->path.string().c_str());
+        region->file.Close();
+        std::filesystem::path corruptPath = region->path;
+        corruptPath += ".corrupt";
+        std::filesystem::rename(region->path, corruptPath, ec);
+        if (!region->file.Open(region->path) || !region->WriteEmptyHeader())
+            return nullptr;
+    }
+    else if (!exists && !region->WriteEmptyHeader())
+    {
+        DebuggerPrintf("[RegionChunkStore] Cannot initialize %s\n", region->path.string().c_str());
+        return nullptr;
+    }
+
+    region->lastUse = ++m_useClock;
+    m_regions.emplace(key, region);
+
+    // Evict the least recently used regions nobody is reading from
+    while (m_regions.size() > m_config.maxOpenRegions)
+    {
+        auto victim = m_regions.end();
+        for (auto it = m_regions.begin(); it != m_regions.end(); ++it)
+        {
+            if (it->second.use_count() == 1 && (victim == m_regions.end() || it->second->lastUse < victim->second->lastUse))
+                victim = it;
+        }
+        if (victim == m_regions.end())
+            break;
+        m_regions.erase(victim);
+    }
+    return region;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool RegionChunkStore::Read(int32_t chunkX, int32_t chunkY, const ReadVisitor& visitor)
+{
+    m_reads.fetch_add(1, std::memory_order_relaxed);
+
+    // Queued writes win over the file; copy out so the visitor runs without holding the queue lock
+    {
+        PendingWrite pendingCopy;
+        bool         hasPending = false;
+        {
+            std::lock_guard<std::mutex> lock(m_pendingMutex);
+            auto                        found = m_pending.find(MakeKey(chunkX, chunkY));
+            if (found != m_pending.end())
+            {
+                pendingCopy = found->second;
+                hasPending  = true;
+            }
+        }
+        if (hasPending)
+        {
+            visitor(pendingCopy.payload.data(), pendingCopy.payload.size(), pendingCopy.tag);
+            return true;
+        }
+    }
+
+    const int32_t                 regionX = FloorDiv(chunkX, REGION_SIZE);
+    const int32_t                 regionY = FloorDiv(chunkY, REGION_SIZE);
+    const std::shared_ptr<Region> region  = AcquireRegion(regionX, regionY, false);
+    if (!region)
+    {
+        m_readMisses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    const size_t localIndex = Region::LocalIndex(chunkX, chunkY, regionX, regionY);
+    for (;;)
+    {
+        std::shared_lock<std::shared_mutex> readLock(region->mutex);
+        const IndexEntry                    entry = region->index[localIndex];
+        if (entry.offset == 0)
+        {
+            m_readMisses.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        const uint64_t recordEnd = entry.offset + RECORD_HEADER_BYTES + entry.size;
+        if (recordEnd > region->file.GetViewSize())
+        {
+            // Appended after the last mapping: remap once, then retry under the shared lock
+            readLock.unlock();
+            std::unique_lock<std::shared_mutex> writeLock(region->mutex);
+            if (recordEnd > region->file.GetViewSize() && !region->file.Remap())
+            {
+                DebuggerPrintf("[RegionChunkStore] Cannot map %s\n", region->path.string().c_str());
+                return false;
+            }
+            continue;
+        }
+
+        RecordHeader header;
+        std::memcpy(&header, region->file.GetView() + entry.offset, sizeof(header));
+        const uint8_t* payload = region->file.GetView() + entry.offset + RECORD_HEADER_BYTES;
+        if (header.magic != RECORD_MAGIC || header.chunkX != chunkX || header.chunkY != chunkY || header.size != entry.size)
+        {
+            DebuggerPrintf("[RegionChunkStore] Bad record for chunk (%d, %d) in %s\n", chunkX, chunkY, region->path.string().c_str());
+            m_readMisses.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        if (header.checksum != Fnv1a(payload, entry.size))
+        {
+            // Bit rot or a torn record the size checks cannot see; the caller regenerates the chunk
+            DebuggerPrintf("[RegionChunkStore] Checksum mismatch for chunk (%d, %d) in %s\n", chunkX, chunkY, region->path.string().c_str());
+            m_readMisses.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        visitor(payload, entry.size, entry.tag);
+        return true;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+bool RegionChunkStore::ReadCopy(int32_t chunkX, int32_t chunkY, std::vector<uint8_t>& outPayload, uint32_t* outTag)
+{
+    return Read(chunkX, chunkY, [&outPayload, outTag](const uint8_t* data, size_t size, uint32_t tag)
+    {
+        outPayload.assign(data, data + size);
+        if (outTag)
+            *outTag = tag;
+    });
+}
+
+// ------------------------------------------------------------------------------------------------
+bool RegionChunkStore::Contains(int32_t chunkX, int32_t chunkY)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        if (m_pending.count(MakeKey(chunkX, chunkY)) != 0)
+            return true;
+    }
+
+    const int32_t                 regionX = FloorDiv(chunkX, REGION_SIZE);
+    const int32_t                 regionY = FloorDiv(chunkY, REGION_SIZE);
+    const std::shared_ptr<Region> region  = AcquireRegion(regionX, regionY, false);
+    if (!region)
+        return false;
+
+    std::shared_lock<std::shared_mutex> readLock(region->mutex);
+    return region->index[Region::LocalIndex(chunkX, chunkY, regionX, regionY)].offset != 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+void RegionChunkStore::Write(int32_t chunkX, int32_t chunkY, std::vector<uint8_t> payload, uint32_t tag)
+{
+    m_writes.fetch_add(1, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(m_pendingMutex);
+    PendingWrite&               pending = m_pending[MakeKey(chunkX, chunkY)];
+    pending.payload                     = std::move(payload);
+    pending.tag                         = tag;
+    pending.sequence                    = ++m_writeSequence;
+}
+
+// ------------------------------------------------------------------------------------------------
+void RegionChunkStore::Flush()
+{
+    // Snapshot the queue; entries stay queued (and readable) until their index entries are live
+    std::map<uint64_t, std::vector<std::pair<uint64_t, PendingWrite>>> byRegion;
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        for (const auto& [chunkKey, pending] : m_pending)
+        {
+            const int32_t chunkX = static_cast<int32_t>(static_cast<uint32_t>(chunkKey >> 32));
+            const int32_t chunkY = static_cast<int32_t>(static_cast<uint32_t>(chunkKey));
+            byRegion[MakeKey(FloorDiv(chunkX, REGION_SIZE), FloorDiv(chunkY, REGION_SIZE))].emplace_back(chunkKey, pending);
+        }
+    }
+    if (byRegion.empty())
+        return;
+
+    for (auto& [regionKey, writes] : byRegion)
+    {
+        const int32_t                 regionX = static_cast<int32_t>(static_cast<uint32_t>(regionKey >> 32));
+        const int32_t                 regionY = static_cast<int32_t>(static_cast<uint32_t>(regionKey));
+        const std::shared_ptr<Region> region  = AcquireRegion(regionX, regionY, true);
+        if (!region)
+            continue;
+
+        std::lock_guard<std::mutex> appendLock(region->writeMutex);
+
+        // [STEP 1] Append every record in one contiguous write, then sync the data once
+        std::vector<uint8_t>                       block;
+        std::vector<std::pair<size_t, IndexEntry>> entries;
+        const uint64_t                             offset = region->fileSize;
+        for (const auto& [chunkKey, pending] : writes)
+        {
+            RecordHeader header;
+            header.chunkX   = static_cast<int32_t>(static_cast<uint32_t>(chunkKey >> 32));
+            header.chunkY   = static_cast<int32_t>(static_cast<uint32_t>(chunkKey));
+            header.size     = static_cast<uint32_t>(pending.payload.size());
+            header.tag      = pending.tag;
+            header.checksum = Fnv1a(pending.payload.data(), pending.payload.size());
+
+            const size_t start = block.size();
+            block.resize(start + RECORD_HEADER_BYTES + pending.payload.size());
+            std::memcpy(block.data() + start, &header, sizeof(header));
+            if (!pending.payload.empty())
+                std::memcpy(block.data() + start + RECORD_HEADER_BYTES, pending.payload.data(), pending.payload.size());
+
+            entries.emplace_back(Region::LocalIndex(header.chunkX, header.chunkY, regionX, regionY), IndexEntry{offset + start, header.size, header.tag});
+        }
+        if (!region->file.WriteAt(offset, block.data(), block.size()) || !region->file.Sync())
+        {
+            DebuggerPrintf("[RegionChunkStore] Append to %s failed, %zu chunks stay queued\n", region->path.string().c_str(), writes.size());
+            continue;
+        }
+        m_bytesAppended.fetch_add(block.size(), std::memory_order_relaxed);
+
+        // [STEP 2] Point the index at the new records, in memory and on disk
+        bool indexWritten = true;
+        {
+            std::unique_lock<std::shared_mutex> writeLock(region->mutex);
+            for (const auto& [localIndex, entry] : entries)
+            {
+                const IndexEntry& previous = region->index[localIndex];
+                if (previous.offset != 0)
+                    region->liveBytes -= RECORD_HEADER_BYTES + previous.size;
+                region->index[localIndex] = entry;
+                region->liveBytes += RECORD_HEADER_BYTES + entry.size;
+                if (!region->file.WriteAt(FILE_HEADER_BYTES + localIndex * sizeof(IndexEntry), &entry, sizeof(entry)))
+                    indexWritten = false;
+            }
+            region->fileSize = offset + block.size();
+        }
+
+        // [STEP 3] Sync the index; until it is durable the chunks stay queued and the next Flush appends them again
+        if (!indexWritten || !region->file.Sync())
+        {
+            DebuggerPrintf("[RegionChunkStore] Index update of %s failed, %zu chunks stay queued\n", region->path.string().c_str(), writes.size());
+            continue;
+        }
+
+        // [STEP 4] Drop the queued copies unless a newer write arrived meanwhile
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        for (const auto& [chunkKey, pending] : writes)
+        {
+            auto found = m_pending.find(chunkKey);
+            if (found != m_pending.end() && found->second.sequence == pending.sequence)
+                m_pending.erase(found);
+        }
+    }
+    m_flushes.fetch_add(1, std::memory_order_relaxed);
+}
+
+// ------------------------------------------------------------------------------------------------
+uint32_t RegionChunkStore::CompactIfNeeded()
+{
+    std::vector<std::shared_ptr<Region>> regions;
+    {
+        std::lock_guard<std::mutex> lock(m_regionsMutex);
+        regions.reserve(m_regions.size());
+        for (const auto& [key, region] : m_regions)
+            regions.push_back(region);
+    }
+
+    uint32_t compacted = 0;
+    for (const std::shared_ptr<Region>& region : regions)
+    {
+        std::lock_guard<std::mutex> appendLock(region->writeMutex);
+        const uint64_t              deadBytes = region->GetDeadBytes();
+        if (region->fileSize < m_config.compactionMinBytes || static_cast<double>(deadBytes) <= m_config.compactionDeadRatio * static_cast<double>(region->fileSize))
+            continue;
+        if (CompactRegion(*region))
+            ++compacted;
+    }
+    return compacted;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool RegionChunkStore::CompactRegion(Region& region)
+{
+    // Caller holds writeMutex, so the index and fileSize cannot change until we return. Readers keep
+    // going while the new file is built and synced; they are blocked for the close/rename/reopen only.
+    const uint64_t previousSize = region.fileSize;
+    if (region.file.GetViewSize() < previousSize)
+    {
+        std::unique_lock<std::shared_mutex> remapLock(region.mutex);
+        if (region.file.GetViewSize() < previousSize && !region.file.Remap())
+            return false;
+    }
+
+    std::filesystem::path tempPath = region.path;
+    tempPath += ".tmp";
+
+    // [STEP 1] Copy the live records out of the mapping
+    std::vector<uint8_t> contents(HEADER_BYTES, 0);
+    {
+        std::shared_lock<std::shared_mutex> readLock(region.mutex);
+
+        std::array<IndexEntry, INDEX_COUNT> newIndex  = {};
+        const uint32_t                      fields[4] = {FILE_MAGIC, FILE_VERSION, static_cast<uint32_t>(REGION_SIZE), 0};
+        std::memcpy(contents.data(), fields, sizeof(fields));
+        for (size_t i = 0; i < INDEX_COUNT; ++i)
+        {
+            const IndexEntry& entry = region.index[i];
+            if (entry.offset == 0)
+                continue;
+            const size_t recordBytes = RECORD_HEADER_BYTES + entry.size;
+            newIndex[i]              = IndexEntry{contents.size(), entry.size, entry.tag};
+            contents.insert(contents.end(), region.file.GetView() + entry.offset, region.file.GetView() + entry.offset + recordBytes);
+        }
+        std::memcpy(contents.data() + FILE_HEADER_BYTES, newIndex.data(), INDEX_COUNT * sizeof(IndexEntry));
+    }
+
+    // [STEP 2] Write and sync the new file without any region lock
+    {
+        std::error_code ec;
+        std::filesystem::remove(tempPath, ec);
+        RegionFile temp;
+        if (!temp.Open(tempPath) || !temp.WriteAt(0, contents.data(), contents.size()) || !temp.Sync())
+        {
+            DebuggerPrintf("[RegionChunkStore] Compaction of %s failed, keeping the original\n", region.path.string().c_str());
+            temp.Close();
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
+    }
+
+    // [STEP 3] Swap the files; Windows cannot replace a mapped or open file
+    std::unique_lock<std::shared_mutex> writeLock(region.mutex);
+    region.file.Close();
+    std::error_code ec;
+    std::filesystem::rename(tempPath, region.path, ec);
+    if (ec)
+    {
+        DebuggerPrintf("[RegionChunkStore] Cannot replace %s: %s\n", region.path.string().c_str(), ec.message().c_str());
+        std::filesystem::remove(tempPath, ec);
+    }
+
+    if (!region.file.Open(region.path) || !region.LoadHeader())
+    {
+        DebuggerPrintf("[RegionChunkStore] Cannot reopen %s after compaction\n", region.path.string().c_str());
+        region.index.fill(IndexEntry{});
+        region.liveBytes = 0;
+        return false;
+    }
+
+    if (previousSize > region.fileSize)
+        m_bytesReclaimed.fetch_add(previousSize - region.fileSize, std::memory_order_relaxed);
+    m_compactions.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool RegionChunkStore::EraseRegion(int32_t regionX, int32_t regionY)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        for (auto it = m_pending.begin(); it != m_pending.end();)
+        {
+            const int32_t chunkX = static_cast<int32_t>(static_cast<uint32_t>(it->first >> 32));
+            const int32_t chunkY = static_cast<int32_t>(static_cast<uint32_t>(it->first));
+            if (FloorDiv(chunkX, REGION_SIZE) == regionX && FloorDiv(chunkY, REGION_SIZE) == regionY)
+                it = m_pending.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    // Holding the map lock keeps AcquireRegion() from reopening the file until it is gone
+    std::lock_guard<std::mutex> lock(m_regionsMutex);
+    auto                        found = m_regions.find(MakeKey(regionX, regionY));
+    if (found != m_regions.end())
+    {
+        const std::shared_ptr<Region>       region = found->second;
+        std::lock_guard<std::mutex>         appendLock(region->writeMutex);
+        std::unique_lock<std::shared_mutex> writeLock(region->mutex);
+        region->file.Close();
+        region->index.fill(IndexEntry{});
+        region->liveBytes = 0;
+        region->fileSize  = 0;
+        m_regions.erase(found);
+    }
+
+    std::error_code ec;
+    std::filesystem::remove(std::filesystem::path(m_config.directory) / GetRegionFileName(regionX, regionY), ec);
+    return !ec;
+}
+
+// ------------------------------------------------------------------------------------------------
+int32_t RegionChunkStore::GetRegionCoord(int32_t chunkCoord)
+{
+    return FloorDiv(chunkCoord, REGION_SIZE);
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string RegionChunkStore::GetRegionFileName(int32_t regionX, int32_t regionY)
+{
+    return "r." + std::to_string(regionX) + "." + std::to_string(regionY) + ".ecr";
+}
+
+// ------------------------------------------------------------------------------------------------
+RegionChunkStoreStats RegionChunkStore::GetStats() const
+{
+    RegionChunkStoreStats stats;
+    stats.reads          = m_reads.load(std::memory_order_relaxed);
+    stats.readMisses     = m_readMisses.load(std::memory_order_relaxed);
+    stats.writes         = m_writes.load(std::memory_order_relaxed);
+    stats.flushes        = m_flushes.load(std::memory_order_relaxed);
+    stats.compactions    = m_compactions.load(std::memory_order_relaxed);
+    stats.regionOpens    = m_regionOpens.load(std::memory_order_relaxed);
+    stats.bytesAppended  = m_bytesAppended.load(std::memory_order_relaxed);
+    stats.bytesReclaimed = m_bytesReclaimed.load(std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(m_regionsMutex);
+        stats.openRegions = static_cast<uint32_t>(m_regions.size());
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        stats.pendingWrites = static_cast<uint32_t>(m_pending.size());
+    }
+    return stats;
+}
@@ -0,0 +1,135 @@
+/**
+ * @file RegionChunkStore.hpp
+ * @brief Append-only region files with an in-file chunk index, read through memory mapping
+ * @date 2026-10-16
+ *
+ * Layout of one region file (r.<regionX>.<regionY>.ecr, REGION_SIZE x REGION_SIZE chunks):
+ *
+ *   [Header]  magic 'ECR1', version, region size, reserved
+ *   [Index]   REGION_SIZE^2 entries {uint64 recordOffset, uint32 payloadSize, uint32 tag}, offset 0 = absent
+ *   [Records] appended {magic 'ECRC', chunkX, chunkY, payloadSize, tag, checksum} + payload
+ *
+ * Writes never overwrite a record: a rewritten chunk is appended and its index entry repointed, so a
+ * torn write can only lose the newest version. Writes are queued and Flush() appends every queued
+ * record, syncs once, then updates the index entries and syncs again, so the index never points at
+ * data that is not on disk. Superseded records are reclaimed by compaction, which rewrites the live
+ * records of a region into a fresh file once the dead share passes a threshold. Reads continue while
+ * the new file is built; they wait only for the file swap.
+ *
+ * Reads are served from a read-only mapping of the region file. Region files stay open in a small
+ * LRU, so worker threads load chunks without per-chunk open() calls. Read() hands the visitor a
+ * pointer straight into the mapping (zero-copy decode); the pointer is valid for the duration of the
+ * call only. A record whose payload does not match its FNV-1a checksum is reported as missing.
+ *
+ * The payload is opaque. The tag is stored next to it per chunk (the chunk codecs use it to record
+ * how a payload was encoded, so mixed files keep decoding).
+ *
+ * Scope: the only consumer is GeneratedChunkCache. World saves still go through the engine's chunk
+ * storage configured in config/engine/chunkstorage.yml, which exposes no backend hook to the game.
+ *
+ * Thread safety: all public functions may be called concurrently.
+ */
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct RegionChunkStoreConfig
+{
+    std::string directory;                               // Region files live directly in this folder
+    uint32_t    maxOpenRegions      = 16;                // Open file handles + mappings kept in the LRU
+    float       compactionDeadRatio = 0.5f;              // Compact when superseded records exceed this share of the file
+    uint64_t    compactionMinBytes  = 1024ull * 1024ull; // Smaller files are never compacted
+};
+
+struct RegionChunkStoreStats
+{
+    uint64_t reads          = 0;
+    uint64_t readMisses     = 0; // Chunk not present in the store
+    uint64_t writes         = 0;
+    uint64_t flushes        = 0;
+    uint64_t compactions    = 0;
+    uint64_t regionOpens    = 0; // File opens, the LRU keeps this far below reads
+    uint64_t bytesAppended  = 0;
+    uint64_t bytesReclaimed = 0;
+    uint32_t openRegions    = 0;
+    uint32_t pendingWrites  = 0;
+};
+
+class RegionChunkStore
+{
+public:
+    static constexpr int32_t REGION_SIZE  = 32;
+    static constexpr size_t  INDEX_COUNT  = static_cast<size_t>(REGION_SIZE) * REGION_SIZE;
+    static constexpr size_t  HEADER_BYTES = 16 + INDEX_COUNT * 16;
+
+    using ReadVisitor = std::function<void(const uint8_t* data, size_t size, uint32_t tag)>;
+
+    explicit RegionChunkStore(RegionChunkStoreConfig config);
+    ~RegionChunkStore();
+
+    RegionChunkStore(const RegionChunkStore&)            = delete;
+    RegionChunkStore& operator=(const RegionChunkStore&) = delete;
+
+    /// Zero-copy read. Returns false when the chunk is not stored; the visitor is then not called.
+    bool Read(int32_t chunkX, int32_t chunkY, const ReadVisitor& visitor);
+    bool ReadCopy(int32_t chunkX, int32_t chunkY, std::vector<uint8_t>& outPayload, uint32_t* outTag = nullptr);
+    bool Contains(int32_t chunkX, int32_t chunkY);
+
+    /// Queue a write; visible to Read() immediately, on disk after the next Flush()
+    void Write(int32_t chunkX, int32_t chunkY, std::vector<uint8_t> payload, uint32_t tag);
+
+    /// Append all queued writes with one data sync and one index sync per touched region
+    void Flush();
+
+    /// Compact every open region whose superseded share passes compactionDeadRatio. Returns regions compacted.
+    uint32_t CompactIfNeeded();
+
+    /// Drop a whole region: its queued writes, its open file and the file on disk. Returns false if the file could not be removed.
+    bool EraseRegion(int32_t regionX, int32_t regionY);
+
+    RegionChunkStoreStats GetStats() const;
+    const RegionChunkStoreConfig& GetConfig() const { return m_config; }
+
+    static int32_t     GetRegionCoord(int32_t chunkCoord);
+    static std::string GetRegionFileName(int32_t regionX, int32_t regionY);
+
+private:
+    struct Region;
+    struct PendingWrite
+    {
+        std::vector<uint8_t> payload;
+        uint32_t             tag      = 0;
+        uint64_t             sequence = 0; // Lets Flush() tell its snapshot from a newer write to the same chunk
+    };
+
+    static uint64_t MakeKey(int32_t x, int32_t y);
+    std::shared_ptr<Region> AcquireRegion(int32_t regionX, int32_t regionY, bool createIfMissing);
+    bool                    CompactRegion(Region& region);
+
+    RegionChunkStoreConfig m_config;
+
+    mutable std::mutex                                    m_regionsMutex;
+    std::unordered_map<uint64_t, std::shared_ptr<Region>> m_regions;
+    uint64_t                                              m_useClock = 0;
+
+    mutable std::mutex                         m_pendingMutex;
+    std::unordered_map<uint64_t, PendingWrite> m_pending; // Keyed by chunk
+    uint64_t                                   m_writeSequence = 0;
+
+    std::atomic<uint64_t> m_reads{0};
+    std::atomic<uint64_t> m_readMisses{0};
+    std::atomic<uint64_t> m_writes{0};
+    std::atomic<uint64_t> m_flushes{0};
+    std::atomic<uint64_t> m_compactions{0};
+    std::atomic<uint64_t> m_regionOpens{0};
+    std::atomic<uint64_t> m_bytesAppended{0};
+    std::atomic<uint64_t> m_bytesReclaimed{0};
+};
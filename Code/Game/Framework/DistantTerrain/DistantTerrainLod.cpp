@@ -0,0 +1,636 @@
+/**
+ * @file DistantTerrainLod.cpp
+ * @brief Distant terrain LOD region sampling and column meshing
+ * @date 2026-10-16
+ */
+
+#include "DistantTerrainLod.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Core/Yaml.hpp"
+#include "Engine/Graphic/Core/DX12/D3D12RenderSystem.hpp"
+#include "Engine/Voxel/Biome/Biome.hpp"
+#include "Engine/Voxel/Chunk/Chunk.hpp"
+#include "Game/Framework/RenderPass/RenderTerrain/PackedTerrainVertex.hpp"
+#include "Game/Framework/Scheduling/TaskScheduler.hpp"
+#include "Game/Framework/TerrainMeshing/GreedyTerrainMesher.hpp"
+#include "Game/Framework/TerrainMeshing/TerrainSectionMeshCache.hpp"
+#include "Game/Gameplay/Generator/SimpleMinerGenerator.hpp"
+
+using namespace enigma::core;
+using namespace enigma::graphic;
+using enigma::voxel::Chunk;
+
+DistantTerrainSettings                            DistantTerrainLod::s_settings;
+const SimpleMinerGenerator*                       DistantTerrainLod::s_generator = nullptr;
+std::unordered_map<int64_t, DistantTerrainRegion> DistantTerrainLod::s_regions;
+DistantTerrainStats                               DistantTerrainLod::s_stats;
+IntVec2                                           DistantTerrainLod::s_playerChunk;
+
+namespace
+{
+    constexpr float WALL_BRIGHTNESS = 0.8f;
+
+    const Rgba8 WATER_COLOR_SHALLOW(52, 96, 196);
+    const Rgba8 WATER_COLOR_DEEP(28, 52, 128);
+    const Rgba8 ICE_COLOR(150, 180, 235);
+    const Rgba8 DEFAULT_SURFACE_COLOR(104, 150, 70);
+
+    constexpr int32_t COLUMN_FACE_COUNT = static_cast<int32_t>(TerrainVertexFace::PosZ) + 1; // NegZ stays empty
+
+    /// Neighbour a wall faces; startIsLeft when the wall's lower coordinate is its left edge seen from outside
+    struct ColumnWallSide
+    {
+        int32_t           dx;
+        int32_t           dy;
+        TerrainVertexFace face;
+        bool              startIsLeft;
+    };
+
+    constexpr ColumnWallSide WALL_SIDES[4] = {
+        {1, 0, TerrainVertexFace::PosX, true},
+        {-1, 0, TerrainVertexFace::NegX, false},
+        {0, 1, TerrainVertexFace::PosY, false},
+        {0, -1, TerrainVertexFace::NegY, true},
+    };
+
+    struct CompletedSamples
+    {
+        int64_t                                      key = 0;
+        std::shared_ptr<const DistantTerrainColumns> columns;
+    };
+
+    std::mutex                    s_completedMutex;
+    std::vector<CompletedSamples> s_completed;
+    std::atomic<int32_t>          s_pendingSamples{0};
+    std::atomic<bool>             s_stopping{false};
+    bool                          s_hasPlayerChunk = false;
+
+    // Meshes of regions clear of the full-detail hole, by column content; regions with equal samples share one
+    std::unordered_map<TerrainContentKey, std::weak_ptr<const DistantTerrainMesh>, TerrainContentKeyHash> s_sharedMeshes;
+
+    int64_t GetRegionKey(const IntVec2& coords)
+    {
+        return (static_cast<int64_t>(coords.x) << 32) | static_cast<uint32_t>(coords.y);
+    }
+
+    int32_t FloorDiv(int32_t value, int32_t divisor)
+    {
+        return value >= 0 ? value / divisor : -((-value + divisor - 1) / divisor);
+    }
+
+    /// Everything BuildMesh() reads from the samples, border ring included
+    TerrainContentKey HashColumns(const DistantTerrainColumns& columns)
+    {
+        TerrainContentHasher hasher;
+        hasher.Add(static_cast<uint64_t>(static_cast<uint32_t>(columns.cellBlocks)) | static_cast<uint64_t>(static_cast<uint32_t>(columns.cells)) << 32);
+        for (size_t i = 0; i < columns.tops.size(); ++i)
+        {
+            const Rgba8& color = columns.colors[i];
+            hasher.Add(static_cast<uint64_t>(static_cast<uint16_t>(columns.tops[i])) | static_cast<uint64_t>(color.r) << 16 | static_cast<uint64_t>(color.g) << 24 |
+                       static_cast<uint64_t>(color.b) << 32 | static_cast<uint64_t>(color.a) << 40);
+        }
+        return hasher.Finish();
+    }
+
+    /// Surface color of a land column by biome name
+    Rgba8 GetBiomeSurfaceColor(const std::string& biomeName)
+    {
+        struct BiomeColor
+        {
+            const char* name;
+            Rgba8       color;
+        };
+        static const BiomeColor BIOME_COLORS[] = {
+            {"beach", Rgba8(219, 207, 163)}, {"snowy_beach", Rgba8(240, 248, 250)}, {"desert", Rgba8(214, 200, 150)},
+            {"savanna", Rgba8(150, 148, 72)}, {"plains", Rgba8(104, 160, 66)}, {"snowy_plains", Rgba8(240, 248, 250)},
+            {"forest", Rgba8(72, 118, 44)}, {"jungle", Rgba8(60, 138, 34)}, {"taiga", Rgba8(88, 122, 76)},
+            {"snowy_taiga", Rgba8(226, 236, 240)}, {"stony_peaks", Rgba8(128, 128, 128)}, {"snowy_peaks", Rgba8(244, 250, 252)},
+            {"frozen_ocean", ICE_COLOR},
+        };
+        for (const BiomeColor& entry : BIOME_COLORS)
+        {
+            if (biomeName == entry.name)
+                return entry.color;
+        }
+        return DEFAULT_SURFACE_COLOR;
+    }
+
+    Rgba8 ScaleColor(const Rgba8& color, float scale)
+    {
+        return Rgba8(static_cast<unsigned char>(color.r * scale), static_cast<unsigned char>(color.g * scale), static_cast<unsigned char>(color.b * scale), color.a);
+    }
+
+    /// Two triangles (0 1 2, 0 2 3), counter-clockwise seen from outside. The UV carries the face
+    /// instead of a texture coordinate; dh_terrain.vs.hlsl turns it back into the normal.
+    void AddColumnQuad(std::vector<Vertex_PCU>& vertices, const Vec3& p0, const Vec3& p1, const Vec3& p2, const Vec3& p3, const Rgba8& color, TerrainVertexFace face)
+    {
+        const Vec2 faceCoord(static_cast<float>(face), 0.0f);
+        const Vec3 corners[6] = {p0, p1, p2, p0, p2, p3};
+        for (const Vec3& corner : corners)
+        {
+            Vertex_PCU vertex;
+            vertex.m_position    = corner;
+            vertex.m_color       = color;
+            vertex.m_uvTexCoords = faceCoord;
+            vertices.push_back(vertex);
+        }
+    }
+
+    /// Merge key of a column top (height, RGBA), never 0
+    uint64_t MakeTopKey(int16_t top, const Rgba8& color)
+    {
+        return 1ull << 63 | static_cast<uint64_t>(static_cast<uint16_t>(top)) << 32 | static_cast<uint64_t>(color.r) << 24 |
+               static_cast<uint64_t>(color.g) << 16 | static_cast<uint64_t>(color.b) << 8 | static_cast<uint64_t>(color.a);
+    }
+
+    /// Merge key of a wall (top, bottom, surface RGB; LOD colors are opaque), never 0
+    uint64_t MakeWallKey(int16_t top, int16_t bottom, const Rgba8& color)
+    {
+        return 1ull << 63 | static_cast<uint64_t>(static_cast<uint16_t>(top)) << 40 | static_cast<uint64_t>(static_cast<uint16_t>(bottom)) << 24 |
+               static_cast<uint64_t>(color.r) << 16 | static_cast<uint64_t>(color.g) << 8 | static_cast<uint64_t>(color.b);
+    }
+
+    Rgba8 LerpColor(const Rgba8& a, const Rgba8& b, float t)
+    {
+        auto lerpChannel = [t](unsigned char from, unsigned char to)
+        {
+            return static_cast<unsigned char>(static_cast<float>(from) + (static_cast<float>(to) - static_cast<float>(from)) * t);
+        };
+        return Rgba8(lerpChannel(a.r, b.r), lerpChannel(a.g, b.g), lerpChannel(a.b, b.b), lerpChannel(a.a, b.a));
+    }
+
+    /// Runs on a scheduler worker; only uses the generator's thread-safe noise queries
+    std::shared_ptr<DistantTerrainColumns> SampleColumns(const SimpleMinerGenerator& generator, const IntVec2& coords, int32_t cellBlocks, int32_t regionChunks)
+    {
+        auto          columns      = std::make_shared<DistantTerrainColumns>();
+        const int32_t regionBlocks = regionChunks * Chunk::CHUNK_SIZE_X;
+        const int32_t originX      = coords.x * regionBlocks;
+        const int32_t originY      = coords.y * regionBlocks;
+        const int32_t seaLevel     = generator.GetSeaLevel();
+        columns->cellBlocks        = cellBlocks;
+        columns->cells             = regionBlocks / cellBlocks;
+        const size_t gridSize      = static_cast<size_t>(columns->cells + 2) * static_cast<size_t>(columns->cells + 2);
+        columns->tops.resize(gridSize, static_cast<int16_t>(seaLevel));
+        columns->colors.resize(gridSize, DEFAULT_SURFACE_COLOR);
+
+        for (int32_t cellY = -1; cellY <= columns->cells; ++cellY)
+        {
+            for (int32_t cellX = -1; cellX <= columns->cells; ++cellX)
+            {
+                if (s_stopping.load(std::memory_order_relaxed))
+                    return columns;
+
+                // Cell centre; border cells only feed the walls, so they skip the biome lookup
+                const int32_t globalX = originX + cellX * cellBlocks + cellBlocks / 2;
+                const int32_t globalY = originY + cellY * cellBlocks + cellBlocks / 2;
+                const int32_t ground  = generator.GetGroundHeightAt(globalX, globalY) + 1;
+                const int32_t index   = columns->GetIndex(cellX, cellY);
+                columns->tops[index]  = static_cast<int16_t>(std::max(ground, seaLevel));
+
+                const bool isBorder = cellX < 0 || cellY < 0 || cellX == columns->cells || cellY == columns->cells;
+                if (isBorder)
+                    continue;
+
+                const auto  biome     = generator.GetBiomeAt(globalX, globalY);
+                const Rgba8 landColor = biome ? GetBiomeSurfaceColor(biome->GetName()) : DEFAULT_SURFACE_COLOR;
+                if (ground < seaLevel)
+                {
+                    const bool  frozen     = biome && biome->GetName() == "frozen_ocean";
+                    const float depth      = std::min(static_cast<float>(seaLevel - ground) / 32.0f, 1.0f);
+                    columns->colors[index] = frozen ? ICE_COLOR : LerpColor(WATER_COLOR_SHALLOW, WATER_COLOR_DEEP, depth);
+                }
+                else
+                {
+                    columns->colors[index] = landColor;
+                }
+            }
+        }
+        return columns;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void DistantTerrainLod::LoadSettings(const YamlConfiguration& config)
+{
+    s_settings.enabled                = config.GetBoolean("distantTerrain.enabled", s_settings.enabled);
+    s_settings.renderDistance         = std::max(config.GetInt("distantTerrain.renderDistance", s_settings.renderDistance), 1);
+    s_settings.regionChunks           = std::clamp(config.GetInt("distantTerrain.regionChunks", s_settings.regionChunks), 1, 32);
+    s_settings.lod4xDistance          = std::max(config.GetInt("distantTerrain.lod4xDistance", s_settings.lod4xDistance), 0);
+    s_settings.lod8xDistance          = std::max(config.GetInt("distantTerrain.lod8xDistance", s_settings.lod8xDistance), s_settings.lod4xDistance);
+    s_settings.maxPendingSamples      = std::max(config.GetInt("distantTerrain.maxPendingSamples", s_settings.maxPendingSamples), 1);
+    s_settings.maxMeshBuildsPerUpdate = std::max(config.GetInt("distantTerrain.maxMeshBuildsPerUpdate", s_settings.maxMeshBuildsPerUpdate), 1);
+}
+
+// ------------------------------------------------------------------------------------------------
+float DistantTerrainLod::GetRenderDistanceBlocks()
+{
+    return s_settings.enabled ? static_cast<float>(s_settings.renderDistance * Chunk::CHUNK_SIZE_X) : 0.0f;
+}
+
+// ------------------------------------------------------------------------------------------------
+void DistantTerrainLod::Startup(const SimpleMinerGenerator* generator, int32_t simulationDistance)
+{
+    s_settings.simulationDistance = std::max(simulationDistance, 0);
+    s_generator                   = generator;
+    s_stopping                    = false;
+    s_hasPlayerChunk              = false;
+}
+
+// ------------------------------------------------------------------------------------------------
+void DistantTerrainLod::Shutdown()
+{
+    s_stopping = true;
+    while (s_pendingSamples.load() > 0)
+        std::this_thread::yield();
+
+    {
+        std::lock_guard<std::mutex> lock(s_completedMutex);
+        s_completed.clear();
+    }
+    s_regions.clear();
+    s_sharedMeshes.clear();
+    s_generator = nullptr;
+}
+
+// ------------------------------------------------------------------------------------------------
+void DistantTerrainLod::Update(const Vec3& playerPosition)
+{
+    if (!IsEnabled())
+        return;
+
+    // [STEP 1] Take the samples the workers finished; results for evicted regions or an old cell size are dropped
+    std::vector<CompletedSamples> completed;
+    {
+        std::lock_guard<std::mutex> lock(s_completedMutex);
+        completed.swap(s_completed);
+    }
+    for (CompletedSamples& result : completed)
+    {
+        auto it = s_regions.find(result.key);
+        if (it == s_regions.end())
+            continue;
+
+        DistantTerrainRegion& region = it->second;
+        region.sampling              = false;
+        s_stats.columnsSampled += static_cast<uint64_t>(result.columns->cells) * static_cast<uint64_t>(result.columns->cells);
+        if (result.columns->cellBlocks == region.cellBlocks)
+        {
+            region.columns   = std::move(result.columns);
+            region.meshDirty = true;
+        }
+    }
+
+    // [STEP 2] Regions in range, refreshed when the player changes chunk
+    const IntVec2 playerChunk(FloorDiv(static_cast<int32_t>(std::floor(playerPosition.x)), Chunk::CHUNK_SIZE_X),
+                              FloorDiv(static_cast<int32_t>(std::floor(playerPosition.y)), Chunk::CHUNK_SIZE_Y));
+    if (!s_hasPlayerChunk || playerChunk != s_playerChunk)
+    {
+        const IntVec2 previousChunk = s_playerChunk;
+        const bool    hadPrevious   = s_hasPlayerChunk;
+        s_playerChunk               = playerChunk;
+        s_hasPlayerChunk            = true;
+
+        const int32_t regionChunks = s_settings.regionChunks;
+        const int32_t simDistSq    = s_settings.simulationDistance * s_settings.simulationDistance;
+        const int32_t renderDistSq = s_settings.renderDistance * s_settings.renderDistance;
+
+        // Squared chunk distance from a chunk to the nearest and farthest chunk of a region
+        auto getDistances = [regionChunks](const IntVec2& coords, const IntVec2& chunk, int32_t& outNearSq, int32_t& outFarSq)
+        {
+            const int32_t minX  = coords.x * regionChunks;
+            const int32_t minY  = coords.y * regionChunks;
+            const int32_t maxX  = minX + regionChunks - 1;
+            const int32_t maxY  = minY + regionChunks - 1;
+            const int32_t nearX = std::max({minX - chunk.x, 0, chunk.x - maxX});
+            const int32_t nearY = std::max({minY - chunk.y, 0, chunk.y - maxY});
+            const int32_t farX  = std::max(std::abs(minX - chunk.x), std::abs(maxX - chunk.x));
+            const int32_t farY  = std::max(std::abs(minY - chunk.y), std::abs(maxY - chunk.y));
+            outNearSq           = nearX * nearX + nearY * nearY;
+            outFarSq            = farX * farX + farY * farY;
+        };
+
+        for (auto& entry : s_regions)
+            entry.second.cellBlocks = 0; // Not in range unless the scan below claims it
+
+        const IntVec2 minRegion(FloorDiv(playerChunk.x - s_settings.renderDistance, regionChunks), FloorDiv(playerChunk.y - s_settings.renderDistance, regionChunks));
+        const IntVec2 maxRegion(FloorDiv(playerChunk.x + s_settings.renderDistance, regionChunks), FloorDiv(playerChunk.y + s_settings.renderDistance, regionChunks));
+        for (int32_t regionY = minRegion.y; regionY <= maxRegion.y; ++regionY)
+        {
+            for (int32_t regionX = minRegion.x; regionX <= maxRegion.x; ++regionX)
+            {
+                const IntVec2 coords(regionX, regionY);
+                int32_t       nearSq = 0;
+                int32_t       farSq  = 0;
+                getDistances(coords, playerChunk, nearSq, farSq);
+                if (nearSq > renderDistSq || farSq <= simDistSq)
+                    continue; // Out of range, or entirely full-detail terrain
+
+                DistantTerrainRegion& region = s_regions[GetRegionKey(coords)];
+                region.coords                = coords;
+                region.cellBlocks            = GetCellBlocksForRegion(coords, playerChunk);
+
+                // The full-detail hole moved: re-cut regions it touches now or touched before
+                int32_t previousNearSq = 0;
+                int32_t previousFarSq  = 0;
+                if (hadPrevious)
+                    getDistances(coords, previousChunk, previousNearSq, previousFarSq);
+                if (region.columns && (nearSq <= simDistSq || (hadPrevious && previousNearSq <= simDistSq)))
+                    region.meshDirty = true;
+            }
+        }
+
+        for (auto it = s_regions.begin(); it != s_regions.end();)
+        {
+            if (it->second.cellBlocks == 0)
+                it = s_regions.erase(it);
+            else
+                ++it;
+        }
+        for (auto it = s_sharedMeshes.begin(); it != s_sharedMeshes.end();)
+        {
+            if (it->second.expired())
+                it = s_sharedMeshes.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    // [STEP 3] Sampling and meshing, nearest regions first
+    std::vector<std::pair<int32_t, DistantTerrainRegion*>> needSamples;
+    std::vector<std::pair<int32_t, DistantTerrainRegion*>> needMesh;
+    for (auto& entry : s_regions)
+    {
+        DistantTerrainRegion& region = entry.second;
+        const int32_t         dx     = region.coords.x * s_settings.regionChunks + s_settings.regionChunks / 2 - playerChunk.x;
+        const int32_t         dy     = region.coords.y * s_settings.regionChunks + s_settings.regionChunks / 2 - playerChunk.y;
+        const int32_t         distSq = dx * dx + dy * dy;
+        if (!region.sampling && (!region.columns || region.columns->cellBlocks != region.cellBlocks))
+            needSamples.emplace_back(distSq, &region);
+        if (region.meshDirty && region.columns)
+            needMesh.emplace_back(distSq, &region);
+    }
+
+    auto byDistance = [](const auto& a, const auto& b) { return a.first < b.first; };
+    std::sort(needSamples.begin(), needSamples.end(), byDistance);
+    std::sort(needMesh.begin(), needMesh.end(), byDistance);
+
+    for (auto& candidate : needSamples)
+    {
+        if (s_pendingSamples.load() >= s_settings.maxPendingSamples)
+            break;
+        RequestSamples(*candidate.second);
+    }
+
+    const size_t meshBuilds = std::min(needMesh.size(), static_cast<size_t>(s_settings.maxMeshBuildsPerUpdate));
+    for (size_t i = 0; i < meshBuilds; ++i)
+        BuildMesh(*needMesh[i].second);
+}
+
+// ------------------------------------------------------------------------------------------------
+DistantTerrainStats DistantTerrainLod::GetStats()
+{
+    DistantTerrainStats stats = s_stats;
+    stats.regions             = static_cast<uint32_t>(s_regions.size());
+    stats.pendingSamples      = static_cast<uint32_t>(std::max(s_pendingSamples.load(), 0));
+    stats.regionsWithMesh     = 0;
+    stats.uniqueMeshes        = 0;
+    stats.vertices            = 0;
+
+    // Shared meshes count once towards memory
+    std::vector<const DistantTerrainMesh*> meshes;
+    for (const auto& entry : s_regions)
+    {
+        if (!entry.second.mesh || entry.second.mesh->vertexCount == 0)
+            continue;
+        ++stats.regionsWithMesh;
+        meshes.push_back(entry.second.mesh.get());
+    }
+    std::sort(meshes.begin(), meshes.end());
+    meshes.erase(std::unique(meshes.begin(), meshes.end()), meshes.end());
+    for (const DistantTerrainMesh* mesh : meshes)
+        stats.vertices += mesh->vertexCount;
+    stats.uniqueMeshes = static_cast<uint32_t>(meshes.size());
+    stats.vertexBytes = stats.vertices * sizeof(Vertex_PCU);
+    return stats;
+}
+
+// ------------------------------------------------------------------------------------------------
+int32_t DistantTerrainLod::GetCellBlocksForRegion(const IntVec2& regionCoords, const IntVec2& playerChunk)
+{
+    const int32_t minX  = regionCoords.x * s_settings.regionChunks;
+    const int32_t minY  = regionCoords.y * s_settings.regionChunks;
+    const int32_t nearX = std::max({minX - playerChunk.x, 0, playerChunk.x - (minX + s_settings.regionChunks - 1)});
+    const int32_t nearY = std::max({minY - playerChunk.y, 0, playerChunk.y - (minY + s_settings.regionChunks - 1)});
+    const float   dist  = std::sqrt(static_cast<float>(nearX * nearX + nearY * nearY));
+    if (dist < static_cast<float>(s_settings.lod4xDistance))
+        return 2;
+    if (dist < static_cast<float>(s_settings.lod8xDistance))
+        return 4;
+    return 8;
+}
+
+// ------------------------------------------------------------------------------------------------
+void DistantTerrainLod::RequestSamples(DistantTerrainRegion& region)
+{
+    region.sampling = true;
+    s_pendingSamples.fetch_add(1);
+
+    const SimpleMinerGenerator* generator    = s_generator;
+    const IntVec2               coords       = region.coords;
+    const int32_t               cellBlocks   = region.cellBlocks;
+    const int32_t               regionChunks = s_settings.regionChunks;
+    TaskScheduler::Submit(TaskType::Generic, [generator, coords, cellBlocks, regionChunks]()
+    {
+        if (!s_stopping.load())
+        {
+            std::shared_ptr<DistantTerrainColumns> columns = SampleColumns(*generator, coords, cellBlocks, regionChunks);
+            std::lock_guard<std::mutex>            lock(s_completedMutex);
+            s_completed.push_back({GetRegionKey(coords), std::move(columns)});
+        }
+        s_pendingSamples.fetch_sub(1);
+    });
+}
+
+// ------------------------------------------------------------------------------------------------
+void DistantTerrainLod::BuildMesh(DistantTerrainRegion& region)
+{
+    region.meshDirty = false;
+
+    const DistantTerrainColumns& columns      = *region.columns;
+    const int32_t                cellBlocks   = columns.cellBlocks;
+    const int32_t                regionBlocks = s_settings.regionChunks * Chunk::CHUNK_SIZE_X;
+    const int32_t                simDistSq    = s_settings.simulationDistance * s_settings.simulationDistance;
+    const IntVec2                originChunk(region.coords.x * s_settings.regionChunks, region.coords.y * s_settings.regionChunks);
+
+    // Cells are at most 8 blocks, so each lies in exactly one chunk
+    auto isFullDetail = [&](int32_t cellX, int32_t cellY)
+    {
+        const int32_t dx = originChunk.x + FloorDiv(cellX * cellBlocks, Chunk::CHUNK_SIZE_X) - s_playerChunk.x;
+        const int32_t dy = originChunk.y + FloorDiv(cellY * cellBlocks, Chunk::CHUNK_SIZE_Y) - s_playerChunk.y;
+        return dx * dx + dy * dy <= simDistSq;
+    };
+
+    region.origin = Vec3(static_cast<float>(region.coords.x * regionBlocks), static_cast<float>(region.coords.y * regionBlocks), 0.0f);
+    auto setMesh  = [&region, regionBlocks](std::shared_ptr<const DistantTerrainMesh> mesh)
+    {
+        region.worldBounds = AABB3(region.origin + Vec3(0.0f, 0.0f, static_cast<float>(mesh->minZ)),
+                                   region.origin + Vec3(static_cast<float>(regionBlocks), static_cast<float>(regionBlocks), static_cast<float>(mesh->maxZ)));
+        region.mesh        = std::move(mesh);
+    };
+
+    // [STEP 1] Regions clear of the full-detail hole (border ring included) reuse the mesh of a region
+    // with identical samples; vertices are region-local, so only the model matrix differs
+    bool touchesHole = false;
+    for (int32_t cellY = -1; cellY <= columns.cells && !touchesHole; ++cellY)
+    {
+        for (int32_t cellX = -1; cellX <= columns.cells && !touchesHole; ++cellX)
+            touchesHole = isFullDetail(cellX, cellY);
+    }
+
+    TerrainContentKey contentKey;
+    if (!touchesHole)
+    {
+        contentKey = HashColumns(columns);
+        auto found = s_sharedMeshes.find(contentKey);
+        if (found != s_sharedMeshes.end())
+        {
+            if (std::shared_ptr<const DistantTerrainMesh> shared = found->second.lock())
+            {
+                setMesh(std::move(shared));
+                ++s_stats.meshReuses;
+                return;
+            }
+        }
+    }
+    ++s_stats.meshBuilds;
+
+    // [STEP 2] Column tops; neighbouring cells with the same height and color merge into one quad
+    const int32_t                cells = columns.cells;
+    std::vector<uint64_t>        mask(static_cast<size_t>(cells) * static_cast<size_t>(cells), 0);
+    std::vector<TerrainMaskRect> rects;
+    for (int32_t cellY = 0; cellY < cells; ++cellY)
+    {
+        for (int32_t cellX = 0; cellX < cells; ++cellX)
+        {
+            if (isFullDetail(cellX, cellY))
+                continue;
+            const int32_t index         = columns.GetIndex(cellX, cellY);
+            mask[cellX + cellY * cells] = MakeTopKey(columns.tops[index], columns.colors[index]);
+        }
+    }
+    GreedyTerrainMesher::MergeMask(mask, cells, cells, cells, rects);
+
+    std::vector<Vertex_PCU> faceVertices[COLUMN_FACE_COUNT];
+    faceVertices[static_cast<int32_t>(TerrainVertexFace::PosZ)].reserve(rects.size() * 6);
+    int32_t minZ = INT32_MAX;
+    int32_t maxZ = INT32_MIN;
+    for (const TerrainMaskRect& rect : rects)
+    {
+        const int16_t top   = static_cast<int16_t>(rect.key >> 32 & 0xFFFF);
+        const float   z     = static_cast<float>(top);
+        const float   x0    = static_cast<float>(rect.u * cellBlocks);
+        const float   y0    = static_cast<float>(rect.v * cellBlocks);
+        const float   x1    = static_cast<float>((rect.u + rect.width) * cellBlocks);
+        const float   y1    = static_cast<float>((rect.v + rect.height) * cellBlocks);
+        const Rgba8   color = Rgba8(static_cast<unsigned char>(rect.key >> 24), static_cast<unsigned char>(rect.key >> 16),
+                                    static_cast<unsigned char>(rect.key >> 8), static_cast<unsigned char>(rect.key));
+        AddColumnQuad(faceVertices[static_cast<int32_t>(TerrainVertexFace::PosZ)], Vec3(x0, y0, z), Vec3(x1, y0, z), Vec3(x1, y1, z), Vec3(x0, y1, z), color, TerrainVertexFace::PosZ);
+        minZ = std::min(minZ, static_cast<int32_t>(top));
+        maxZ = std::max(maxZ, static_cast<int32_t>(top));
+    }
+
+    // [STEP 3] Walls down to lower neighbours, merged along each row of cells; neighbours inside the
+    // full-detail hole are covered by real chunks
+    for (const ColumnWallSide& side : WALL_SIDES)
+    {
+        for (int32_t line = 0; line < cells; ++line)
+        {
+            // Cells along the wall: Y for the X-facing walls, X for the Y-facing ones
+            for (int32_t along = 0; along < cells; ++along)
+            {
+                const int32_t cellX = side.dx != 0 ? line : along;
+                const int32_t cellY = side.dx != 0 ? along : line;
+                if (isFullDetail(cellX, cellY) || isFullDetail(cellX + side.dx, cellY + side.dy))
+                    continue;
+
+                const int32_t index       = columns.GetIndex(cellX, cellY);
+                const int16_t top         = columns.tops[index];
+                const int16_t neighborTop = columns.tops[columns.GetIndex(cellX + side.dx, cellY + side.dy)];
+                if (neighborTop < top)
+                    mask[along] = MakeWallKey(top, neighborTop, columns.colors[index]);
+            }
+
+            rects.clear();
+            GreedyTerrainMesher::MergeMask(mask, cells, 1, cells, rects);
+
+            const float plane = static_cast<float>((line + (side.dx + side.dy > 0 ? 1 : 0)) * cellBlocks);
+            auto        point = [&side, plane](float along, float z)
+            {
+                return side.dx != 0 ? Vec3(plane, along, z) : Vec3(along, plane, z);
+            };
+            for (const TerrainMaskRect& rect : rects)
+            {
+                const int16_t top    = static_cast<int16_t>(rect.key >> 40 & 0xFFFF);
+                const int16_t bottom = static_cast<int16_t>(rect.key >> 24 & 0xFFFF);
+                const Rgba8   color  = Rgba8(static_cast<unsigned char>(rect.key >> 16), static_cast<unsigned char>(rect.key >> 8), static_cast<unsigned char>(rect.key));
+                const float   start  = static_cast<float>(rect.u * cellBlocks);
+                const float   end    = static_cast<float>((rect.u + rect.width) * cellBlocks);
+                const float   left   = side.startIsLeft ? start : end; // Bottom edge, left to right seen from outside
+                const float   right  = side.startIsLeft ? end : start;
+                AddColumnQuad(faceVertices[static_cast<int32_t>(side.face)],
+                              point(left, static_cast<float>(bottom)), point(right, static_cast<float>(bottom)),
+                              point(right, static_cast<float>(top)), point(left, static_cast<float>(top)),
+                              ScaleColor(color, WALL_BRIGHTNESS), side.face);
+                minZ = std::min(minZ, static_cast<int32_t>(bottom));
+            }
+        }
+    }
+
+    // [STEP 4] Upload one buffer per face direction, replacing the previous mesh
+    auto mesh  = std::make_shared<DistantTerrainMesh>();
+    mesh->minZ = minZ;
+    mesh->maxZ = maxZ;
+    for (int32_t face = 0; face < COLUMN_FACE_COUNT; ++face)
+    {
+        const std::vector<Vertex_PCU>& vertices = faceVertices[face];
+        if (vertices.empty())
+            continue;
+
+        DistantTerrainFaceMesh faceMesh;
+        faceMesh.bucket.direction = static_cast<uint8_t>(face);
+        faceMesh.bucket.quadCount = static_cast<uint32_t>(vertices.size() / 6);
+        faceMesh.bucket.bounds    = AABB3(vertices.front().m_position, vertices.front().m_position);
+        AABB3& bounds             = faceMesh.bucket.bounds;
+        for (const Vertex_PCU& vertex : vertices)
+        {
+            bounds.m_mins.x = std::min(bounds.m_mins.x, vertex.m_position.x);
+            bounds.m_mins.y = std::min(bounds.m_mins.y, vertex.m_position.y);
+            bounds.m_mins.z = std::min(bounds.m_mins.z, vertex.m_position.z);
+            bounds.m_maxs.x = std::max(bounds.m_maxs.x, vertex.m_position.x);
+            bounds.m_maxs.y = std::max(bounds.m_maxs.y, vertex.m_position.y);
+            bounds.m_maxs.z = std::max(bounds.m_maxs.z, vertex.m_position.z);
+        }
+        faceMesh.vertexCount  = static_cast<uint32_t>(vertices.size());
+        faceMesh.vertexBuffer = D3D12RenderSystem::CreateVertexBuffer(vertices.size() * sizeof(Vertex_PCU), sizeof(Vertex_PCU), vertices.data(), "DistantTerrainRegion");
+        mesh->vertexCount += faceMesh.vertexCount;
+        mesh->faceMeshes.push_back(std::move(faceMesh));
+    }
+    if (mesh->vertexCount == 0)
+    {
+        region.mesh.reset();
+        return;
+    }
+
+    if (!touchesHole)
+        s_sharedMeshes[contentKey] = mesh;
+    setMesh(std::move(mesh));
+}
@@ -0,0 +1,173 @@
+/**
+ * @file DistantTerrainLod.hpp
+ * @brief Low-detail terrain regions between the simulation distance and the LOD render distance
+ * @date 2026-10-16
+ *
+ * Full-detail chunks end at video.simulationDistance. Beyond that, the world is drawn from LOD regions
+ * (regionChunks x regionChunks chunks each) that never generate blocks: a Generic scheduler task samples
+ * SimpleMinerGenerator::GetGroundHeightAt / GetBiomeAt once per LOD cell and the main thread turns the
+ * samples into column meshes (a flat top per cell plus walls down to lower neighbours). Tops of equal height
+ * and color, and walls along a row with the same span, are merged into single quads with
+ * GreedyTerrainMesher::MergeMask(), so flat land and ocean cost a few quads per region instead of one per cell.
+ *
+ * Column vertices are Vertex_PCU, 24 bytes instead of the 60-byte Vertex_PCUTBN: the meshes are untextured,
+ * so the UV slot carries the quad's TerrainVertexFace (as in PackedTerrainVertex) and dh_terrain.vs.hlsl
+ * rebuilds the normal from it.
+ *
+ * Cell size grows with distance from the player:
+ *   - 2 blocks per cell up to lod4xDistance chunks
+ *   - 4 blocks per cell up to lod8xDistance chunks
+ *   - 8 blocks per cell out to renderDistance chunks
+ *
+ * Chunks inside the simulation distance are cut out of the LOD meshes so they never overlap full-detail
+ * terrain; regions touching that hole are re-meshed from their cached samples when the player changes
+ * chunk. LOD regions live in their own storage, separate from the chunk render regions, and
+ * DistantTerrainRenderPass culls them against the same frustum as the chunk batches. Each region mesh is
+ * split by face direction (tops and the four wall directions) into one vertex buffer per direction, so the
+ * pass also skips the directions that face away from the camera (TerrainFaceBuckets::IsFrontFacing).
+ *
+ * Oceans and flat land sample to identical columns in many regions. A region clear of the full-detail
+ * hole is keyed by a TerrainContentHasher hash of its samples (the same 128-bit hash that keys
+ * TerrainSectionMeshCache); when a live mesh has that key the region shares its buffers instead of
+ * meshing and uploading a copy.
+ *
+ * Every face direction of a unique mesh is its own immutable vertex buffer. The chunk region arena in
+ * ChunkRenderRegionStorage only takes the engine's chunk geometry, and DrawVertexBuffer() draws whole
+ * buffers with no vertex range, so LOD meshes can be suballocated neither from that arena nor from a
+ * game-side one. Sharing identical meshes is what bounds the buffer count: one per distinct region mesh
+ * and direction, which for ocean and flat land is a handful for the whole ring.
+ *
+ * Threading: Startup/Update/Shutdown and the region accessors run on the main thread; only the column
+ * sampling runs on workers. Shutdown() waits for in-flight sampling, call it before the world (which
+ * owns the generator) is destroyed.
+ *
+ * Configuration Path: Run/.enigma/settings.yml -> distantTerrain
+ */
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/Yaml.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/IntVec2.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Game/Framework/TerrainMeshing/TerrainFaceBuckets.hpp"
+
+class SimpleMinerGenerator;
+
+namespace enigma::graphic
+{
+    class D12VertexBuffer;
+}
+
+struct DistantTerrainSettings
+{
+    bool    enabled                = false;
+    int32_t renderDistance         = 32; // Chunks; also extends the player camera far plane, and with it every far-dependent term
+    int32_t simulationDistance     = 8;  // Chunks of full-detail terrain cut out of the LOD meshes, the world's activation range
+    int32_t regionChunks           = 8;  // Chunks per LOD region side
+    int32_t lod4xDistance          = 16; // Chunks from the player where cells grow from 2 to 4 blocks
+    int32_t lod8xDistance          = 24; // Chunks from the player where cells grow from 4 to 8 blocks
+    int32_t maxPendingSamples      = 4;  // Regions sampled on workers at once
+    int32_t maxMeshBuildsPerUpdate = 4;  // Region meshes built and uploaded per frame
+};
+
+/// Ground samples of one LOD region at one cell size, with a one-cell border for the walls
+struct DistantTerrainColumns
+{
+    int32_t              cellBlocks = 2;
+    int32_t              cells      = 0;  // Per region side, the grids are (cells + 2)^2
+    std::vector<int16_t> tops;            // Top of the column (exclusive z), water surface where the ground is below sea level
+    std::vector<Rgba8>   colors;          // Surface color from the biome
+
+    int32_t GetIndex(int32_t cellX, int32_t cellY) const { return (cellX + 1) + (cellY + 1) * (cells + 2); }
+};
+
+/// Quads of one face direction of a region, drawn or skipped as a whole (TerrainFaceBuckets::IsFrontFacing)
+struct DistantTerrainFaceMesh
+{
+    TerrainFaceBucket                                 bucket; // Direction, quad count and region-local bounds
+    std::shared_ptr<enigma::graphic::D12VertexBuffer> vertexBuffer;
+    uint32_t                                          vertexCount = 0;
+};
+
+/// GPU mesh of one region in region-local space; regions with identical samples share one
+struct DistantTerrainMesh
+{
+    std::vector<DistantTerrainFaceMesh> faceMeshes; // Tops and the four wall directions, empty ones left out
+    uint32_t                            vertexCount = 0;
+    int32_t                             minZ        = 0;
+    int32_t                             maxZ        = 0;
+};
+
+struct DistantTerrainRegion
+{
+    IntVec2 coords;           // Region coordinates, chunk = coords * regionChunks
+    int32_t cellBlocks = 0;   // Cell size the region should have at the player's current position
+    bool    sampling   = false;
+    bool    meshDirty  = false;
+
+    std::shared_ptr<const DistantTerrainColumns> columns;
+    std::shared_ptr<const DistantTerrainMesh>    mesh; // Null when every cell is in the full-detail hole
+    AABB3                                        worldBounds;
+    Vec3                                         origin; // World position of the region's vertex space
+};
+
+struct DistantTerrainStats
+{
+    uint32_t regions         = 0;
+    uint32_t regionsWithMesh = 0;
+    uint32_t uniqueMeshes    = 0; // Meshes behind regionsWithMesh; the rest share another region's buffers
+    uint32_t pendingSamples  = 0;
+    uint64_t vertices        = 0; // Unique meshes only
+    uint64_t vertexBytes     = 0;
+    uint64_t columnsSampled  = 0; // Total since startup
+    uint64_t meshBuilds      = 0; // Total since startup
+    uint64_t meshReuses      = 0; // Total since startup, region meshes taken from a region with identical samples
+    uint32_t drawnRegions    = 0; // Last frame, set by DistantTerrainRenderPass
+    uint32_t culledRegions   = 0;
+    uint32_t drawnFaceMeshes = 0;
+    uint32_t backFaceMeshes  = 0; // Face meshes of drawn regions skipped as facing away from the camera
+};
+
+class DistantTerrainLod
+{
+public:
+    DistantTerrainLod()                                    = delete; // Prevent instantiation
+    DistantTerrainLod(const DistantTerrainLod&)            = delete; // Prevent copy
+    DistantTerrainLod& operator=(const DistantTerrainLod&) = delete; // Prevent assignment
+
+    static void                          LoadSettings(const enigma::core::YamlConfiguration& config);
+    static const DistantTerrainSettings& GetSettings() { return s_settings; }
+    static bool                          IsEnabled() { return s_settings.enabled && s_generator != nullptr; }
+
+    /// LOD render distance in blocks, 0 when disabled
+    static float GetRenderDistanceBlocks();
+
+    /// The generator must outlive the LOD regions, see Shutdown()
+    static void Startup(const SimpleMinerGenerator* generator, int32_t simulationDistance);
+    static void Shutdown();
+
+    /// Schedules sampling for regions that entered range or changed cell size, builds finished meshes
+    static void Update(const Vec3& playerPosition);
+
+    static const std::unordered_map<int64_t, DistantTerrainRegion>& GetRegions() { return s_regions; }
+    static DistantTerrainStats&                                     MutableStats() { return s_stats; }
+    static DistantTerrainStats                                      GetStats();
+
+private:
+    static int32_t GetCellBlocksForRegion(const IntVec2& regionCoords, const IntVec2& playerChunk);
+    static void    RequestSamples(DistantTerrainRegion& region);
+    static void    BuildMesh(DistantTerrainRegion& region);
+
+private:
+    static DistantTerrainSettings                            s_settings;
+    static const SimpleMinerGenerator*                       s_generator;
+    static std::unordered_map<int64_t, DistantTerrainRegion> s_regions;
+    static DistantTerrainStats                               s_stats;
+    static IntVec2                                           s_playerChunk;
+};
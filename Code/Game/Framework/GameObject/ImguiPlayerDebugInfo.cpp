@@ -23,4 +23,13 @@ void ImguiPlayerDebugInfo::ShowWindow(bool* pOpen)
     {
         ImGui::Text("Player Camera Rotation: <invalid>");
     }
+    if (player)
+    {
+        const PlayerNeighborhoodStats& stats = player->GetNeighborhood().GetStats();
+        ImGui::Text("Eye Brightness: block %d sky %d | smooth %d / %d", COMMON_UNIFORM.eyeBrightnessX, COMMON_UNIFORM.eyeBrightnessY,
+                    COMMON_UNIFORM.eyeBrightnessSmoothX, COMMON_UNIFORM.eyeBrightnessSmoothY);
+        ImGui::Text("Neighborhood: %llu pinned / %llu fallback lookups | %llu repins, %llu summaries",
+                    static_cast<unsigned long long>(stats.pinnedLookups), static_cast<unsigned long long>(stats.fallbackLookups),
+                    static_cast<unsigned long long>(stats.repins), static_cast<unsigned long long>(stats.summaryBuilds));
+    }
 }
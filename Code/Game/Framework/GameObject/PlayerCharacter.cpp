@@ -1,5 +1,7 @@
 #include "PlayerCharacter.hpp"
 
+#include <cmath>
+
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Graphic/Camera/PerspectiveCamera.hpp"
 #include "Engine/Graphic/Integration/RendererSubsystem.hpp"
@@ -106,20 +108,31 @@ void PlayerCharacter::UpdateCamera(float deltaSeconds)
 
 void PlayerCharacter::UpdatePlayerStatus(float deltaSeconds)
 {
-    UNUSED(deltaSeconds)
     auto world = g_theGame->GetWorld();
     if (world)
     {
-        enigma::voxel::BlockState* blockState = world->GetBlockState(enigma::voxel::BlockPos((int32_t)m_position.x, (int32_t)m_position.y, (int32_t)m_position.z));
-        if (blockState && !blockState->GetFluidState().IsEmpty())
-        {
-            // [REFACTOR] Use global COMMON_UNIFORM instead of m_playerStatusUniform
-            COMMON_UNIFORM.isEyeInWater = 1;
-        }
-        else
-        {
-            COMMON_UNIFORM.isEyeInWater = 0;
-        }
+        m_neighborhood.Update(*world, m_position);
+
+        const int32_t eyeX = static_cast<int32_t>(std::floor(m_position.x));
+        const int32_t eyeY = static_cast<int32_t>(std::floor(m_position.y));
+        const int32_t eyeZ = static_cast<int32_t>(std::floor(m_position.z));
+
+        // [REFACTOR] Use global COMMON_UNIFORM instead of m_playerStatusUniform
+        COMMON_UNIFORM.isEyeInWater = m_neighborhood.IsFluid(eyeX, eyeY, eyeZ) ? 1 : 0;
+
+        // eyeBrightness: x = block light * 16, y = sky light * 16
+        const LightSample light       = m_neighborhood.SampleLight(eyeX, eyeY, eyeZ);
+        COMMON_UNIFORM.eyeBrightnessX = light.blockLight * 16;
+        COMMON_UNIFORM.eyeBrightnessY = light.skyLight * 16;
+
+        // eyeBrightnessSmooth: exponential approach with a configurable half-life, snaps on the first frame
+        const Vec2  eyeBrightness = Vec2(static_cast<float>(COMMON_UNIFORM.eyeBrightnessX), static_cast<float>(COMMON_UNIFORM.eyeBrightnessY));
+        const float halfLife      = PlayerNeighborhoodCache::GetSettings().eyeBrightnessHalfLife;
+        const float blend         = (m_hasEyeBrightnessSmooth && halfLife > 0.0f) ? 1.0f - std::exp2(-deltaSeconds / halfLife) : 1.0f;
+        m_eyeBrightnessSmooth += (eyeBrightness - m_eyeBrightnessSmooth) * blend;
+        m_hasEyeBrightnessSmooth            = true;
+        COMMON_UNIFORM.eyeBrightnessSmoothX = static_cast<int>(std::lround(m_eyeBrightnessSmooth.x));
+        COMMON_UNIFORM.eyeBrightnessSmoothY = static_cast<int>(std::lround(m_eyeBrightnessSmooth.y));
     }
     // [REFACTOR] COMMON_UNIFORM is uploaded in RenderPass, not here
     // The upload happens in the appropriate RenderPass that needs this data
@@ -1,6 +1,8 @@
 #pragma once
 #include "GameObject.hpp"
+#include "Engine/Math/Vec2.hpp"
 #include "Game/Framework/Camera/PlayerCameraRig.hpp"
+#include "Game/Framework/WorldQuery/PlayerNeighborhoodCache.hpp"
 
 class PlayerCharacter : public GameObject
 {
@@ -18,6 +20,10 @@ public:
     enigma::graphic::PerspectiveCamera* GetDebugCamera() const;
     void                                SyncDebugCameraToGameplayCamera();
 
+    /// Block, fluid and light queries around the player, valid after Update()
+    PlayerNeighborhoodCache&       GetNeighborhood() { return m_neighborhood; }
+    const PlayerNeighborhoodCache& GetNeighborhood() const { return m_neighborhood; }
+
 private:
     void HandleInputAction(float deltaSeconds);
     void UpdateCamera(float deltaSeconds);
@@ -26,4 +32,7 @@ private:
 
 private:
     std::unique_ptr<PlayerCameraRig> m_cameraRig = nullptr;
+    PlayerNeighborhoodCache          m_neighborhood;
+    Vec2                             m_eyeBrightnessSmooth    = Vec2(0.0f, 240.0f); // Block, sky; matches the uniform defaults
+    bool                             m_hasEyeBrightnessSmooth = false;
 };
@@ -2,6 +2,7 @@
 
 #include "Engine/Core/Clock.hpp"
 #include "Game/GameCommon.hpp"
+#include "Game/Framework/ChunkStore/GeneratedChunkCache.hpp"
 #include "Game/Framework/GameObject/ImguiPlayerDebugInfo.hpp"
 #include "Game/Gameplay/Game.hpp"
 #include "ThirdParty/imgui/imgui.h"
@@ -107,6 +108,17 @@ void ImguiLeftDebugOverlay::ShowWindow(bool* pOpen)
         ImGui::Text("FPS: %.1f (%.2f ms) | Max: %.1f", s_displayFPS, s_displayMs, s_maxFrameReached);
         ImGui::Text("Avg 1/5/10s: %.1f / %.1f / %.1f", s_displayAvg1s, s_displayAvg5s, s_displayAvg10s);
 
+        if (GeneratedChunkCache::IsEnabled())
+        {
+            const GeneratedChunkCacheStats cacheStats = GeneratedChunkCache::GetStats();
+            const uint64_t                 lookups    = cacheStats.hits + cacheStats.misses;
+            ImGui::Text("Gen Cache: %.1f%% hit (%llu/%llu) | %.1f / %.0f MB",
+                        lookups > 0 ? 100.0 * static_cast<double>(cacheStats.hits) / static_cast<double>(lookups) : 0.0,
+                        static_cast<unsigned long long>(cacheStats.hits), static_cast<unsigned long long>(lookups),
+                        static_cast<double>(cacheStats.diskBytes) / (1024.0 * 1024.0),
+                        static_cast<double>(GeneratedChunkCache::GetSettings().maxBytes) / (1024.0 * 1024.0));
+        }
+
         ImGui::Separator();
         ImGui::Text("Debugger Overlay");
         ImGui::Separator();
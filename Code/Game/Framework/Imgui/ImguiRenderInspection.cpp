@@ -7,6 +7,8 @@
 
 #include "Game/GameCommon.hpp"
 #include "Game/Framework/RenderInspection/ImguiQueueDiagnosticsPanel.hpp"
+#include "Game/Framework/RenderInspection/ImguiRenderGraphPanel.hpp"
+#include "Game/Framework/RenderInspection/ImguiRenderPassTimingPanel.hpp"
 #include "Game/Framework/RenderPass/RenderChunkBaching/ImguiSettingChunkBatching.hpp"
 #include "Game/Gameplay/Game.hpp"
 #include "ThirdParty/imgui/imgui.h"
@@ -73,6 +75,40 @@ namespace
         ImGui::TextDisabled("Right-click inside this tab to copy chunk batching JSON snapshots.");
         ImguiSettingChunkBatching::Show(world);
     }
+
+    void ShowRenderGraphTab()
+    {
+        const SceneRenderGraph* graph = g_theGame ? g_theGame->GetSceneRenderGraph() : nullptr;
+
+        if (ImGui::BeginPopupContextWindow("RenderGraphContextMenu"))
+        {
+            if (ImGui::MenuItem("Copy Render Graph JSON", nullptr, false, graph != nullptr))
+            {
+                ImguiRenderGraphPanel::CopyJsonToClipboard(*graph);
+            }
+
+            ImGui::EndPopup();
+        }
+
+        ImGui::TextDisabled("Right-click inside this tab to copy the compiled render graph JSON.");
+        ImguiRenderGraphPanel::Show(graph);
+    }
+
+    void ShowPassTimingTab()
+    {
+        if (ImGui::BeginPopupContextWindow("PassTimingContextMenu"))
+        {
+            if (ImGui::MenuItem("Copy Pass Timing JSON"))
+            {
+                ImguiRenderPassTimingPanel::CopyJsonToClipboard();
+            }
+
+            ImGui::EndPopup();
+        }
+
+        ImGui::TextDisabled("Right-click inside this tab to copy per-pass CPU timing JSON.");
+        ImguiRenderPassTimingPanel::Show();
+    }
 }
 
 void ImguiRenderInspection::ShowWindow(bool* pOpen)
@@ -97,6 +133,18 @@ void ImguiRenderInspection::ShowWindow(bool* pOpen)
             ImGui::EndTabItem();
         }
 
+        if (ImGui::BeginTabItem("Render Graph"))
+        {
+            ShowRenderGraphTab();
+            ImGui::EndTabItem();
+        }
+
+        if (ImGui::BeginTabItem("Pass Timing"))
+        {
+            ShowPassTimingTab();
+            ImGui::EndTabItem();
+        }
+
         ImGui::EndTabBar();
     }
 
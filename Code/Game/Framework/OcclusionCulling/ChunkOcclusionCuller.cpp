@@ -0,0 +1,330 @@
+/**
+ * @file ChunkOcclusionCuller.cpp
+ * @brief Occluder boxes per chunk cell and per-frame region occlusion tests
+ * @date 2026-10-16
+ */
+
+#include "ChunkOcclusionCuller.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+#include "SoftwareOcclusionBuffer.hpp"
+#include "Engine/Core/Yaml.hpp"
+#include "Engine/Graphic/Camera/PerspectiveCamera.hpp"
+#include "Engine/Math/Frustum.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Voxel/Chunk/Chunk.hpp"
+#include "Engine/Voxel/Chunk/ChunkRenderRegionStorage.hpp"
+#include "Engine/Voxel/World/World.hpp"
+#include "Game/Framework/TerrainMeshing/GreedyTerrainMesher.hpp"
+#include "Game/Framework/WorldQuery/ChunkChangeNotifier.hpp"
+
+using namespace enigma::core;
+using enigma::voxel::BlockState;
+using enigma::voxel::Chunk;
+
+ChunkOcclusionSettings ChunkOcclusionCuller::s_settings;
+ChunkOcclusionStats    ChunkOcclusionCuller::s_stats;
+bool                   ChunkOcclusionCuller::s_hasView = false;
+
+namespace
+{
+    constexpr int32_t MAX_BOXES_PER_CELL = 2;
+
+    struct ChunkOccluders
+    {
+        Chunk*             chunk = nullptr; // Chunk the boxes were built from
+        bool               valid = false;
+        std::vector<AABB3> boxes;
+    };
+
+    struct BuildCandidate
+    {
+        int32_t chunkX     = 0;
+        int32_t chunkY     = 0;
+        int32_t distanceSq = 0;
+    };
+
+    struct Occluder
+    {
+        const AABB3* box        = nullptr;
+        float        distanceSq = 0.0f;
+    };
+
+    uint64_t s_seenSerial = 0; // ChunkChangeNotifier cursor
+
+    SoftwareOcclusionBuffer                     s_buffer;
+    std::unordered_map<int64_t, ChunkOccluders> s_chunks;
+    std::unordered_map<const BlockState*, bool> s_opaqueStates;
+
+    int64_t GetChunkKey(int32_t chunkX, int32_t chunkY)
+    {
+        return (static_cast<int64_t>(chunkX) << 32) | static_cast<uint32_t>(chunkY);
+    }
+
+    /// Floor division, so negative block coordinates map to the chunk below zero
+    int32_t FloorDiv(int32_t value, int32_t divisor)
+    {
+        const int32_t quotient = value / divisor;
+        return (value % divisor != 0 && (value < 0) != (divisor < 0)) ? quotient - 1 : quotient;
+    }
+
+    bool IsOpaqueCube(BlockState* state)
+    {
+        if (!state)
+            return false;
+
+        auto it = s_opaqueStates.find(state);
+        if (it != s_opaqueStates.end())
+            return it->second;
+
+        const bool opaque = GreedyTerrainMesher::ClassifyBlock(state->GetBlock()->GetRegistryName()) == TerrainMeshCellClass::OpaqueCube;
+        s_opaqueStates.emplace(state, opaque);
+        return opaque;
+    }
+
+    void BuildOccluders(Chunk& chunk, int32_t chunkX, int32_t chunkY, int32_t cellBlocks, int32_t minHeight, std::vector<AABB3>& outBoxes)
+    {
+        outBoxes.clear();
+        for (int32_t cellY = 0; cellY < Chunk::CHUNK_SIZE_Y; cellY += cellBlocks)
+        {
+            for (int32_t cellX = 0; cellX < Chunk::CHUNK_SIZE_X; cellX += cellBlocks)
+            {
+                // [STEP 1] Longest runs of z levels where every column of the cell is an opaque cube
+                struct Run
+                {
+                    int32_t start  = 0;
+                    int32_t length = 0;
+                };
+                Run     best[MAX_BOXES_PER_CELL];
+                int32_t runStart = -1;
+                for (int32_t z = 0; z <= Chunk::CHUNK_SIZE_Z; ++z)
+                {
+                    bool solid = z < Chunk::CHUNK_SIZE_Z;
+                    for (int32_t y = cellY; solid && y < cellY + cellBlocks; ++y)
+                    {
+                        for (int32_t x = cellX; solid && x < cellX + cellBlocks; ++x)
+                            solid = IsOpaqueCube(chunk.GetBlock(x, y, z));
+                    }
+
+                    if (solid && runStart < 0)
+                        runStart = z;
+                    if (solid || runStart < 0)
+                        continue;
+
+                    const Run run{runStart, z - runStart};
+                    runStart = -1;
+                    if (run.length < minHeight)
+                        continue;
+                    if (run.length > best[0].length)
+                    {
+                        best[1] = best[0];
+                        best[0] = run;
+                    }
+                    else if (run.length > best[1].length)
+                    {
+                        best[1] = run;
+                    }
+                }
+
+                // [STEP 2] One box per run, in world space
+                const float worldX = static_cast<float>(chunkX * Chunk::CHUNK_SIZE_X + cellX);
+                const float worldY = static_cast<float>(chunkY * Chunk::CHUNK_SIZE_Y + cellY);
+                const float size   = static_cast<float>(cellBlocks);
+                for (const Run& run : best)
+                {
+                    if (run.length == 0)
+                        continue;
+                    outBoxes.emplace_back(Vec3(worldX, worldY, static_cast<float>(run.start)),
+                                          Vec3(worldX + size, worldY + size, static_cast<float>(run.start + run.length)));
+                }
+            }
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void ChunkOcclusionCuller::LoadSettings(const YamlConfiguration& config)
+{
+    s_settings.enabled                   = config.GetBoolean("occlusionCulling.enabled", s_settings.enabled);
+    s_settings.bufferWidth               = config.GetInt("occlusionCulling.bufferWidth", s_settings.bufferWidth);
+    s_settings.bufferHeight              = config.GetInt("occlusionCulling.bufferHeight", s_settings.bufferHeight);
+    s_settings.occluderDistance          = config.GetInt("occlusionCulling.occluderDistance", s_settings.occluderDistance);
+    s_settings.occluderCellBlocks        = config.GetInt("occlusionCulling.occluderCellBlocks", s_settings.occluderCellBlocks);
+    s_settings.minOccluderHeight         = config.GetInt("occlusionCulling.minOccluderHeight", s_settings.minOccluderHeight);
+    s_settings.maxOccluders              = config.GetInt("occlusionCulling.maxOccluders", s_settings.maxOccluders);
+    s_settings.maxOccluderBuildsPerFrame = config.GetInt("occlusionCulling.maxOccluderBuildsPerFrame", s_settings.maxOccluderBuildsPerFrame);
+
+    s_settings.bufferWidth               = std::clamp(s_settings.bufferWidth, 16, 1024);
+    s_settings.bufferHeight              = std::clamp(s_settings.bufferHeight, 8, 512);
+    s_settings.occluderDistance          = std::max(s_settings.occluderDistance, 1);
+    s_settings.minOccluderHeight         = std::max(s_settings.minOccluderHeight, 1);
+    s_settings.maxOccluders              = std::max(s_settings.maxOccluders, 0);
+    s_settings.maxOccluderBuildsPerFrame = std::max(s_settings.maxOccluderBuildsPerFrame, 1);
+    if (s_settings.occluderCellBlocks <= 0 || Chunk::CHUNK_SIZE_X % s_settings.occluderCellBlocks != 0 || Chunk::CHUNK_SIZE_Y % s_settings.occluderCellBlocks != 0)
+    {
+        s_settings.occluderCellBlocks = Chunk::CHUNK_SIZE_X;
+    }
+    s_buffer.Resize(s_settings.bufferWidth, s_settings.bufferHeight);
+}
+
+// ------------------------------------------------------------------------------------------------
+void ChunkOcclusionCuller::Update(enigma::voxel::World& world, const enigma::graphic::PerspectiveCamera* cullingCamera)
+{
+    using Clock = std::chrono::steady_clock;
+
+    s_hasView                   = false;
+    s_stats.rasterizedOccluders = 0;
+    s_stats.rasterizedTriangles = 0;
+    s_stats.testedRegions       = 0;
+    s_stats.occludedRegions     = 0;
+    if (!s_settings.enabled || !cullingCamera)
+        return;
+
+    // [STEP 1] Invalidate chunks reported as changed since the last frame; falling behind the ring drops every chunk's boxes
+    const bool complete = ChunkChangeNotifier::Consume(s_seenSerial, [](int32_t chunkX, int32_t chunkY)
+    {
+        auto it = s_chunks.find(GetChunkKey(chunkX, chunkY));
+        if (it != s_chunks.end())
+            it->second.valid = false;
+    });
+    if (!complete)
+    {
+        for (auto& entry : s_chunks)
+            entry.second.valid = false;
+    }
+
+    // [STEP 2] Track the chunks in occluder range, rebuild the nearest stale ones within the budget
+    const Vec3    cameraPosition = cullingCamera->GetPosition();
+    const int32_t centerX        = FloorDiv(static_cast<int32_t>(std::floor(cameraPosition.x)), Chunk::CHUNK_SIZE_X);
+    const int32_t centerY        = FloorDiv(static_cast<int32_t>(std::floor(cameraPosition.y)), Chunk::CHUNK_SIZE_Y);
+    const int32_t range          = s_settings.occluderDistance;
+
+    std::vector<BuildCandidate> candidates;
+    for (auto it = s_chunks.begin(); it != s_chunks.end();)
+    {
+        const int32_t chunkX = static_cast<int32_t>(it->first >> 32);
+        const int32_t chunkY = static_cast<int32_t>(static_cast<uint32_t>(it->first));
+        if (std::abs(chunkX - centerX) > range || std::abs(chunkY - centerY) > range)
+            it = s_chunks.erase(it);
+        else
+            ++it;
+    }
+    for (int32_t chunkY = centerY - range; chunkY <= centerY + range; ++chunkY)
+    {
+        for (int32_t chunkX = centerX - range; chunkX <= centerX + range; ++chunkX)
+        {
+            Chunk* chunk = world.GetChunk(chunkX, chunkY);
+            if (!chunk || !chunk->IsGenerated())
+            {
+                s_chunks.erase(GetChunkKey(chunkX, chunkY));
+                continue;
+            }
+
+            ChunkOccluders& occluders = s_chunks[GetChunkKey(chunkX, chunkY)];
+            if (occluders.chunk != chunk || !occluders.valid)
+            {
+                occluders.chunk = chunk;
+                occluders.valid = false;
+                occluders.boxes.clear();
+                const int32_t dx = chunkX - centerX;
+                const int32_t dy = chunkY - centerY;
+                candidates.push_back({chunkX, chunkY, dx * dx + dy * dy});
+            }
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end(), [](const BuildCandidate& a, const BuildCandidate& b)
+    {
+        return a.distanceSq < b.distanceSq;
+    });
+    const size_t builds = std::min(candidates.size(), static_cast<size_t>(s_settings.maxOccluderBuildsPerFrame));
+    for (size_t i = 0; i < builds; ++i)
+    {
+        const BuildCandidate& candidate = candidates[i];
+        ChunkOccluders&       occluders = s_chunks[GetChunkKey(candidate.chunkX, candidate.chunkY)];
+        BuildOccluders(*occluders.chunk, candidate.chunkX, candidate.chunkY, s_settings.occluderCellBlocks, s_settings.minOccluderHeight, occluders.boxes);
+        occluders.valid = true;
+        ++s_stats.occluderBuilds;
+    }
+
+    // [STEP 3] Render the nearest frustum-visible boxes
+    const auto rasterStart = Clock::now();
+
+    Frustum    frustum;
+    const bool hasFrustum = cullingCamera->GetFrustum(frustum);
+
+    SoftwareOcclusionView view;
+    cullingCamera->GetOrientation().GetAsVectors_IFwd_JLeft_KUp(view.forward, view.left, view.up);
+    view.position    = cameraPosition;
+    view.tanHalfFovY = static_cast<float>(std::tan(ConvertDegreesToRadians(cullingCamera->GetFOV() * 0.5f)));
+    view.aspect      = cullingCamera->GetAspectRatio();
+    view.nearPlane   = cullingCamera->GetNearPlane();
+    s_buffer.Clear(view);
+
+    std::vector<Occluder> occluders;
+    s_stats.occluderChunks = 0;
+    s_stats.occluderBoxes  = 0;
+    for (const auto& entry : s_chunks)
+    {
+        if (!entry.second.valid)
+            continue;
+
+        ++s_stats.occluderChunks;
+        for (const AABB3& box : entry.second.boxes)
+        {
+            ++s_stats.occluderBoxes;
+            if (hasFrustum && !frustum.IsOverlapping(box))
+                continue;
+            const Vec3 toCenter = (box.m_mins + box.m_maxs) * 0.5f - cameraPosition;
+            occluders.push_back({&box, toCenter.x * toCenter.x + toCenter.y * toCenter.y + toCenter.z * toCenter.z});
+        }
+    }
+
+    const size_t rasterized = std::min(occluders.size(), static_cast<size_t>(s_settings.maxOccluders));
+    std::partial_sort(occluders.begin(), occluders.begin() + rasterized, occluders.end(), [](const Occluder& a, const Occluder& b)
+    {
+        return a.distanceSq < b.distanceSq;
+    });
+    for (size_t i = 0; i < rasterized; ++i)
+        s_buffer.RasterizeOccluder(*occluders[i].box);
+
+    s_hasView                   = true;
+    s_stats.rasterizedOccluders = static_cast<uint32_t>(rasterized);
+    s_stats.rasterizedTriangles = s_buffer.GetRasterizedTriangles();
+    s_stats.rasterMs            = std::chrono::duration<double, std::milli>(Clock::now() - rasterStart).count();
+
+    // [STEP 4] Count the frustum-visible regions the buffer hides
+    const auto testStart = Clock::now();
+    for (const auto& regionEntry : world.GetChunkRenderRegionStorage().GetRegions())
+    {
+        const auto& region = regionEntry.second;
+        if (!region.HasValidBatchGeometry())
+            continue;
+        if (hasFrustum && !frustum.IsOverlapping(region.geometry.worldBounds))
+            continue;
+
+        ++s_stats.testedRegions;
+        if (!s_buffer.IsVisible(region.geometry.worldBounds))
+            ++s_stats.occludedRegions;
+    }
+    s_stats.testMs = std::chrono::duration<double, std::milli>(Clock::now() - testStart).count();
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ChunkOcclusionCuller::IsOccluded(const AABB3& bounds)
+{
+    return s_hasView && !s_buffer.IsVisible(bounds);
+}
+
+// ------------------------------------------------------------------------------------------------
+void ChunkOcclusionCuller::Shutdown()
+{
+    s_hasView = false;
+    s_chunks.clear();
+    s_opaqueStates.clear();
+}
@@ -0,0 +1,93 @@
+/**
+ * @file ChunkOcclusionCuller.hpp
+ * @brief Per-frame software occlusion culling of chunk render regions
+ * @date 2026-10-16
+ *
+ * Region visibility is otherwise frustum-only. Underground, in valleys or facing a mountain most
+ * frustum-visible regions are hidden behind solid terrain. Each frame Update() renders the occluder
+ * boxes of the chunks around the culling camera into a SoftwareOcclusionBuffer, then IsOccluded()
+ * tests region bounds against it.
+ *
+ * Occluders: every chunk is split into cells of occluderCellBlocks x occluderCellBlocks columns. A z
+ * level is solid for a cell when all of its columns hold an opaque full cube there; the two longest
+ * runs of solid levels (at least minOccluderHeight tall) become the cell's occluder boxes. Boxes are
+ * built on the main thread within a per-frame budget and rebuilt when ChunkChangeNotifier reports an
+ * edit or the chunk pointer changes (unloaded and reloaded). A chunk without boxes simply occludes
+ * nothing, so missing or pending data never hides anything.
+ *
+ * Consumers: the region debug colors, the culling map and the Frame Stats count of occluded regions,
+ * the dirty rebuild budget (occluded dirty regions count as culled) and DistantTerrainRenderPass, which
+ * skips LOD regions hidden behind near terrain. ChunkBatchCollector is engine code with no per-region
+ * filter, so draws submitted through ChunkBatchRenderer::Submit() are not occlusion culled.
+ *
+ * Threading: Update() runs on the main thread before the pass chain; IsOccluded() only reads the buffer.
+ *
+ * Configuration Path: Run/.enigma/settings.yml -> occlusionCulling
+ */
+
+#pragma once
+#include <cstdint>
+
+#include "Engine/Core/Yaml.hpp"
+#include "Engine/Math/AABB3.hpp"
+
+namespace enigma::graphic
+{
+    class PerspectiveCamera;
+}
+
+namespace enigma::voxel
+{
+    class World;
+}
+
+struct ChunkOcclusionSettings
+{
+    bool    enabled                   = false;
+    int32_t bufferWidth               = 256;
+    int32_t bufferHeight              = 128;
+    int32_t occluderDistance          = 6;   // Chunks around the camera whose occluder boxes are rendered
+    int32_t occluderCellBlocks        = 8;   // Columns per occluder cell side, divides the chunk size
+    int32_t minOccluderHeight         = 4;   // Blocks; thinner solid runs are not worth the triangles
+    int32_t maxOccluders              = 512; // Nearest boxes rasterized per frame
+    int32_t maxOccluderBuildsPerFrame = 4;   // Chunks scanned for occluder boxes per frame
+};
+
+struct ChunkOcclusionStats
+{
+    uint32_t occluderChunks      = 0; // Chunks with up-to-date occluder boxes
+    uint32_t occluderBoxes       = 0; // Boxes of those chunks
+    uint32_t rasterizedOccluders = 0; // Last frame
+    uint32_t rasterizedTriangles = 0;
+    uint32_t testedRegions       = 0; // Frustum-visible regions with geometry, last frame
+    uint32_t occludedRegions     = 0;
+    uint64_t occluderBuilds      = 0; // Total since startup
+    double   rasterMs            = 0.0;
+    double   testMs              = 0.0;
+};
+
+class ChunkOcclusionCuller
+{
+public:
+    ChunkOcclusionCuller()                                       = delete; // Prevent instantiation
+    ChunkOcclusionCuller(const ChunkOcclusionCuller&)            = delete; // Prevent copy
+    ChunkOcclusionCuller& operator=(const ChunkOcclusionCuller&) = delete; // Prevent assignment
+
+    static void                       LoadSettings(const enigma::core::YamlConfiguration& config);
+    static ChunkOcclusionSettings&    GetSettings() { return s_settings; }
+    static const ChunkOcclusionStats& GetStats() { return s_stats; }
+
+    /// Refreshes occluder boxes, renders them from the culling camera and counts occluded regions
+    static void Update(enigma::voxel::World& world, const enigma::graphic::PerspectiveCamera* cullingCamera);
+
+    /// True when this frame's occluders hide the whole box; false when disabled or not updated
+    static bool IsOccluded(const AABB3& bounds);
+
+    /// Drops all occluder boxes, call before the world is destroyed
+    static void Shutdown();
+
+private:
+    static ChunkOcclusionSettings s_settings;
+    static ChunkOcclusionStats    s_stats;
+    static bool                   s_hasView;
+};
@@ -0,0 +1,275 @@
+/**
+ * @file SoftwareOcclusionBuffer.cpp
+ * @brief SSE occluder rasterizer and AABB visibility test
+ * @date 2026-10-16
+ */
+
+#include "SoftwareOcclusionBuffer.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <xmmintrin.h>
+
+namespace
+{
+    constexpr int32_t MAX_CLIPPED_VERTICES = 8;
+
+    float Dot(const Vec3& a, const Vec3& b)
+    {
+        return a.x * b.x + a.y * b.y + a.z * b.z;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+SoftwareOcclusionBuffer::SoftwareOcclusionBuffer(int32_t width, int32_t height)
+{
+    Resize(width, height);
+}
+
+// ------------------------------------------------------------------------------------------------
+void SoftwareOcclusionBuffer::Resize(int32_t width, int32_t height)
+{
+    m_width  = (std::max(width, 4) + 3) & ~3;
+    m_height = std::max(height, 1);
+    m_depth.assign(static_cast<size_t>(m_width) * m_height, FLT_MAX);
+}
+
+// ------------------------------------------------------------------------------------------------
+void SoftwareOcclusionBuffer::Clear(const SoftwareOcclusionView& view)
+{
+    m_view                = view;
+    m_view.nearPlane      = std::max(view.nearPlane, 0.001f);
+    m_tanHalfFovX         = view.tanHalfFovY * view.aspect;
+    m_rasterizedTriangles = 0;
+    std::fill(m_depth.begin(), m_depth.end(), FLT_MAX);
+}
+
+// ------------------------------------------------------------------------------------------------
+void SoftwareOcclusionBuffer::RasterizeOccluder(const AABB3& box)
+{
+    const Vec3& mins     = box.m_mins;
+    const Vec3& maxs     = box.m_maxs;
+    const Vec3& position = m_view.position;
+
+    // Only the faces the camera is in front of can be seen; a camera inside the box sees none
+    Vec3 quad[4];
+    if (position.x < mins.x || position.x > maxs.x)
+    {
+        const float x = position.x < mins.x ? mins.x : maxs.x;
+        quad[0]       = Vec3(x, mins.y, mins.z);
+        quad[1]       = Vec3(x, maxs.y, mins.z);
+        quad[2]       = Vec3(x, maxs.y, maxs.z);
+        quad[3]       = Vec3(x, mins.y, maxs.z);
+        RasterizeQuad(quad);
+    }
+    if (position.y < mins.y || position.y > maxs.y)
+    {
+        const float y = position.y < mins.y ? mins.y : maxs.y;
+        quad[0]       = Vec3(mins.x, y, mins.z);
+        quad[1]       = Vec3(maxs.x, y, mins.z);
+        quad[2]       = Vec3(maxs.x, y, maxs.z);
+        quad[3]       = Vec3(mins.x, y, maxs.z);
+        RasterizeQuad(quad);
+    }
+    if (position.z < mins.z || position.z > maxs.z)
+    {
+        const float z = position.z < mins.z ? mins.z : maxs.z;
+        quad[0]       = Vec3(mins.x, mins.y, z);
+        quad[1]       = Vec3(maxs.x, mins.y, z);
+        quad[2]       = Vec3(maxs.x, maxs.y, z);
+        quad[3]       = Vec3(mins.x, maxs.y, z);
+        RasterizeQuad(quad);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+bool SoftwareOcclusionBuffer::IsVisible(const AABB3& box) const
+{
+    if (m_depth.empty())
+        return true;
+
+    // [STEP 1] Screen rectangle and nearest depth of the eight corners
+    float minX     = FLT_MAX;
+    float minY     = FLT_MAX;
+    float maxX     = -FLT_MAX;
+    float maxY     = -FLT_MAX;
+    float minDepth = FLT_MAX;
+    for (int corner = 0; corner < 8; ++corner)
+    {
+        const Vec3       position((corner & 1) ? box.m_maxs.x : box.m_mins.x,
+                                  (corner & 2) ? box.m_maxs.y : box.m_mins.y,
+                                  (corner & 4) ? box.m_maxs.z : box.m_mins.z);
+        const ViewVertex vertex = ToView(position);
+        if (vertex.depth < m_view.nearPlane)
+            return true;
+
+        float screenX = 0.0f;
+        float screenY = 0.0f;
+        ToScreen(vertex, screenX, screenY);
+        minX     = std::min(minX, screenX);
+        minY     = std::min(minY, screenY);
+        maxX     = std::max(maxX, screenX);
+        maxY     = std::max(maxY, screenY);
+        minDepth = std::min(minDepth, vertex.depth);
+    }
+
+    // Off-screen boxes are the frustum test's business
+    const int32_t x0 = std::max(static_cast<int32_t>(std::floor(minX)), 0);
+    const int32_t y0 = std::max(static_cast<int32_t>(std::floor(minY)), 0);
+    const int32_t x1 = std::min(static_cast<int32_t>(std::ceil(maxX)) - 1, m_width - 1);
+    const int32_t y1 = std::min(static_cast<int32_t>(std::ceil(maxY)) - 1, m_height - 1);
+    if (x0 > x1 || y0 > y1)
+        return true;
+
+    // [STEP 2] Any covered pixel whose occluder is not nearer than the box keeps it visible
+    const __m128 boxDepth = _mm_set1_ps(minDepth);
+    const __m128 firstX   = _mm_set1_ps(static_cast<float>(x0));
+    const __m128 lastX    = _mm_set1_ps(static_cast<float>(x1));
+    const int32_t blockX0 = x0 & ~3;
+    for (int32_t y = y0; y <= y1; ++y)
+    {
+        const float* row = m_depth.data() + static_cast<size_t>(y) * m_width;
+        for (int32_t x = blockX0; x <= x1; x += 4)
+        {
+            const float  base  = static_cast<float>(x);
+            const __m128 lanes = _mm_set_ps(base + 3.0f, base + 2.0f, base + 1.0f, base);
+            const __m128 mask  = _mm_and_ps(_mm_cmpge_ps(lanes, firstX), _mm_cmple_ps(lanes, lastX));
+            const __m128 open  = _mm_cmpge_ps(_mm_loadu_ps(row + x), boxDepth);
+            if (_mm_movemask_ps(_mm_and_ps(mask, open)) != 0)
+                return true;
+        }
+    }
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+SoftwareOcclusionBuffer::ViewVertex SoftwareOcclusionBuffer::ToView(const Vec3& worldPosition) const
+{
+    const Vec3 offset = worldPosition - m_view.position;
+    ViewVertex vertex;
+    vertex.right = -Dot(offset, m_view.left);
+    vertex.up    = Dot(offset, m_view.up);
+    vertex.depth = Dot(offset, m_view.forward);
+    return vertex;
+}
+
+// ------------------------------------------------------------------------------------------------
+void SoftwareOcclusionBuffer::ToScreen(const ViewVertex& vertex, float& outX, float& outY) const
+{
+    outX = (0.5f + 0.5f * vertex.right / (vertex.depth * m_tanHalfFovX)) * static_cast<float>(m_width);
+    outY = (0.5f - 0.5f * vertex.up / (vertex.depth * m_view.tanHalfFovY)) * static_cast<float>(m_height);
+}
+
+// ------------------------------------------------------------------------------------------------
+void SoftwareOcclusionBuffer::RasterizeQuad(const Vec3 corners[4])
+{
+    // [STEP 1] Clip against the near plane in view space
+    ViewVertex input[4];
+    for (int i = 0; i < 4; ++i)
+        input[i] = ToView(corners[i]);
+
+    ViewVertex clipped[MAX_CLIPPED_VERTICES];
+    int32_t    clippedCount = 0;
+    const float nearPlane   = m_view.nearPlane;
+    for (int i = 0; i < 4; ++i)
+    {
+        const ViewVertex& current = input[i];
+        const ViewVertex& next    = input[(i + 1) % 4];
+        const bool        inside  = current.depth >= nearPlane;
+        if (inside)
+            clipped[clippedCount++] = current;
+        if (inside != (next.depth >= nearPlane))
+        {
+            const float t = (nearPlane - current.depth) / (next.depth - current.depth);
+            ViewVertex  crossing;
+            crossing.right          = current.right + (next.right - current.right) * t;
+            crossing.up             = current.up + (next.up - current.up) * t;
+            crossing.depth          = nearPlane;
+            clipped[clippedCount++] = crossing;
+        }
+    }
+    if (clippedCount < 3)
+        return;
+
+    // [STEP 2] Fan triangles, each written at its farthest depth
+    float screenX[MAX_CLIPPED_VERTICES];
+    float screenY[MAX_CLIPPED_VERTICES];
+    for (int32_t i = 0; i < clippedCount; ++i)
+        ToScreen(clipped[i], screenX[i], screenY[i]);
+
+    for (int32_t i = 1; i + 1 < clippedCount; ++i)
+    {
+        const float triangleX[3] = {screenX[0], screenX[i], screenX[i + 1]};
+        const float triangleY[3] = {screenY[0], screenY[i], screenY[i + 1]};
+        const float depth        = std::max({clipped[0].depth, clipped[i].depth, clipped[i + 1].depth});
+        RasterizeTriangle(triangleX, triangleY, depth);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void SoftwareOcclusionBuffer::RasterizeTriangle(const float screenX[3], const float screenY[3], float depth)
+{
+    // [STEP 1] Orient the triangle so the edge functions are positive inside
+    const float area = (screenX[1] - screenX[0]) * (screenY[2] - screenY[0]) - (screenY[1] - screenY[0]) * (screenX[2] - screenX[0]);
+    if (std::fabs(area) < 1e-6f)
+        return;
+
+    const int order[3] = {0, area > 0.0f ? 1 : 2, area > 0.0f ? 2 : 1};
+    const int32_t x0   = std::max(static_cast<int32_t>(std::floor(std::min({screenX[0], screenX[1], screenX[2]}))), 0);
+    const int32_t y0   = std::max(static_cast<int32_t>(std::floor(std::min({screenY[0], screenY[1], screenY[2]}))), 0);
+    const int32_t x1   = std::min(static_cast<int32_t>(std::ceil(std::max({screenX[0], screenX[1], screenX[2]}))) - 1, m_width - 1);
+    const int32_t y1   = std::min(static_cast<int32_t>(std::ceil(std::max({screenY[0], screenY[1], screenY[2]}))) - 1, m_height - 1);
+    if (x0 > x1 || y0 > y1)
+        return;
+
+    // E(p) = A * p.x + B * p.y + C per edge, evaluated at pixel centers; a pixel is fully inside an
+    // edge when its center clears it by half the pixel's extent along the edge normal
+    __m128 stepA[3];
+    __m128 edgeB[3];
+    __m128 edgeC[3];
+    __m128 margin[3];
+    __m128 laneA[3];
+    for (int e = 0; e < 3; ++e)
+    {
+        const int   a = order[e];
+        const int   b = order[(e + 1) % 3];
+        const float A = -(screenY[b] - screenY[a]);
+        const float B = screenX[b] - screenX[a];
+        const float C = -B * screenY[a] - A * screenX[a];
+        stepA[e]      = _mm_set1_ps(A * 4.0f);
+        edgeB[e]      = _mm_set1_ps(B);
+        edgeC[e]      = _mm_set1_ps(C);
+        margin[e]     = _mm_set1_ps(0.5f * (std::fabs(A) + std::fabs(B)));
+        laneA[e]      = _mm_set1_ps(A);
+    }
+
+    // [STEP 2] Four pixels per step; the buffer width is a multiple of 4 so blocks never leave the row
+    const __m128  triangleDepth = _mm_set1_ps(depth);
+    const int32_t blockX0       = x0 & ~3;
+    const float   base          = static_cast<float>(blockX0) + 0.5f;
+    const __m128  firstCenters  = _mm_set_ps(base + 3.0f, base + 2.0f, base + 1.0f, base);
+    for (int32_t y = y0; y <= y1; ++y)
+    {
+        const __m128 centerY = _mm_set1_ps(static_cast<float>(y) + 0.5f);
+        __m128       edge[3];
+        for (int e = 0; e < 3; ++e)
+            edge[e] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(laneA[e], firstCenters), _mm_mul_ps(edgeB[e], centerY)), edgeC[e]);
+
+        float* row = m_depth.data() + static_cast<size_t>(y) * m_width;
+        for (int32_t x = blockX0; x <= x1; x += 4)
+        {
+            const __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(edge[0], margin[0]), _mm_cmpge_ps(edge[1], margin[1])),
+                                             _mm_cmpge_ps(edge[2], margin[2]));
+            if (_mm_movemask_ps(inside) != 0)
+            {
+                const __m128 stored  = _mm_loadu_ps(row + x);
+                const __m128 nearest = _mm_min_ps(stored, triangleDepth);
+                _mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, nearest), _mm_andnot_ps(inside, stored)));
+            }
+            for (int e = 0; e < 3; ++e)
+                edge[e] = _mm_add_ps(edge[e], stepA[e]);
+        }
+    }
+    ++m_rasterizedTriangles;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file SoftwareOcclusionBuffer.hpp
+ * @brief Small CPU depth buffer for conservative occluder rasterization and AABB visibility tests
+ * @date 2026-10-16
+ *
+ * Occluders are axis-aligned boxes that lie entirely inside opaque blocks. Their camera-facing faces
+ * are clipped against the near plane and rasterized with SSE, four pixels per step, into a
+ * width x height buffer of linear view depth (distance along the camera forward axis).
+ *
+ * Both sides stay conservative, so a box reported hidden is hidden at full resolution too:
+ *   - an occluder only covers pixels that lie fully inside its triangles, and writes the farthest
+ *     depth of the triangle to all of them
+ *   - a tested box covers every pixel its projected corners touch and is compared at the depth of
+ *     its nearest corner; boxes crossing the near plane are always visible
+ *
+ * The buffer has no engine dependencies beyond the math types and can be driven headlessly.
+ */
+
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/Vec3.hpp"
+
+struct SoftwareOcclusionView
+{
+    Vec3  position;
+    Vec3  forward     = Vec3(1.0f, 0.0f, 0.0f);
+    Vec3  left        = Vec3(0.0f, 1.0f, 0.0f);
+    Vec3  up          = Vec3(0.0f, 0.0f, 1.0f);
+    float tanHalfFovY = 1.0f;
+    float aspect      = 1.0f;
+    float nearPlane   = 0.1f;
+};
+
+class SoftwareOcclusionBuffer
+{
+public:
+    SoftwareOcclusionBuffer() = default;
+    SoftwareOcclusionBuffer(int32_t width, int32_t height);
+
+    /// Width is rounded up to a multiple of 4 so every row splits into whole SSE blocks
+    void Resize(int32_t width, int32_t height);
+
+    /// Starts a frame: sets the view and resets every pixel to infinitely far
+    void Clear(const SoftwareOcclusionView& view);
+
+    /// Rasterizes the camera-facing faces of a box that is fully inside opaque geometry
+    void RasterizeOccluder(const AABB3& box);
+
+    /// False only when every pixel the box can touch is covered by a nearer occluder
+    bool IsVisible(const AABB3& box) const;
+
+    int32_t      GetWidth() const { return m_width; }
+    int32_t      GetHeight() const { return m_height; }
+    const float* GetDepth() const { return m_depth.data(); }
+    uint32_t     GetRasterizedTriangles() const { return m_rasterizedTriangles; }
+
+private:
+    struct ViewVertex
+    {
+        float right = 0.0f;
+        float up    = 0.0f;
+        float depth = 0.0f;
+    };
+
+    ViewVertex ToView(const Vec3& worldPosition) const;
+    void       ToScreen(const ViewVertex& vertex, float& outX, float& outY) const;
+    void       RasterizeQuad(const Vec3 corners[4]);
+    void       RasterizeTriangle(const float screenX[3], const float screenY[3], float depth);
+
+private:
+    int32_t               m_width  = 0;
+    int32_t               m_height = 0;
+    std::vector<float>    m_depth;
+    SoftwareOcclusionView m_view;
+    float                 m_tanHalfFovX         = 1.0f;
+    uint32_t              m_rasterizedTriangles = 0;
+};
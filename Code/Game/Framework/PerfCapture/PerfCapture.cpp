@@ -0,0 +1,300 @@
+/**
+ * @file PerfCapture.cpp
+ * @brief Unattended performance capture implementation
+ * @date 2026-10-16
+ */
+
+#include "PerfCapture.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <sstream>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/Json.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Core/Yaml.hpp"
+#include "Engine/Voxel/World/World.hpp"
+#include "Game/GameCommon.hpp"
+#include "Game/Framework/GameObject/PlayerCharacter.hpp"
+#include "Game/Framework/RenderInspection/ImguiQueueDiagnosticsPanel.hpp"
+#include "Game/Framework/RenderPass/RenderPassTimers.hpp"
+#include "Game/Framework/RenderPass/RenderChunkBaching/ImguiSettingChunkBatching.hpp"
+#include "Game/Gameplay/Game.hpp"
+
+using namespace enigma::core;
+
+PerfCapture::Settings              PerfCapture::s_settings;
+std::vector<PerfCapture::Waypoint> PerfCapture::s_waypoints;
+std::vector<float>                 PerfCapture::s_frameTimesMs;
+std::ofstream                      PerfCapture::s_output;
+int                                PerfCapture::s_frameIndex = 0;
+bool                               PerfCapture::s_finished   = false;
+
+namespace
+{
+    /// Chunk batching snapshots are pre-formatted JSON text; re-parse so the line stays single-line JSON
+    Json ParseSnapshot(const std::string& text)
+    {
+        Json parsed = Json::parse(text, nullptr, false);
+        return parsed.is_discarded() ? Json(text) : parsed;
+    }
+
+    float Percentile(const std::vector<float>& sorted, float fraction)
+    {
+        if (sorted.empty())
+            return 0.0f;
+        size_t rank = static_cast<size_t>(fraction * static_cast<float>(sorted.size()) + 0.999f);
+        rank        = std::clamp<size_t>(rank, 1, sorted.size());
+        return sorted[rank - 1];
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void PerfCapture::Startup(const YamlConfiguration& config, const char* commandLine)
+{
+    s_settings.enabled      = config.GetBoolean("perfCapture.enabled", s_settings.enabled);
+    s_settings.outputPath   = config.GetString("perfCapture.output", s_settings.outputPath);
+    s_settings.warmupFrames = config.GetInt("perfCapture.warmupFrames", s_settings.warmupFrames);
+    s_settings.frames       = config.GetInt("perfCapture.frames", s_settings.frames);
+    s_settings.interval     = config.GetInt("perfCapture.interval", s_settings.interval);
+    s_settings.cameraPath   = config.GetString("perfCapture.cameraPath", s_settings.cameraPath);
+
+    if (commandLine)
+    {
+        ApplyCommandLine(commandLine);
+    }
+    if (!s_settings.enabled)
+        return;
+
+    s_settings.warmupFrames = std::max(s_settings.warmupFrames, 0);
+    s_settings.frames       = std::max(s_settings.frames, 1);
+    s_settings.interval     = std::max(s_settings.interval, 1);
+
+    std::error_code             ec;
+    const std::filesystem::path outputPath(s_settings.outputPath);
+    if (outputPath.has_parent_path())
+    {
+        std::filesystem::create_directories(outputPath.parent_path(), ec);
+    }
+    s_output.open(outputPath, std::ios::out | std::ios::trunc);
+    if (!s_output.is_open())
+    {
+        ERROR_RECOVERABLE(Stringf("PerfCapture: cannot open %s, capture disabled", s_settings.outputPath.c_str()));
+        s_settings.enabled = false;
+        return;
+    }
+
+    if (!s_settings.cameraPath.empty())
+    {
+        LoadCameraPath(s_settings.cameraPath);
+    }
+    s_frameTimesMs.reserve(s_settings.frames);
+
+    DebuggerPrintf("[PerfCapture] Capturing %d frames (warmup %d, every %d) to %s, camera path: %s\n",
+                   s_settings.frames, s_settings.warmupFrames, s_settings.interval, s_settings.outputPath.c_str(),
+                   s_waypoints.empty() ? "<none>" : s_settings.cameraPath.c_str());
+}
+
+// ------------------------------------------------------------------------------------------------
+void PerfCapture::Shutdown()
+{
+    if (s_output.is_open())
+    {
+        s_output.close();
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+bool PerfCapture::IsActive()
+{
+    return s_settings.enabled && !s_finished;
+}
+
+// ------------------------------------------------------------------------------------------------
+void PerfCapture::ApplyCommandLine(const std::string& commandLine)
+{
+    std::istringstream tokens(commandLine);
+    std::string        token;
+    while (tokens >> token)
+    {
+        if (token == "perfCapture")
+        {
+            s_settings.enabled = true;
+            continue;
+        }
+
+        const std::string prefix = "perfCapture.";
+        const size_t      equals = token.find('=');
+        if (token.rfind(prefix, 0) != 0 || equals == std::string::npos)
+            continue;
+
+        const std::string key   = token.substr(prefix.size(), equals - prefix.size());
+        const std::string value = token.substr(equals + 1);
+        try
+        {
+            if (key == "enabled")
+                s_settings.enabled = value == "true" || value == "1";
+            else if (key == "output")
+                s_settings.outputPath = value;
+            else if (key == "warmupFrames")
+                s_settings.warmupFrames = std::stoi(value);
+            else if (key == "frames")
+                s_settings.frames = std::stoi(value);
+            else if (key == "interval")
+                s_settings.interval = std::stoi(value);
+            else if (key == "cameraPath")
+                s_settings.cameraPath = value;
+            else
+                DebuggerPrintf("[PerfCapture] Unknown command line key '%s'\n", key.c_str());
+        }
+        catch (const std::exception&)
+        {
+            DebuggerPrintf("[PerfCapture] Invalid value '%s' for '%s'\n", value.c_str(), key.c_str());
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void PerfCapture::LoadCameraPath(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file.is_open())
+    {
+        ERROR_RECOVERABLE(Stringf("PerfCapture: cannot open camera path %s", path.c_str()));
+        return;
+    }
+
+    std::string line;
+    while (std::getline(file, line))
+    {
+        const size_t comment = line.find('#');
+        if (comment != std::string::npos)
+            line.erase(comment);
+
+        std::istringstream values(line);
+        Waypoint           waypoint;
+        if (values >> waypoint.position.x >> waypoint.position.y >> waypoint.position.z >> waypoint.orientation.m_yawDegrees >> waypoint.orientation.m_pitchDegrees)
+        {
+            s_waypoints.push_back(waypoint);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void PerfCapture::ApplyCameraPath()
+{
+    if (!IsActive() || s_waypoints.empty() || !g_theGame || !g_theGame->m_player)
+        return;
+
+    // The path starts at the first waypoint during warmup so streaming settles around the start point
+    const int    captureFrame = std::max(s_frameIndex - s_settings.warmupFrames, 0);
+    const float  t            = s_settings.frames > 1 ? static_cast<float>(captureFrame) / static_cast<float>(s_settings.frames - 1) : 0.0f;
+    const float  segment      = std::clamp(t, 0.0f, 1.0f) * static_cast<float>(s_waypoints.size() - 1);
+    const size_t index        = std::min(static_cast<size_t>(segment), s_waypoints.size() - 1);
+    const size_t next         = std::min(index + 1, s_waypoints.size() - 1);
+    const float  fraction     = segment - static_cast<float>(index);
+
+    const Waypoint& a = s_waypoints[index];
+    const Waypoint& b = s_waypoints[next];
+
+    PlayerCharacter* player = g_theGame->m_player.get();
+    player->m_position      = a.position + (b.position - a.position) * fraction;
+    player->m_orientation   = EulerAngles(a.orientation.m_yawDegrees + (b.orientation.m_yawDegrees - a.orientation.m_yawDegrees) * fraction,
+                                          a.orientation.m_pitchDegrees + (b.orientation.m_pitchDegrees - a.orientation.m_pitchDegrees) * fraction,
+                                          0.0f);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool PerfCapture::EndFrame(float deltaSeconds)
+{
+    if (!IsActive())
+        return false;
+
+    const int captureFrame = s_frameIndex - s_settings.warmupFrames;
+    ++s_frameIndex;
+    if (captureFrame < 0)
+        return false;
+
+    s_frameTimesMs.push_back(deltaSeconds * 1000.0f);
+    if (captureFrame % s_settings.interval == 0)
+    {
+        WriteFrameLine(deltaSeconds);
+    }
+
+    if (captureFrame + 1 < s_settings.frames)
+        return false;
+
+    WriteSummaryLine();
+    s_output.close();
+    s_finished = true;
+    DebuggerPrintf("[PerfCapture] Finished, wrote %s\n", s_settings.outputPath.c_str());
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void PerfCapture::WriteFrameLine(float deltaSeconds)
+{
+    Json line       = Json::object();
+    line["frame"]   = s_frameIndex - 1 - s_settings.warmupFrames;
+    line["frameMs"] = deltaSeconds * 1000.0f;
+
+    // Only the last frame's value per pass/phase; percentiles are derived offline from the lines
+    Json passTimings = Json::object();
+    for (const RenderPassTimingStats& entry : RenderPassTimers::BuildLastFrameStats())
+    {
+        passTimings[entry.passName][RenderPassTimers::GetPhaseName(entry.phase)] = entry.lastMs;
+    }
+    line["passTimingsMs"]  = passTimings;
+    line["queue"]          = ImguiQueueDiagnosticsPanel::BuildCurrentFrameJson();
+    line["asyncChunkMesh"] = ImguiQueueDiagnosticsPanel::BuildAsyncChunkMeshCurrentFrameJson();
+
+    const enigma::voxel::World* world = g_theGame ? g_theGame->GetWorld() : nullptr;
+    if (world)
+    {
+        // The snapshot is rooted at "chunkBatching" itself; keep one level so lines read chunkBatching.frameStats...
+        const Json snapshot   = ParseSnapshot(ImguiSettingChunkBatching::BuildFrameSnapshotJson(*world));
+        line["chunkBatching"] = snapshot.is_object() && snapshot.contains("chunkBatching") ? snapshot["chunkBatching"] : snapshot;
+    }
+    if (g_theGame && g_theGame->m_player)
+    {
+        const Vec3& position = g_theGame->m_player->m_position;
+        line["camera"]       = {position.x, position.y, position.z};
+    }
+
+    s_output << line.dump() << '\n';
+}
+
+// ------------------------------------------------------------------------------------------------
+void PerfCapture::WriteSummaryLine()
+{
+    std::vector<float> sorted = s_frameTimesMs;
+    std::sort(sorted.begin(), sorted.end());
+
+    double sum = 0.0;
+    for (float value : sorted)
+        sum += value;
+
+    Json frameTimes     = Json::object();
+    frameTimes["count"] = sorted.size();
+    frameTimes["avgMs"] = sorted.empty() ? 0.0 : sum / static_cast<double>(sorted.size());
+    frameTimes["p50Ms"] = Percentile(sorted, 0.50f);
+    frameTimes["p95Ms"] = Percentile(sorted, 0.95f);
+    frameTimes["p99Ms"] = Percentile(sorted, 0.99f);
+    frameTimes["maxMs"] = sorted.empty() ? 0.0f : sorted.back();
+
+    Json summary                         = Json::object();
+    summary["summary"]                   = true;
+    summary["frameTimes"]                = frameTimes;
+    summary["queueAccumulated"]          = ImguiQueueDiagnosticsPanel::BuildAccumulatedJson();
+    summary["asyncChunkMeshAccumulated"] = ImguiQueueDiagnosticsPanel::BuildAsyncChunkMeshAccumulatedJson();
+
+    const enigma::voxel::World* world = g_theGame ? g_theGame->GetWorld() : nullptr;
+    if (world)
+    {
+        summary["chunkBatchingLifetime"] = ParseSnapshot(ImguiSettingChunkBatching::BuildLifetimeSnapshotJson(*world));
+    }
+
+    s_output << summary.dump() << '\n';
+}
@@ -0,0 +1,76 @@
+/**
+ * @file PerfCapture.hpp
+ * @brief Unattended performance capture: writes per-frame diagnostics to a JSON Lines file, then quits
+ * @date 2026-10-16
+ *
+ * Each captured frame becomes one line holding the frame time, the per-pass CPU timings, the queue and
+ * async chunk mesh frame diagnostics and the chunk batching frame snapshot. A final summary line holds
+ * the accumulated/lifetime snapshots and frame time percentiles. When a camera path is given the player
+ * is moved along it so runs are repeatable.
+ *
+ * Configuration Path: Run/.enigma/settings.yml -> perfCapture
+ * Command line overrides: "perfCapture" enables the capture, "perfCapture.<key>=<value>" sets a key
+ *   e.g. FGSPDX12DRECPS.exe perfCapture perfCapture.frames=1200 perfCapture.cameraPath=.enigma/perf/flyover.path
+ *
+ * Camera path file: one waypoint per line, "x y z yawDegrees pitchDegrees", '#' starts a comment.
+ * Waypoints are spaced evenly over the captured frames and interpolated linearly.
+ */
+
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Engine/Core/Yaml.hpp"
+#include "Engine/Math/EulerAngles.hpp"
+#include "Engine/Math/Vec3.hpp"
+
+class PerfCapture
+{
+public:
+    PerfCapture()                              = delete; // Prevent instantiation
+    PerfCapture(const PerfCapture&)            = delete; // Prevent copy
+    PerfCapture& operator=(const PerfCapture&) = delete; // Prevent assignment
+
+    /// Read the perfCapture section, apply command line overrides and open the output file when enabled
+    static void Startup(const enigma::core::YamlConfiguration& config, const char* commandLine);
+    static void Shutdown();
+
+    static bool IsActive();
+
+    /// Before Game::Update: place the player on the camera path for the upcoming frame
+    static void ApplyCameraPath();
+
+    /// After Game::Render: record the frame. Returns true once the capture has finished and the app should quit.
+    static bool EndFrame(float deltaSeconds);
+
+private:
+    struct Settings
+    {
+        bool        enabled      = false;
+        std::string outputPath   = "Logs/perf_capture.jsonl";
+        int         warmupFrames = 120; // Frames skipped while chunks stream in and pipelines compile
+        int         frames       = 600; // Captured frames after warmup; the app quits afterwards
+        int         interval     = 1;   // Write a line every N captured frames
+        std::string cameraPath;         // Empty keeps the player where the world spawns it
+    };
+
+    struct Waypoint
+    {
+        Vec3        position;
+        EulerAngles orientation;
+    };
+
+    static void ApplyCommandLine(const std::string& commandLine);
+    static void LoadCameraPath(const std::string& path);
+    static void WriteFrameLine(float deltaSeconds);
+    static void WriteSummaryLine();
+
+    static Settings              s_settings;
+    static std::vector<Waypoint> s_waypoints;
+    static std::vector<float>    s_frameTimesMs;
+    static std::ofstream         s_output;
+    static int                   s_frameIndex;
+    static bool                  s_finished;
+};
@@ -0,0 +1,423 @@
+/**
+ * @file RenderGraph.cpp
+ * @brief Declarative frame graph compiler implementation
+ * @date 2026-10-16
+ */
+
+#include "RenderGraph.hpp"
+
+#include <algorithm>
+
+namespace
+{
+    struct MergedUse
+    {
+        RenderGraphResource resource;
+        bool                read  = false;
+        bool                write = false;
+    };
+
+    struct ResourceState
+    {
+        RenderGraphResourceDesc desc;
+        RenderGraphAccess       current = RenderGraphAccess::RenderTarget;
+        RenderGraphLifetime     lifetime;
+        bool                    written = false;
+        bool                    read    = false;
+    };
+
+    bool IsDepthType(RenderGraphResourceType type)
+    {
+        return type == RenderGraphResourceType::DepthTex || type == RenderGraphResourceType::ShadowTex;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+bool RenderGraphCompileResult::HasErrors() const
+{
+    return std::any_of(messages.begin(), messages.end(), [](const RenderGraphMessage& message)
+    {
+        return message.severity == RenderGraphMessageSeverity::Error;
+    });
+}
+
+// ------------------------------------------------------------------------------------------------
+void RenderGraph::Reset()
+{
+    m_resources.clear();
+    m_passes.clear();
+}
+
+// ------------------------------------------------------------------------------------------------
+void RenderGraph::DeclareResource(const RenderGraphResourceDesc& desc)
+{
+    for (RenderGraphResourceDesc& existing : m_resources)
+    {
+        if (existing.resource == desc.resource)
+        {
+            existing = desc;
+            return;
+        }
+    }
+    m_resources.push_back(desc);
+}
+
+// ------------------------------------------------------------------------------------------------
+int RenderGraph::AddPass(const std::string& name)
+{
+    m_passes.push_back({name, {}});
+    return static_cast<int>(m_passes.size()) - 1;
+}
+
+// ------------------------------------------------------------------------------------------------
+void RenderGraph::AddUse(int passIndex, const RenderGraphResource& resource, RenderGraphAccess access)
+{
+    if (passIndex < 0 || passIndex >= static_cast<int>(m_passes.size()))
+        return;
+    m_passes[passIndex].uses.push_back({resource, access});
+}
+
+// ------------------------------------------------------------------------------------------------
+void RenderGraph::Read(int passIndex, const RenderGraphResource& resource)
+{
+    AddUse(passIndex, resource, RenderGraphAccess::ShaderRead);
+}
+
+// ------------------------------------------------------------------------------------------------
+void RenderGraph::Write(int passIndex, const RenderGraphResource& resource)
+{
+    AddUse(passIndex, resource, GetWriteAccess(resource.type));
+}
+
+// ------------------------------------------------------------------------------------------------
+void RenderGraph::ReadMask(int passIndex, RenderGraphResourceType type, uint32_t indexMask)
+{
+    for (int i = 0; i < 32; ++i)
+    {
+        if (indexMask & (1u << i))
+            Read(passIndex, {type, i});
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void RenderGraph::WriteMask(int passIndex, RenderGraphResourceType type, uint32_t indexMask)
+{
+    for (int i = 0; i < 32; ++i)
+    {
+        if (indexMask & (1u << i))
+            Write(passIndex, {type, i});
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+uint32_t RenderGraph::GetWriteMask(int passIndex, RenderGraphResourceType type) const
+{
+    if (passIndex < 0 || passIndex >= static_cast<int>(m_passes.size()))
+        return 0;
+
+    uint32_t mask = 0;
+    for (const RenderGraphUse& use : m_passes[passIndex].uses)
+    {
+        if (use.resource.type == type && use.access != RenderGraphAccess::ShaderRead && use.resource.index < 32)
+            mask |= 1u << use.resource.index;
+    }
+    return mask;
+}
+
+// ------------------------------------------------------------------------------------------------
+RenderGraphResourceDesc RenderGraph::GetDesc(const RenderGraphResource& resource) const
+{
+    for (const RenderGraphResourceDesc& desc : m_resources)
+    {
+        if (desc.resource == resource)
+            return desc;
+    }
+
+    RenderGraphResourceDesc desc;
+    desc.resource    = resource;
+    desc.frameAccess = GetDefaultAccess(resource.type);
+    desc.external    = true;
+    return desc;
+}
+
+// ------------------------------------------------------------------------------------------------
+RenderGraphCompileResult RenderGraph::Compile() const
+{
+    RenderGraphCompileResult     result;
+    std::vector<ResourceState>   states;
+
+    auto findState = [&states, this](const RenderGraphResource& resource) -> ResourceState&
+    {
+        for (ResourceState& state : states)
+        {
+            if (state.desc.resource == resource)
+                return state;
+        }
+        ResourceState state;
+        state.desc              = GetDesc(resource);
+        state.current           = state.desc.frameAccess;
+        state.lifetime.resource = resource;
+        states.push_back(state);
+        return states.back();
+    };
+
+    auto addMessage = [&result](RenderGraphMessageSeverity severity, int passIndex, std::string text)
+    {
+        result.messages.push_back({severity, passIndex, std::move(text)});
+    };
+
+    result.passes.reserve(m_passes.size());
+    for (int passIndex = 0; passIndex < static_cast<int>(m_passes.size()); ++passIndex)
+    {
+        const PassNode&         node = m_passes[passIndex];
+        RenderGraphCompiledPass compiled;
+        compiled.name = node.name;
+
+        // Merge duplicate declarations so each resource gets exactly one required state per pass
+        std::vector<MergedUse> merged;
+        for (const RenderGraphUse& use : node.uses)
+        {
+            auto it = std::find_if(merged.begin(), merged.end(), [&use](const MergedUse& m) { return m.resource == use.resource; });
+            if (it == merged.end())
+            {
+                merged.push_back({use.resource});
+                it = merged.end() - 1;
+            }
+            (use.access == RenderGraphAccess::ShaderRead ? it->read : it->write) = true;
+        }
+
+        for (const MergedUse& use : merged)
+        {
+            ResourceState& state = findState(use.resource);
+
+            if (use.read && use.write)
+            {
+                if (IsDepthType(use.resource.type))
+                {
+                    addMessage(RenderGraphMessageSeverity::Error, passIndex,
+                               node.name + " samples and writes " + GetResourceName(use.resource) + " (SRV + DSV hazard)");
+                }
+                else
+                {
+                    addMessage(RenderGraphMessageSeverity::Info, passIndex,
+                               node.name + " reads and writes " + GetResourceName(use.resource) + " (relies on blend or main/alt flip)");
+                }
+            }
+
+            // Ordering: a read before any write this frame consumes previous-frame content
+            if (state.lifetime.firstPass < 0)
+            {
+                state.lifetime.firstPass    = passIndex;
+                state.lifetime.readsHistory = use.read && !use.write;
+            }
+            state.lifetime.lastPass = passIndex;
+            state.read |= use.read;
+            state.written |= use.write;
+
+            RenderGraphAccess required = use.write ? GetWriteAccess(use.resource.type) : RenderGraphAccess::ShaderRead;
+            compiled.uses.push_back({use.resource, required});
+
+            if (required != state.desc.frameAccess)
+            {
+                result.perPassBarrierCount += 2;
+            }
+            if (required != state.current)
+            {
+                compiled.barriers.push_back({use.resource, state.current, required});
+                state.current = required;
+            }
+        }
+
+        result.barrierCount += static_cast<int>(compiled.barriers.size());
+        result.passes.push_back(std::move(compiled));
+    }
+
+    for (ResourceState& state : states)
+    {
+        if (state.current != state.desc.frameAccess)
+        {
+            result.endOfFrameBarriers.push_back({state.desc.resource, state.current, state.desc.frameAccess});
+        }
+
+        const std::string name = GetResourceName(state.desc.resource);
+        if (!state.written && !state.desc.external)
+        {
+            addMessage(RenderGraphMessageSeverity::Warning, state.lifetime.firstPass,
+                       name + " is read but never written by any pass this frame");
+        }
+        else if (state.lifetime.readsHistory && state.written)
+        {
+            addMessage(RenderGraphMessageSeverity::Info, state.lifetime.firstPass,
+                       name + " is read before its first write; previous-frame content is used");
+        }
+
+        state.lifetime.transient = !state.desc.external && !state.lifetime.readsHistory && state.written &&
+                                   !IsDepthType(state.desc.resource.type);
+        result.lifetimes.push_back(state.lifetime);
+    }
+    result.barrierCount += static_cast<int>(result.endOfFrameBarriers.size());
+
+    // Greedy interval partitioning: visit transients by first use and reuse the first compatible group
+    // whose last member retired before this one starts
+    std::vector<const ResourceState*> transients;
+    for (const ResourceState& state : states)
+    {
+        if (state.lifetime.transient)
+            transients.push_back(&state);
+    }
+    std::stable_sort(transients.begin(), transients.end(), [](const ResourceState* a, const ResourceState* b)
+    {
+        return a->lifetime.firstPass < b->lifetime.firstPass;
+    });
+
+    std::vector<RenderGraphAliasGroup> groups;
+    std::vector<int>                   groupLastPass;
+    for (const ResourceState* state : transients)
+    {
+        bool placed = false;
+        for (size_t g = 0; g < groups.size(); ++g)
+        {
+            if (groups[g].formatKey == state->desc.formatKey && groupLastPass[g] < state->lifetime.firstPass)
+            {
+                groups[g].members.push_back(state->desc.resource);
+                groupLastPass[g] = state->lifetime.lastPass;
+                placed           = true;
+                break;
+            }
+        }
+        if (!placed)
+        {
+            groups.push_back({state->desc.formatKey, {state->desc.resource}});
+            groupLastPass.push_back(state->lifetime.lastPass);
+        }
+    }
+
+    for (RenderGraphAliasGroup& group : groups)
+    {
+        if (group.members.size() > 1)
+        {
+            result.aliasedTargetCount += static_cast<int>(group.members.size()) - 1;
+            result.aliasGroups.push_back(std::move(group));
+        }
+    }
+
+    return result;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool RenderGraph::VerifyBarriers(const RenderGraphCompileResult& result, std::string& outProblem) const
+{
+    if (result.passes.size() != m_passes.size())
+    {
+        outProblem = "compiled pass count does not match the declared passes";
+        return false;
+    }
+
+    std::vector<std::pair<RenderGraphResourceDesc, RenderGraphAccess>> states;
+    auto findState = [&states, this](const RenderGraphResource& resource) -> RenderGraphAccess&
+    {
+        for (auto& state : states)
+        {
+            if (state.first.resource == resource)
+                return state.second;
+        }
+        const RenderGraphResourceDesc desc = GetDesc(resource);
+        states.emplace_back(desc, desc.frameAccess);
+        return states.back().second;
+    };
+
+    auto applyBarriers = [&](const std::vector<RenderGraphBarrier>& barriers, const std::string& where)
+    {
+        for (const RenderGraphBarrier& barrier : barriers)
+        {
+            RenderGraphAccess& current = findState(barrier.resource);
+            if (current != barrier.before)
+            {
+                outProblem = where + ": barrier on " + GetResourceName(barrier.resource) + " expects " + GetAccessName(barrier.before) +
+                             " but the resource is in " + GetAccessName(current);
+                return false;
+            }
+            current = barrier.after;
+        }
+        return true;
+    };
+
+    for (const RenderGraphCompiledPass& pass : result.passes)
+    {
+        if (!applyBarriers(pass.barriers, pass.name))
+            return false;
+
+        for (const RenderGraphUse& use : pass.uses)
+        {
+            const RenderGraphAccess current = findState(use.resource);
+            if (current != use.access)
+            {
+                outProblem = pass.name + " uses " + GetResourceName(use.resource) + " as " + GetAccessName(use.access) +
+                             " while it is in " + GetAccessName(current);
+                return false;
+            }
+        }
+    }
+
+    if (!applyBarriers(result.endOfFrameBarriers, "end of frame"))
+        return false;
+
+    for (const auto& [desc, current] : states)
+    {
+        if (current != desc.frameAccess)
+        {
+            outProblem = GetResourceName(desc.resource) + " ends the frame in " + GetAccessName(current) + " instead of " + GetAccessName(desc.frameAccess);
+            return false;
+        }
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+RenderGraphAccess RenderGraph::GetDefaultAccess(RenderGraphResourceType type)
+{
+    return IsDepthType(type) ? RenderGraphAccess::DepthWrite : RenderGraphAccess::RenderTarget;
+}
+
+// ------------------------------------------------------------------------------------------------
+RenderGraphAccess RenderGraph::GetWriteAccess(RenderGraphResourceType type)
+{
+    return IsDepthType(type) ? RenderGraphAccess::DepthWrite : RenderGraphAccess::RenderTarget;
+}
+
+// ------------------------------------------------------------------------------------------------
+const char* RenderGraph::GetAccessName(RenderGraphAccess access)
+{
+    switch (access)
+    {
+    case RenderGraphAccess::RenderTarget:
+        return "RenderTarget";
+    case RenderGraphAccess::DepthWrite:
+        return "DepthWrite";
+    case RenderGraphAccess::ShaderRead:
+        return "ShaderRead";
+    }
+    return "Unknown";
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string RenderGraph::GetResourceName(const RenderGraphResource& resource)
+{
+    const char* prefix = "colortex";
+    switch (resource.type)
+    {
+    case RenderGraphResourceType::ColorTex:
+        prefix = "colortex";
+        break;
+    case RenderGraphResourceType::DepthTex:
+        prefix = "depthtex";
+        break;
+    case RenderGraphResourceType::ShadowTex:
+        prefix = "shadowtex";
+        break;
+    case RenderGraphResourceType::ShadowColor:
+        prefix = "shadowcolor";
+        break;
+    }
+    return prefix + std::to_string(resource.index);
+}
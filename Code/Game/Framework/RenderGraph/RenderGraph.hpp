@@ -0,0 +1,162 @@
+/**
+ * @file RenderGraph.hpp
+ * @brief Declarative frame graph compiler: per-pass target accesses in, barriers and aliasing plan out
+ * @date 2026-10-16
+ *
+ * Responsibilities:
+ * - Collect which colortex / depthtex / shadowtex / shadowcolor targets each pass reads and writes
+ * - Compute the minimal state transitions between passes and back to the frame-start state
+ * - Derive target lifetimes and group transient targets with disjoint lifetimes for memory aliasing
+ * - Validate ordering (history reads, read-never-written, same-pass depth sample + write)
+ * - Replay a compiled barrier list against the declared uses (VerifyBarriers)
+ *
+ * Pure CPU: nothing in here touches the renderer, so the compiler can be driven headlessly
+ * (SceneUnitTest_RenderGraph). SceneRenderGraph adapts it to the SceneRenderPass list and applies the
+ * barriers. Alias groups are a plan only: the render targets are engine-owned committed resources, so
+ * no memory is shared yet and SceneRenderGraph only logs aliasedTargetCount.
+ */
+
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum class RenderGraphResourceType : uint8_t
+{
+    ColorTex,
+    DepthTex,
+    ShadowTex,
+    ShadowColor
+};
+
+enum class RenderGraphAccess : uint8_t
+{
+    RenderTarget, // Bound as RTV
+    DepthWrite,   // Bound as DSV (also used as copy source/destination state by the depth providers)
+    ShaderRead    // Sampled as SRV
+};
+
+struct RenderGraphResource
+{
+    RenderGraphResourceType type  = RenderGraphResourceType::ColorTex;
+    int                     index = 0;
+
+    bool operator==(const RenderGraphResource& other) const { return type == other.type && index == other.index; }
+    bool operator!=(const RenderGraphResource& other) const { return !(*this == other); }
+};
+
+struct RenderGraphResourceDesc
+{
+    RenderGraphResource resource;
+    RenderGraphAccess   frameAccess = RenderGraphAccess::RenderTarget; // State at frame start, restored at frame end
+    std::string         formatKey; // Targets may only alias when their keys match
+    bool                external = false; // Consumed outside the graph (present, debug passes): never aliased
+};
+
+struct RenderGraphUse
+{
+    RenderGraphResource resource;
+    RenderGraphAccess   access = RenderGraphAccess::ShaderRead;
+};
+
+struct RenderGraphBarrier
+{
+    RenderGraphResource resource;
+    RenderGraphAccess   before = RenderGraphAccess::RenderTarget;
+    RenderGraphAccess   after  = RenderGraphAccess::RenderTarget;
+};
+
+struct RenderGraphLifetime
+{
+    RenderGraphResource resource;
+    int                 firstPass    = -1;
+    int                 lastPass     = -1;
+    bool                readsHistory = false; // First access is a read: content comes from the previous frame
+    bool                transient    = false; // Eligible for aliasing
+};
+
+struct RenderGraphAliasGroup
+{
+    std::string                      formatKey;
+    std::vector<RenderGraphResource> members; // Ordered by first use; lifetimes are pairwise disjoint
+};
+
+enum class RenderGraphMessageSeverity : uint8_t
+{
+    Info,
+    Warning,
+    Error
+};
+
+struct RenderGraphMessage
+{
+    RenderGraphMessageSeverity severity  = RenderGraphMessageSeverity::Info;
+    int                        passIndex = -1;
+    std::string                text;
+};
+
+struct RenderGraphCompiledPass
+{
+    std::string                     name;
+    std::vector<RenderGraphUse>     uses; // Merged, one entry per resource
+    std::vector<RenderGraphBarrier> barriers; // Applied before the pass executes
+};
+
+struct RenderGraphCompileResult
+{
+    std::vector<RenderGraphCompiledPass> passes;
+    std::vector<RenderGraphBarrier>      endOfFrameBarriers;
+    std::vector<RenderGraphLifetime>     lifetimes;
+    std::vector<RenderGraphAliasGroup>   aliasGroups;
+    std::vector<RenderGraphMessage>      messages;
+
+    int barrierCount        = 0; // Total transitions emitted by the graph
+    int perPassBarrierCount = 0; // Baseline: every pass transitions its non-default uses in and back out
+    int aliasedTargetCount  = 0; // Targets that can borrow another target's memory
+
+    bool HasErrors() const;
+};
+
+class RenderGraph
+{
+public:
+    void Reset();
+
+    /// Optional: undeclared resources use the default state for their type and are never aliased
+    void DeclareResource(const RenderGraphResourceDesc& desc);
+
+    int  AddPass(const std::string& name);
+    void AddUse(int passIndex, const RenderGraphResource& resource, RenderGraphAccess access);
+    void Read(int passIndex, const RenderGraphResource& resource);
+    void Write(int passIndex, const RenderGraphResource& resource); // RenderTarget or DepthWrite by type
+    void ReadMask(int passIndex, RenderGraphResourceType type, uint32_t indexMask);
+    void WriteMask(int passIndex, RenderGraphResourceType type, uint32_t indexMask);
+
+    int GetPassCount() const { return static_cast<int>(m_passes.size()); }
+
+    /// Indices of type the pass has declared as RenderTarget / DepthWrite so far
+    uint32_t GetWriteMask(int passIndex, RenderGraphResourceType type) const;
+
+    RenderGraphCompileResult Compile() const;
+
+    /// Replays the barriers from the frame-start states: every use must find its resource in the required
+    /// state and every resource must be back in its frame state after endOfFrameBarriers
+    bool VerifyBarriers(const RenderGraphCompileResult& result, std::string& outProblem) const;
+
+    static RenderGraphAccess GetDefaultAccess(RenderGraphResourceType type);
+    static RenderGraphAccess GetWriteAccess(RenderGraphResourceType type);
+    static const char*       GetAccessName(RenderGraphAccess access);
+    static std::string       GetResourceName(const RenderGraphResource& resource);
+
+private:
+    struct PassNode
+    {
+        std::string                 name;
+        std::vector<RenderGraphUse> uses;
+    };
+
+    RenderGraphResourceDesc GetDesc(const RenderGraphResource& resource) const;
+
+    std::vector<RenderGraphResourceDesc> m_resources;
+    std::vector<PassNode>                m_passes;
+};
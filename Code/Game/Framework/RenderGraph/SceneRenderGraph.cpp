@@ -0,0 +1,203 @@
+/**
+ * @file SceneRenderGraph.cpp
+ * @brief SceneRenderPass frame graph adapter implementation
+ * @date 2026-10-16
+ */
+
+#include "SceneRenderGraph.hpp"
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Graphic/Bundle/ShaderBundleEvents.hpp"
+#include "Engine/Graphic/Integration/RendererSubsystem.hpp"
+#include "Engine/Graphic/Shader/Program/ShaderProgram.hpp"
+#include "Engine/Graphic/Target/DepthTextureProvider.hpp"
+#include "Engine/Graphic/Target/RenderTargetProviderCommon.hpp"
+#include "Engine/Graphic/Target/ShadowTextureProvider.hpp"
+#include "Game/GameCommon.hpp"
+#include "Game/Framework/RenderPass/RenderPassCulling.hpp"
+#include "Game/Framework/RenderPass/RenderPassTimers.hpp"
+#include "Game/Framework/RenderPass/SceneRenderPass.hpp"
+
+// ------------------------------------------------------------------------------------------------
+SceneRenderGraph::SceneRenderGraph()
+{
+    m_loadedHandle = enigma::graphic::ShaderBundleEvents::OnBundleLoaded.Add(this, &SceneRenderGraph::OnShaderBundleLoaded);
+}
+
+// ------------------------------------------------------------------------------------------------
+SceneRenderGraph::~SceneRenderGraph()
+{
+    if (m_loadedHandle != 0)
+    {
+        enigma::graphic::ShaderBundleEvents::OnBundleLoaded.Remove(m_loadedHandle);
+        m_loadedHandle = 0;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void SceneRenderGraph::OnShaderBundleLoaded(enigma::graphic::ShaderBundle* /*newBundle*/)
+{
+    // Program outputs, scanned reads and the composite plan all change with the bundle
+    m_dirty = true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void SceneRenderGraph::Execute(const std::vector<SceneRenderPass*>& passes)
+{
+    if (m_dirty || passes != m_compiledPasses)
+    {
+        Rebuild(passes);
+    }
+
+    for (size_t i = 0; i < passes.size(); ++i)
+    {
+        if (i < m_compiled.passes.size())
+        {
+            ApplyBarriers(m_compiled.passes[i].barriers);
+        }
+
+        RenderPassTimers::SetCurrentPass(m_passTimerIds[i]);
+        ScopedRenderPassTimer timer(RenderPassTimerPhase::Execute);
+        passes[i]->Execute();
+    }
+    RenderPassTimers::SetCurrentPass(RenderPassTimers::UNASSIGNED_PASS);
+
+    // Leave depth and shadow textures in DEPTH_WRITE for the debug passes and the next frame
+    ApplyBarriers(m_compiled.endOfFrameBarriers);
+}
+
+// ------------------------------------------------------------------------------------------------
+void SceneRenderGraph::Rebuild(const std::vector<SceneRenderPass*>& passes)
+{
+    m_graph.Reset();
+
+    // colortex0 is presented after final; other color targets are graph-owned and may alias
+    for (int i = 0; i < enigma::graphic::MAX_COLOR_TEXTURES; ++i)
+    {
+        RenderGraphResourceDesc desc;
+        desc.resource    = {RenderGraphResourceType::ColorTex, i};
+        desc.frameAccess = RenderGraphAccess::RenderTarget;
+        desc.formatKey   = RenderPassCulling::GetColorTexFormat(i);
+        desc.external    = i == 0;
+        m_graph.DeclareResource(desc);
+    }
+
+    // Depth and shadow textures are also sampled by the chunk-batch debug passes after the graph
+    for (int i = 0; i < 2; ++i)
+    {
+        m_graph.DeclareResource({{RenderGraphResourceType::DepthTex, i}, RenderGraphAccess::DepthWrite, "depth", true});
+        m_graph.DeclareResource({{RenderGraphResourceType::ShadowTex, i}, RenderGraphAccess::DepthWrite, "shadow", true});
+    }
+
+    for (SceneRenderPass* pass : passes)
+    {
+        const int passCountBefore = m_graph.GetPassCount();
+        pass->DeclareResources(m_graph);
+        if (m_graph.GetPassCount() == passCountBefore)
+        {
+            m_graph.AddPass("undeclared");
+        }
+        else if (m_graph.GetPassCount() != passCountBefore + 1)
+        {
+            ERROR_RECOVERABLE("SceneRenderPass::DeclareResources must add exactly one graph pass");
+        }
+    }
+
+    m_compiled       = m_graph.Compile();
+    m_compiledPasses = passes;
+
+    m_passTimerIds.clear();
+    for (const RenderGraphCompiledPass& pass : m_compiled.passes)
+    {
+        m_passTimerIds.push_back(RenderPassTimers::RegisterPass(pass.name));
+    }
+    m_dirty          = false;
+    ++m_compileCount;
+
+    for (const RenderGraphMessage& message : m_compiled.messages)
+    {
+        if (message.severity == RenderGraphMessageSeverity::Error)
+        {
+            ERROR_RECOVERABLE(Stringf("RenderGraph: %s", message.text.c_str()));
+        }
+    }
+
+    // The scene passes no longer transition depth or shadow textures themselves, so the compiled
+    // barriers are the only ones issued; check them against the live pass list on every rebuild
+    std::string barrierProblem;
+    if (!m_graph.VerifyBarriers(m_compiled, barrierProblem))
+    {
+        ERROR_RECOVERABLE(Stringf("RenderGraph: barrier replay failed, %s", barrierProblem.c_str()));
+    }
+
+    DebuggerPrintf("[SceneRenderGraph] Compiled %d passes: %d barriers (per-pass baseline %d), %d aliasable targets\n",
+                   m_graph.GetPassCount(), m_compiled.barrierCount, m_compiled.perPassBarrierCount, m_compiled.aliasedTargetCount);
+}
+
+// ------------------------------------------------------------------------------------------------
+void SceneRenderGraph::ApplyBarriers(const std::vector<RenderGraphBarrier>& barriers)
+{
+    if (barriers.empty())
+        return;
+
+    auto* depthProvider  = static_cast<enigma::graphic::DepthTextureProvider*>(g_theRendererSubsystem->GetRenderTargetProvider(enigma::graphic::RenderTargetType::DepthTex));
+    auto* shadowProvider = static_cast<enigma::graphic::ShadowTextureProvider*>(g_theRendererSubsystem->GetRenderTargetProvider(enigma::graphic::RenderTargetType::ShadowTex));
+
+    for (const RenderGraphBarrier& barrier : barriers)
+    {
+        auto transition = [&barrier](auto* texture)
+        {
+            if (!texture)
+                return;
+
+            if (barrier.after == RenderGraphAccess::ShaderRead)
+            {
+                texture->TransitionToShaderResource();
+            }
+            else
+            {
+                texture->TransitionToDepthWrite();
+            }
+        };
+
+        // Color and shadowcolor targets are transitioned by the renderer when bound (PrepareForRendering);
+        // the graph only owns the depth-stencil textures, which have no bind-time transition for sampling
+        if (barrier.resource.type == RenderGraphResourceType::DepthTex && depthProvider)
+        {
+            transition(depthProvider->GetDepthTexture(barrier.resource.index));
+        }
+        else if (barrier.resource.type == RenderGraphResourceType::ShadowTex && shadowProvider)
+        {
+            transition(shadowProvider->GetDepthTexture(barrier.resource.index));
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void SceneRenderGraph::DeclareColorWrites(RenderGraph& graph, int passIndex, const std::vector<uint32_t>& drawBuffers)
+{
+    graph.WriteMask(passIndex, RenderGraphResourceType::ColorTex, RenderPassCulling::MaskFromIndices(drawBuffers));
+}
+
+// ------------------------------------------------------------------------------------------------
+void SceneRenderGraph::DeclareProgramReads(RenderGraph& graph, int passIndex, const enigma::graphic::ShaderProgram& program)
+{
+    // A depth target bound as this pass's DSV cannot also be sampled, so the program cannot read it:
+    // drop those indices instead of reporting an SRV + DSV hazard for the conservative (unscanned) masks
+    const RenderPassCulling::ProgramTextureReads& reads = RenderPassCulling::GetProgramTextureReads(program.GetName());
+    const uint32_t depthReads  = reads.depthTex & DEPTH_TEXTURE_MASK & ~graph.GetWriteMask(passIndex, RenderGraphResourceType::DepthTex);
+    const uint32_t shadowReads = reads.shadowTex & DEPTH_TEXTURE_MASK & ~graph.GetWriteMask(passIndex, RenderGraphResourceType::ShadowTex);
+    graph.ReadMask(passIndex, RenderGraphResourceType::ColorTex, reads.colorTex);
+    graph.ReadMask(passIndex, RenderGraphResourceType::DepthTex, depthReads);
+    graph.ReadMask(passIndex, RenderGraphResourceType::ShadowTex, shadowReads);
+    graph.ReadMask(passIndex, RenderGraphResourceType::ShadowColor, reads.shadowColor & DEPTH_TEXTURE_MASK);
+}
+
+// ------------------------------------------------------------------------------------------------
+void SceneRenderGraph::DeclareDepthAndShadowSampling(RenderGraph& graph, int passIndex)
+{
+    // Full-screen stages may sample depth and shadow maps through engine helpers the source scan cannot see
+    graph.ReadMask(passIndex, RenderGraphResourceType::DepthTex, DEPTH_TEXTURE_MASK);
+    graph.ReadMask(passIndex, RenderGraphResourceType::ShadowTex, DEPTH_TEXTURE_MASK);
+}
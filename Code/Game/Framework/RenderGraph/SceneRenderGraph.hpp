@@ -0,0 +1,69 @@
+/**
+ * @file SceneRenderGraph.hpp
+ * @brief Builds the RenderGraph from the active SceneRenderPass list and applies its barriers
+ * @date 2026-10-16
+ *
+ * Each SceneRenderPass declares its target accesses in DeclareResources(). The graph is recompiled
+ * only when the executed pass list or the shader bundle changes; per frame the cost is the barrier
+ * replay around each Execute().
+ */
+
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Core/Event/MulticastDelegate.hpp"
+#include "Game/Framework/RenderGraph/RenderGraph.hpp"
+
+namespace enigma::graphic
+{
+    class ShaderBundle;
+    class ShaderProgram;
+}
+
+class SceneRenderPass;
+
+class SceneRenderGraph
+{
+public:
+    SceneRenderGraph();
+    ~SceneRenderGraph();
+    SceneRenderGraph(const SceneRenderGraph&)            = delete;
+    SceneRenderGraph& operator=(const SceneRenderGraph&) = delete;
+
+    /// Execute passes in order, applying compiled barriers before each pass and at frame end
+    void Execute(const std::vector<SceneRenderPass*>& passes);
+    void Invalidate() { m_dirty = true; }
+
+    /// Declare and compile passes without executing them; Execute() calls this when the list or bundle
+    /// changed. Also driven headlessly by SceneUnitTest_RenderGraph with the production pass list.
+    void Rebuild(const std::vector<SceneRenderPass*>& passes);
+
+    const RenderGraphCompileResult& GetCompileResult() const { return m_compiled; }
+    uint64_t                        GetCompileCount() const { return m_compileCount; }
+
+public:
+    // Declaration helpers shared by SceneRenderPass::DeclareResources overrides
+    static void DeclareColorWrites(RenderGraph& graph, int passIndex, const std::vector<uint32_t>& drawBuffers);
+    /// Skips depth/shadow indices the pass already declared as DepthWrite, so declare those first
+    static void DeclareProgramReads(RenderGraph& graph, int passIndex, const enigma::graphic::ShaderProgram& program);
+    static void DeclareDepthAndShadowSampling(RenderGraph& graph, int passIndex);
+
+    /// depthtex and shadowtex providers expose two textures each (0: live, 1: pre-translucent copy)
+    static constexpr uint32_t DEPTH_TEXTURE_MASK = 0x3u;
+
+private:
+    static void ApplyBarriers(const std::vector<RenderGraphBarrier>& barriers);
+
+    void OnShaderBundleLoaded(enigma::graphic::ShaderBundle* newBundle);
+
+private:
+    RenderGraph                   m_graph;
+    RenderGraphCompileResult      m_compiled;
+    std::vector<SceneRenderPass*> m_compiledPasses;
+    std::vector<uint16_t>         m_passTimerIds; // RenderPassTimers id per compiled pass
+    bool                          m_dirty        = true;
+    uint64_t                      m_compileCount = 0;
+
+    enigma::event::DelegateHandle m_loadedHandle = 0;
+};
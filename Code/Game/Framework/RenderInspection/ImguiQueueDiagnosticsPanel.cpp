@@ -10,7 +10,10 @@
 #include "Engine/Voxel/Chunk/MeshBuild/AsyncChunkMeshDiagnostics.hpp"
 #include "Engine/Voxel/World/World.hpp"
 #include "Game/GameCommon.hpp"
+#include "Game/Framework/Scheduling/TaskScheduler.hpp"
+#include "Game/Framework/TerrainMeshing/TerrainSectionMeshCache.hpp"
 #include "Game/Gameplay/Game.hpp"
+#include "Game/Gameplay/Generator/ChunkGenerationPipeline.hpp"
 #include "ThirdParty/imgui/imgui.h"
 #include "ThirdParty/implot/implot.h"
 
@@ -904,6 +907,22 @@ namespace
         return countersJson;
     }
 
+    // Game-side companion of AsyncChunkMeshCounters, which the engine owns
+    Json BuildSectionMeshCacheJson()
+    {
+        const TerrainSectionMeshCacheStats stats = TerrainSectionMeshCache::GetStats();
+        Json cacheJson = Json::object();
+        cacheJson["enabled"] = TerrainSectionMeshCache::GetSettings().enabled;
+        cacheJson["cacheHits"] = stats.cacheHits;
+        cacheJson["cacheMisses"] = stats.cacheMisses;
+        cacheJson["skippedEmpty"] = stats.skippedEmpty;
+        cacheJson["skippedEnclosed"] = stats.skippedEnclosed;
+        cacheJson["evictions"] = stats.evictions;
+        cacheJson["entries"] = stats.entries;
+        cacheJson["cachedQuads"] = stats.cachedQuads;
+        return cacheJson;
+    }
+
     Json BuildWorkloadSubmissionJson(const WorkloadSubmissionMatrix& matrix)
     {
         Json workloadJson = Json::object();
@@ -1627,6 +1646,7 @@ enigma::core::Json ImguiQueueDiagnosticsPanel::BuildAsyncChunkMeshAccumulatedJso
     asyncChunkMeshDiagnostics["lastWorkerMaterializationFailureReason"] = diagnostics->lastWorkerMaterializationFailureReason;
     asyncChunkMeshDiagnostics["live"] = BuildAsyncChunkMeshLiveJson(diagnostics->live);
     asyncChunkMeshDiagnostics["counters"] = BuildAsyncChunkMeshCountersJson(diagnostics->cumulative);
+    asyncChunkMeshDiagnostics["sectionMeshCache"] = BuildSectionMeshCacheJson();
 
     root["asyncChunkMeshDiagnostics"] = asyncChunkMeshDiagnostics;
     return root;
@@ -2018,6 +2038,17 @@ void ImguiQueueDiagnosticsPanel::Show()
                         static_cast<unsigned long long>(counters.partialBuildPublished),
                         static_cast<unsigned long long>(counters.refinementBuildQueued),
                         static_cast<unsigned long long>(counters.refinementBuildPublished));
+            const TerrainSectionMeshCacheStats sectionCache = TerrainSectionMeshCache::GetStats();
+            ImGui::Text("Section Mesh Cache%s: hits=%llu misses=%llu skippedEmpty=%llu skippedEnclosed=%llu",
+                        TerrainSectionMeshCache::GetSettings().enabled ? "" : " (disabled)",
+                        static_cast<unsigned long long>(sectionCache.cacheHits),
+                        static_cast<unsigned long long>(sectionCache.cacheMisses),
+                        static_cast<unsigned long long>(sectionCache.skippedEmpty),
+                        static_cast<unsigned long long>(sectionCache.skippedEnclosed));
+            ImGui::Text("Section Mesh Cache Storage: entries=%u quads=%u evictions=%llu",
+                        sectionCache.entries,
+                        sectionCache.cachedQuads,
+                        static_cast<unsigned long long>(sectionCache.evictions));
             ImGui::Text("Live Snapshot: backlog=%llu pendingDispatch=%llu activeHandles=%llu",
                         static_cast<unsigned long long>(asyncChunkMeshDiagnostics->live.queuedBacklog),
                         static_cast<unsigned long long>(asyncChunkMeshDiagnostics->live.pendingDispatchCount),
@@ -2039,6 +2070,63 @@ void ImguiQueueDiagnosticsPanel::Show()
         }
     }
 
+    if (ImGui::CollapsingHeader("Task Scheduler", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        if (!TaskScheduler::IsRunning())
+        {
+            ImGui::TextDisabled("Scheduler not running. Game tasks execute inline on the submitting thread.");
+        }
+        else
+        {
+            ImGui::Text("Threads: %u engine + %u game = %u (budget %u)",
+                        TaskScheduler::GetEngineThreadCount(),
+                        TaskScheduler::GetWorkerCount(),
+                        TaskScheduler::GetEngineThreadCount() + TaskScheduler::GetWorkerCount(),
+                        TaskScheduler::GetThreadBudget());
+            for (const EnginePoolSize& pool : TaskScheduler::GetEnginePools())
+            {
+                ImGui::Text("    engine %s: %u threads (schedule.yml %u)", pool.type.c_str(), pool.threads, pool.configuredThreads);
+            }
+            ImGui::Text("Game Workers: %u (shared by every game task type, idle workers steal)", TaskScheduler::GetWorkerCount());
+            for (size_t typeIndex = 0; typeIndex < static_cast<size_t>(TaskType::Count); ++typeIndex)
+            {
+                const TaskType      type  = static_cast<TaskType>(typeIndex);
+                const TaskTypeStats stats = TaskScheduler::GetStats(type);
+                ImGui::Text("%s [%s, reserved=%u]: queued=%u executing=%u submitted=%llu completed=%llu stolen=%llu",
+                            TaskScheduler::GetTypeName(type),
+                            TaskScheduler::GetPriorityName(stats.priority),
+                            stats.reservedWorkers,
+                            stats.queued,
+                            stats.executing,
+                            static_cast<unsigned long long>(stats.submitted),
+                            static_cast<unsigned long long>(stats.completed),
+                            static_cast<unsigned long long>(stats.stolen));
+                ImGui::Text("    wait avg=%.3f ms p95=%.3f ms | run avg=%.3f ms", stats.avgWaitMs, stats.p95WaitMs, stats.avgRunMs);
+            }
+            ImGui::TextDisabled("Wait latency covers the last 128 tasks per type; the engine pools report no per-task statistics.");
+        }
+    }
+
+    if (ImGui::CollapsingHeader("Chunk Generation Stages", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        for (size_t statusIndex = static_cast<size_t>(ChunkGenStatus::Noise); statusIndex < static_cast<size_t>(ChunkGenStatus::Count); ++statusIndex)
+        {
+            const ChunkGenStatus     status = static_cast<ChunkGenStatus>(statusIndex);
+            const ChunkGenStage&     stage  = ChunkGenerationPipeline::GetStage(status);
+            const ChunkGenStageStats stats  = ChunkGenerationPipeline::GetStageStats(status);
+            ImGui::Text("%-8s %-10s runs=%llu reused=%llu avg=%.3f ms | neighbors: radius %d at %s",
+                        stage.name,
+                        stage.protoStage ? "shared" : "chunk job",
+                        static_cast<unsigned long long>(stats.runs),
+                        static_cast<unsigned long long>(stats.reused),
+                        stats.runs > 0 ? stats.totalMs / static_cast<double>(stats.runs) : 0.0,
+                        stage.neighborRadius,
+                        stage.neighborRadius > 0 ? ChunkGenerationPipeline::GetStatusName(stage.neighborStatus) : "-");
+        }
+        ImGui::TextDisabled("Shared stages run once per chunk on whichever worker needs them first; chunk job stages run inside the engine's generation job.");
+        ImGui::TextDisabled("Reused counts stage requests already satisfied by work a neighbor triggered.");
+    }
+
     if (ImGui::CollapsingHeader("Interpretation", ImGuiTreeNodeFlags_DefaultOpen))
     {
         const uint64_t frameDedicatedSubmissions = s_frameSnapshot.computeSubmissions + s_frameSnapshot.copySubmissions;
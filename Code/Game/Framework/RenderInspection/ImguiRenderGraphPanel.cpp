@@ -0,0 +1,268 @@
+/**
+ * @file ImguiRenderGraphPanel.cpp
+ * @brief ImGui sub-panel for the compiled scene render graph (barriers, lifetimes, aliasing, validation)
+ */
+
+#include "ImguiRenderGraphPanel.hpp"
+
+#include "Game/Framework/RenderGraph/SceneRenderGraph.hpp"
+#include "ThirdParty/imgui/imgui.h"
+
+#include <string>
+
+namespace
+{
+    using enigma::core::Json;
+
+    const char* GetSeverityName(RenderGraphMessageSeverity severity)
+    {
+        switch (severity)
+        {
+        case RenderGraphMessageSeverity::Info:
+            return "Info";
+        case RenderGraphMessageSeverity::Warning:
+            return "Warning";
+        case RenderGraphMessageSeverity::Error:
+            return "Error";
+        }
+        return "Unknown";
+    }
+
+    ImVec4 GetSeverityColor(RenderGraphMessageSeverity severity)
+    {
+        switch (severity)
+        {
+        case RenderGraphMessageSeverity::Warning:
+            return ImVec4(1.0f, 0.8f, 0.2f, 1.0f);
+        case RenderGraphMessageSeverity::Error:
+            return ImVec4(1.0f, 0.35f, 0.35f, 1.0f);
+        default:
+            return ImVec4(0.7f, 0.7f, 0.7f, 1.0f);
+        }
+    }
+
+    std::string FormatBarrier(const RenderGraphBarrier& barrier)
+    {
+        return RenderGraph::GetResourceName(barrier.resource) + ": " + RenderGraph::GetAccessName(barrier.before) + " -> " +
+            RenderGraph::GetAccessName(barrier.after);
+    }
+
+    Json BuildBarrierJson(const RenderGraphBarrier& barrier)
+    {
+        Json barrierJson      = Json::object();
+        barrierJson["target"] = RenderGraph::GetResourceName(barrier.resource);
+        barrierJson["before"] = RenderGraph::GetAccessName(barrier.before);
+        barrierJson["after"]  = RenderGraph::GetAccessName(barrier.after);
+        return barrierJson;
+    }
+
+    void ShowSummary(const SceneRenderGraph& graph)
+    {
+        const RenderGraphCompileResult& result = graph.GetCompileResult();
+        ImGui::Text("Passes: %d  Compiles: %llu", static_cast<int>(result.passes.size()), static_cast<unsigned long long>(graph.GetCompileCount()));
+        ImGui::Text("Barriers: %d (per-pass baseline %d)", result.barrierCount, result.perPassBarrierCount);
+        ImGui::Text("Aliasable targets: %d in %d groups", result.aliasedTargetCount, static_cast<int>(result.aliasGroups.size()));
+        ImGui::TextDisabled("Aliasing is a plan only; color targets keep dedicated allocations.");
+    }
+
+    void ShowPasses(const RenderGraphCompileResult& result)
+    {
+        if (!ImGui::CollapsingHeader("Passes", ImGuiTreeNodeFlags_DefaultOpen))
+            return;
+
+        for (size_t i = 0; i < result.passes.size(); ++i)
+        {
+            const RenderGraphCompiledPass& pass  = result.passes[i];
+            const std::string              label = std::to_string(i) + ": " + pass.name + " (" + std::to_string(pass.barriers.size()) + " barriers)";
+            if (!ImGui::TreeNode(label.c_str()))
+                continue;
+
+            for (const RenderGraphBarrier& barrier : pass.barriers)
+            {
+                ImGui::BulletText("%s", FormatBarrier(barrier).c_str());
+            }
+            for (const RenderGraphUse& use : pass.uses)
+            {
+                ImGui::TextDisabled("%s  %s", RenderGraph::GetResourceName(use.resource).c_str(), RenderGraph::GetAccessName(use.access));
+            }
+            ImGui::TreePop();
+        }
+
+        if (!result.endOfFrameBarriers.empty() && ImGui::TreeNode("End of frame"))
+        {
+            for (const RenderGraphBarrier& barrier : result.endOfFrameBarriers)
+            {
+                ImGui::BulletText("%s", FormatBarrier(barrier).c_str());
+            }
+            ImGui::TreePop();
+        }
+    }
+
+    void ShowLifetimes(const RenderGraphCompileResult& result)
+    {
+        if (!ImGui::CollapsingHeader("Lifetimes"))
+            return;
+
+        if (!ImGui::BeginTable("RenderGraphLifetimes", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+            return;
+
+        ImGui::TableSetupColumn("Target");
+        ImGui::TableSetupColumn("First");
+        ImGui::TableSetupColumn("Last");
+        ImGui::TableSetupColumn("Flags");
+        ImGui::TableHeadersRow();
+        for (const RenderGraphLifetime& lifetime : result.lifetimes)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(RenderGraph::GetResourceName(lifetime.resource).c_str());
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", lifetime.firstPass);
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", lifetime.lastPass);
+            ImGui::TableNextColumn();
+            ImGui::Text("%s%s", lifetime.transient ? "transient " : "", lifetime.readsHistory ? "history" : "");
+        }
+        ImGui::EndTable();
+    }
+
+    void ShowAliasGroups(const RenderGraphCompileResult& result)
+    {
+        if (!ImGui::CollapsingHeader("Alias Groups"))
+            return;
+
+        if (result.aliasGroups.empty())
+        {
+            ImGui::TextDisabled("No transient targets with disjoint lifetimes.");
+            return;
+        }
+
+        for (const RenderGraphAliasGroup& group : result.aliasGroups)
+        {
+            std::string members;
+            for (const RenderGraphResource& member : group.members)
+            {
+                members += (members.empty() ? "" : ", ") + RenderGraph::GetResourceName(member);
+            }
+            ImGui::BulletText("[%s] %s", group.formatKey.empty() ? "default" : group.formatKey.c_str(), members.c_str());
+        }
+    }
+
+    void ShowMessages(const RenderGraphCompileResult& result)
+    {
+        if (!ImGui::CollapsingHeader("Validation", ImGuiTreeNodeFlags_DefaultOpen))
+            return;
+
+        if (result.messages.empty())
+        {
+            ImGui::TextDisabled("No issues.");
+            return;
+        }
+
+        for (const RenderGraphMessage& message : result.messages)
+        {
+            ImGui::TextColored(GetSeverityColor(message.severity), "[%s] %s", GetSeverityName(message.severity), message.text.c_str());
+        }
+    }
+}
+
+void ImguiRenderGraphPanel::Show(const SceneRenderGraph* graph)
+{
+    if (!graph || graph->GetCompileCount() == 0)
+    {
+        ImGui::TextDisabled("Render graph has not been compiled yet.");
+        return;
+    }
+
+    const RenderGraphCompileResult& result = graph->GetCompileResult();
+    ShowSummary(*graph);
+    ImGui::Separator();
+    ShowMessages(result);
+    ShowPasses(result);
+    ShowLifetimes(result);
+    ShowAliasGroups(result);
+}
+
+void ImguiRenderGraphPanel::CopyJsonToClipboard(const SceneRenderGraph& graph)
+{
+    const std::string json = BuildJson(graph).dump(4);
+    ImGui::SetClipboardText(json.c_str());
+}
+
+Json ImguiRenderGraphPanel::BuildJson(const SceneRenderGraph& graph)
+{
+    const RenderGraphCompileResult& result = graph.GetCompileResult();
+
+    Json root                   = Json::object();
+    root["compileCount"]        = graph.GetCompileCount();
+    root["barrierCount"]        = result.barrierCount;
+    root["perPassBarrierCount"] = result.perPassBarrierCount;
+    root["aliasedTargetCount"]  = result.aliasedTargetCount;
+
+    Json passes = Json::array();
+    for (const RenderGraphCompiledPass& pass : result.passes)
+    {
+        Json passJson    = Json::object();
+        passJson["name"] = pass.name;
+        Json barriers    = Json::array();
+        for (const RenderGraphBarrier& barrier : pass.barriers)
+        {
+            barriers.push_back(BuildBarrierJson(barrier));
+        }
+        passJson["barriers"] = barriers;
+        Json uses            = Json::object();
+        for (const RenderGraphUse& use : pass.uses)
+        {
+            uses[RenderGraph::GetResourceName(use.resource)] = RenderGraph::GetAccessName(use.access);
+        }
+        passJson["uses"] = uses;
+        passes.push_back(passJson);
+    }
+    root["passes"] = passes;
+
+    Json endOfFrame = Json::array();
+    for (const RenderGraphBarrier& barrier : result.endOfFrameBarriers)
+    {
+        endOfFrame.push_back(BuildBarrierJson(barrier));
+    }
+    root["endOfFrameBarriers"] = endOfFrame;
+
+    Json lifetimes = Json::object();
+    for (const RenderGraphLifetime& lifetime : result.lifetimes)
+    {
+        Json lifetimeJson            = Json::object();
+        lifetimeJson["firstPass"]    = lifetime.firstPass;
+        lifetimeJson["lastPass"]     = lifetime.lastPass;
+        lifetimeJson["readsHistory"] = lifetime.readsHistory;
+        lifetimeJson["transient"]    = lifetime.transient;
+        lifetimes[RenderGraph::GetResourceName(lifetime.resource)] = lifetimeJson;
+    }
+    root["lifetimes"] = lifetimes;
+
+    Json aliasGroups = Json::array();
+    for (const RenderGraphAliasGroup& group : result.aliasGroups)
+    {
+        Json groupJson      = Json::object();
+        groupJson["format"] = group.formatKey;
+        Json members        = Json::array();
+        for (const RenderGraphResource& member : group.members)
+        {
+            members.push_back(RenderGraph::GetResourceName(member));
+        }
+        groupJson["members"] = members;
+        aliasGroups.push_back(groupJson);
+    }
+    root["aliasGroups"] = aliasGroups;
+
+    Json messages = Json::array();
+    for (const RenderGraphMessage& message : result.messages)
+    {
+        Json messageJson         = Json::object();
+        messageJson["severity"]  = GetSeverityName(message.severity);
+        messageJson["passIndex"] = message.passIndex;
+        messageJson["text"]      = message.text;
+        messages.push_back(messageJson);
+    }
+    root["messages"] = messages;
+    return root;
+}
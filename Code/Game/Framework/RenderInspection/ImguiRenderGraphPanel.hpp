@@ -0,0 +1,23 @@
+/**
+ * @file ImguiRenderGraphPanel.hpp
+ * @brief ImGui sub-panel for the compiled scene render graph (barriers, lifetimes, aliasing, validation)
+ */
+
+#pragma once
+
+#include "Engine/Core/Json.hpp"
+
+class SceneRenderGraph;
+
+class ImguiRenderGraphPanel
+{
+public:
+    ImguiRenderGraphPanel()                                       = delete;
+    ImguiRenderGraphPanel(const ImguiRenderGraphPanel&)            = delete;
+    ImguiRenderGraphPanel& operator=(const ImguiRenderGraphPanel&) = delete;
+
+    static void Show(const SceneRenderGraph* graph);
+    static void CopyJsonToClipboard(const SceneRenderGraph& graph);
+
+    static enigma::core::Json BuildJson(const SceneRenderGraph& graph);
+};
@@ -0,0 +1,112 @@
+/**
+ * @file ImguiRenderPassTimingPanel.cpp
+ * @brief ImGui sub-panel for per-pass CPU timings (last, average and percentiles over the frame ring)
+ */
+
+#include "ImguiRenderPassTimingPanel.hpp"
+
+#include "Game/Framework/RenderPass/RenderPassTimers.hpp"
+#include "ThirdParty/imgui/imgui.h"
+
+#include <string>
+
+namespace
+{
+    using enigma::core::Json;
+
+    bool s_executeOnly = false;
+}
+
+void ImguiRenderPassTimingPanel::Show()
+{
+    const std::vector<RenderPassTimingStats> stats = RenderPassTimers::BuildStats();
+
+    ImGui::Checkbox("Execute only", &s_executeOnly);
+    ImGui::SameLine();
+    if (ImGui::Button("Reset"))
+    {
+        RenderPassTimers::Reset();
+    }
+    ImGui::SameLine();
+    ImGui::TextDisabled("CPU ms, last %d frames", RenderPassTimers::FRAME_HISTORY - 1);
+
+    if (stats.empty())
+    {
+        ImGui::TextDisabled("No pass timings recorded yet.");
+        return;
+    }
+
+    const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp;
+    if (!ImGui::BeginTable("RenderPassTimings", 8, flags))
+        return;
+
+    ImGui::TableSetupColumn("Pass");
+    ImGui::TableSetupColumn("Phase");
+    ImGui::TableSetupColumn("Last");
+    ImGui::TableSetupColumn("Avg");
+    ImGui::TableSetupColumn("P50");
+    ImGui::TableSetupColumn("P95");
+    ImGui::TableSetupColumn("P99");
+    ImGui::TableSetupColumn("Max");
+    ImGui::TableHeadersRow();
+
+    double executeTotalMs = 0.0;
+    for (const RenderPassTimingStats& entry : stats)
+    {
+        if (entry.phase == RenderPassTimerPhase::Execute)
+            executeTotalMs += entry.avgMs;
+        if (s_executeOnly && entry.phase != RenderPassTimerPhase::Execute)
+            continue;
+
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(entry.passName.c_str());
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(RenderPassTimers::GetPhaseName(entry.phase));
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", entry.lastMs);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", entry.avgMs);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", entry.p50Ms);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", entry.p95Ms);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", entry.p99Ms);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", entry.maxMs);
+    }
+    ImGui::EndTable();
+
+    ImGui::Text("Scene passes (avg Execute sum): %.3f ms", executeTotalMs);
+}
+
+void ImguiRenderPassTimingPanel::CopyJsonToClipboard()
+{
+    const std::string json = BuildJson().dump(4);
+    ImGui::SetClipboardText(json.c_str());
+}
+
+Json ImguiRenderPassTimingPanel::BuildJson()
+{
+    Json root            = Json::object();
+    root["frameHistory"] = RenderPassTimers::FRAME_HISTORY - 1;
+
+    // passTimings.<pass>.<phase> = stats; operator[] creates the per-pass objects on first use
+    Json passTimings = Json::object();
+
+    for (const RenderPassTimingStats& entry : RenderPassTimers::BuildStats())
+    {
+        Json phaseJson           = Json::object();
+        phaseJson["sampleCount"] = entry.sampleCount;
+        phaseJson["lastMs"]      = entry.lastMs;
+        phaseJson["avgMs"]       = entry.avgMs;
+        phaseJson["p50Ms"]       = entry.p50Ms;
+        phaseJson["p95Ms"]       = entry.p95Ms;
+        phaseJson["p99Ms"]       = entry.p99Ms;
+        phaseJson["maxMs"]       = entry.maxMs;
+        passTimings[entry.passName][RenderPassTimers::GetPhaseName(entry.phase)] = phaseJson;
+    }
+    root["passTimings"] = passTimings;
+    return root;
+}
@@ -0,0 +1,21 @@
+/**
+ * @file ImguiRenderPassTimingPanel.hpp
+ * @brief ImGui sub-panel for per-pass CPU timings (last, average and percentiles over the frame ring)
+ */
+
+#pragma once
+
+#include "Engine/Core/Json.hpp"
+
+class ImguiRenderPassTimingPanel
+{
+public:
+    ImguiRenderPassTimingPanel()                                             = delete;
+    ImguiRenderPassTimingPanel(const ImguiRenderPassTimingPanel&)            = delete;
+    ImguiRenderPassTimingPanel& operator=(const ImguiRenderPassTimingPanel&) = delete;
+
+    static void Show();
+    static void CopyJsonToClipboard();
+
+    static enigma::core::Json BuildJson();
+};
@@ -18,6 +18,7 @@
 #include "Game/GameCommon.hpp"
 #include "Game/Framework/Camera/GameCameraDebugState.hpp"
 #include "Game/Framework/GameObject/Geometry.hpp"
+#include "Game/Framework/OcclusionCulling/ChunkOcclusionCuller.hpp"
 #include "Game/Framework/RenderPass/ConstantBuffer/CommonConstantBuffer.hpp"
 #include "Game/Framework/RenderPass/RenderChunkBaching/ChunkBachingDebugViewState.hpp"
 #include "Game/Framework/RenderPass/WorldRenderingPhase.hpp"
@@ -133,7 +134,7 @@ void ChunkBachingRenderPass::Execute()
         return;
     }
 
-    BeginPass();
+    TimedBeginPass();
     if (shouldDrawRegionWireframe && RebuildRegionDebugGeometry())
     {
         m_regionBoundsGeometry->Render();
@@ -143,7 +144,7 @@ void ChunkBachingRenderPass::Execute()
         g_theRendererSubsystem->SetRasterizationConfig(RasterizationConfig::NoCull());
         m_playerCameraFrustumGeometry->Render();
     }
-    EndPass();
+    TimedEndPass();
 }
 
 void ChunkBachingRenderPass::BeginPass()
@@ -247,5 +248,10 @@ Rgba8 ChunkBachingRenderPass::GetRegionDebugColor(const enigma::voxel::ChunkRend
         return Rgba8::RED;
     }
 
+    if (ChunkOcclusionCuller::IsOccluded(region.geometry.worldBounds))
+    {
+        return Rgba8::ORANGE;
+    }
+
     return Rgba8::GREEN;
 }
@@ -0,0 +1,176 @@
+/**
+ * @file ChunkRegionRebuildBudget.cpp
+ * @brief Time-based adaptive budget for dirty chunk render region rebuilds
+ * @date 2026-10-16
+ */
+
+#include "ChunkRegionRebuildBudget.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Engine/Core/Yaml.hpp"
+#include "Engine/Graphic/Camera/PerspectiveCamera.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/Frustum.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Engine/Voxel/Chunk/ChunkRenderRegionStorage.hpp"
+#include "Engine/Voxel/World/World.hpp"
+#include "Game/Framework/OcclusionCulling/ChunkOcclusionCuller.hpp"
+
+using namespace enigma::core;
+
+ChunkRegionRebuildBudgetSettings ChunkRegionRebuildBudget::s_settings;
+float                            ChunkRegionRebuildBudget::s_regionCostMs           = 0.5f; // First guess until a rebuild frame is measured
+float                            ChunkRegionRebuildBudget::s_baselineMs             = 0.0f;
+float                            ChunkRegionRebuildBudget::s_currentSliceMs         = 0.0f;
+uint32_t                         ChunkRegionRebuildBudget::s_currentBudget          = 0;
+uint32_t                         ChunkRegionRebuildBudget::s_visibleDirtyRegions    = 0;
+uint32_t                         ChunkRegionRebuildBudget::s_culledDirtyRegions     = 0;
+uint32_t                         ChunkRegionRebuildBudget::s_urgentDirtyRegions     = 0;
+uint32_t                         ChunkRegionRebuildBudget::s_costSampleCount        = 0;
+bool                             ChunkRegionRebuildBudget::s_spiking                = false;
+bool                             ChunkRegionRebuildBudget::s_overridingEngineBudget = false;
+uint32_t                         ChunkRegionRebuildBudget::s_engineBudget           = 0;
+
+namespace
+{
+    constexpr uint32_t COST_WINDOW             = 64;   // Frames in the least-squares cost fit
+    constexpr float    MIN_REBUILD_VARIANCE    = 0.25f; // Rebuild counts must vary for the slope to mean anything
+    constexpr float    MIN_REGION_COST_MS      = 0.01f;
+
+    struct UpdateSample
+    {
+        float rebuilds = 0.0f;
+        float updateMs = 0.0f;
+    };
+
+    UpdateSample s_costSamples[COST_WINDOW];
+    uint32_t     s_nextCostSample = 0;
+
+    float DistanceToBounds(const Vec3& point, const AABB3& bounds)
+    {
+        const float dx = std::max({bounds.m_mins.x - point.x, 0.0f, point.x - bounds.m_maxs.x});
+        const float dy = std::max({bounds.m_mins.y - point.y, 0.0f, point.y - bounds.m_maxs.y});
+        const float dz = std::max({bounds.m_mins.z - point.z, 0.0f, point.z - bounds.m_maxs.z});
+        return std::sqrt(dx * dx + dy * dy + dz * dz);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void ChunkRegionRebuildBudget::LoadSettings(const YamlConfiguration& config)
+{
+    s_settings.adaptive         = config.GetBoolean("performance.regionRebuild.adaptive", s_settings.adaptive);
+    s_settings.sliceMs          = config.GetFloat("performance.regionRebuild.sliceMs", s_settings.sliceMs);
+    s_settings.headroomShare    = config.GetFloat("performance.regionRebuild.headroomShare", s_settings.headroomShare);
+    s_settings.spikeRatio       = config.GetFloat("performance.regionRebuild.spikeRatio", s_settings.spikeRatio);
+    s_settings.spikeSliceScale  = config.GetFloat("performance.regionRebuild.spikeSliceScale", s_settings.spikeSliceScale);
+    s_settings.culledSliceScale = config.GetFloat("performance.regionRebuild.culledSliceScale", s_settings.culledSliceScale);
+    s_settings.urgentDistance   = config.GetFloat("performance.regionRebuild.urgentDistance", s_settings.urgentDistance);
+    s_settings.minPerFrame      = static_cast<uint32_t>(std::max(config.GetInt("performance.regionRebuild.minPerFrame", static_cast<int>(s_settings.minPerFrame)), 0));
+    s_settings.maxPerFrame      = static_cast<uint32_t>(std::max(config.GetInt("performance.regionRebuild.maxPerFrame", static_cast<int>(s_settings.maxPerFrame)), 1));
+
+    const int targetFps      = config.GetInt("video.targetFPS", 60);
+    s_settings.targetFrameMs = targetFps > 0 ? 1000.0f / static_cast<float>(targetFps) : s_settings.targetFrameMs;
+
+    s_settings.minPerFrame = std::min(s_settings.minPerFrame, s_settings.maxPerFrame);
+}
+
+// ------------------------------------------------------------------------------------------------
+void ChunkRegionRebuildBudget::Update(enigma::voxel::World& world, const enigma::graphic::PerspectiveCamera* cullingCamera, float frameSeconds, double worldUpdateMs)
+{
+    // [STEP 1] Cost model: least-squares fit of update time against rebuild count over the window
+    s_costSamples[s_nextCostSample] = {static_cast<float>(world.GetChunkBatchStats().dirtyRegionRebuilds), static_cast<float>(worldUpdateMs)};
+    s_nextCostSample                = (s_nextCostSample + 1) % COST_WINDOW;
+    s_costSampleCount               = std::min(s_costSampleCount + 1, COST_WINDOW);
+
+    float sumRebuilds = 0.0f;
+    float sumMs       = 0.0f;
+    for (uint32_t i = 0; i < s_costSampleCount; ++i)
+    {
+        sumRebuilds += s_costSamples[i].rebuilds;
+        sumMs       += s_costSamples[i].updateMs;
+    }
+    const float meanRebuilds = sumRebuilds / static_cast<float>(s_costSampleCount);
+    const float meanMs       = sumMs / static_cast<float>(s_costSampleCount);
+    float       covariance   = 0.0f;
+    float       variance     = 0.0f;
+    for (uint32_t i = 0; i < s_costSampleCount; ++i)
+    {
+        const float rebuildDelta = s_costSamples[i].rebuilds - meanRebuilds;
+        covariance += rebuildDelta * (s_costSamples[i].updateMs - meanMs);
+        variance   += rebuildDelta * rebuildDelta;
+    }
+    // A constant rebuild count (idle, or pinned at the budget) keeps the last fitted cost
+    if (variance > MIN_REBUILD_VARIANCE * static_cast<float>(s_costSampleCount))
+    {
+        s_regionCostMs = std::max(covariance / variance, MIN_REGION_COST_MS);
+    }
+    s_baselineMs = std::max(meanMs - s_regionCostMs * meanRebuilds, 0.0f);
+
+    // [STEP 2] Visible / culled split of the dirty regions (occlusion from the last rendered frame); the engine queue still picks the order
+    Frustum    frustum;
+    const bool hasFrustum = cullingCamera && cullingCamera->GetFrustum(frustum);
+    const Vec3 viewPoint  = cullingCamera ? cullingCamera->GetPosition() : Vec3();
+    s_visibleDirtyRegions = 0;
+    s_urgentDirtyRegions  = 0;
+    s_culledDirtyRegions  = 0;
+    for (const auto& regionEntry : world.GetChunkRenderRegionStorage().GetRegions())
+    {
+        const auto& region = regionEntry.second;
+        if (!region.dirty)
+            continue;
+        const AABB3& bounds = region.geometry.worldBounds;
+        if ((hasFrustum && !frustum.IsOverlapping(bounds)) || ChunkOcclusionCuller::IsOccluded(bounds))
+        {
+            ++s_culledDirtyRegions;
+            continue;
+        }
+        ++s_visibleDirtyRegions;
+        if (!cullingCamera || DistanceToBounds(viewPoint, bounds) <= s_settings.urgentDistance)
+            ++s_urgentDirtyRegions;
+    }
+
+    // Not adaptive: leave the engine's count alone, restoring it if the adaptive budget replaced it
+    if (!s_settings.adaptive)
+    {
+        if (s_overridingEngineBudget)
+        {
+            world.SetMaxChunkBatchRegionRebuildsPerFrame(s_engineBudget);
+            s_overridingEngineBudget = false;
+        }
+        s_currentSliceMs = 0.0f;
+        s_currentBudget  = world.GetMaxChunkBatchRegionRebuildsPerFrame();
+        s_spiking        = false;
+        return;
+    }
+    if (!s_overridingEngineBudget)
+    {
+        s_engineBudget           = world.GetMaxChunkBatchRegionRebuildsPerFrame();
+        s_overridingEngineBudget = true;
+    }
+
+    // [STEP 3] Slice: spend part of the headroom, back off during spikes
+    const float frameMs = frameSeconds * 1000.0f;
+    float       sliceMs = s_settings.sliceMs;
+    s_spiking           = frameMs > s_settings.targetFrameMs * s_settings.spikeRatio;
+    if (s_spiking)
+    {
+        sliceMs *= s_settings.spikeSliceScale;
+    }
+    else if (frameMs < s_settings.targetFrameMs)
+    {
+        sliceMs += (s_settings.targetFrameMs - frameMs) * s_settings.headroomShare;
+    }
+    if (s_visibleDirtyRegions == 0)
+    {
+        sliceMs *= s_settings.culledSliceScale;
+    }
+    s_currentSliceMs = sliceMs;
+
+    // [STEP 4] Budget for the next World::Update; nearby visible regions are never held back by the slice
+    const float    regions = std::floor(sliceMs / std::max(s_regionCostMs, MIN_REGION_COST_MS));
+    const uint32_t budget  = regions > static_cast<float>(s_settings.maxPerFrame) ? s_settings.maxPerFrame : static_cast<uint32_t>(regions);
+    s_currentBudget        = std::clamp(std::max(budget, s_urgentDirtyRegions), s_settings.minPerFrame, s_settings.maxPerFrame);
+    world.SetMaxChunkBatchRegionRebuildsPerFrame(s_currentBudget);
+}
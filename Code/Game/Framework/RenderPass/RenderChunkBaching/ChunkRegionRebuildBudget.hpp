@@ -0,0 +1,99 @@
+/**
+ * @file ChunkRegionRebuildBudget.hpp
+ * @brief Time-based adaptive budget for dirty chunk render region rebuilds
+ * @date 2026-10-16
+ *
+ * The world rebuilds at most GetMaxChunkBatchRegionRebuildsPerFrame() dirty regions per frame. A fixed
+ * count is too slow right after a world load and hitches when many large regions go dirty together.
+ *
+ * ChunkRegionRebuildBudget turns a per-frame time slice into that count every frame:
+ *   - the cost of one region rebuild (including upload) is the slope of a least-squares fit of
+ *     World::Update time against the rebuilds done in that frame, over the last COST_WINDOW frames.
+ *     The fit's intercept is the update time without rebuilds, so chunk generation and other update
+ *     work that does not scale with the rebuild count drops out of the per-region cost
+ *   - the slice grows with frame headroom below the target frame time and shrinks during spikes
+ *   - the dirty regions are counted as visible (frustum and occlusion culling of the last rendered
+ *     frame) or culled
+ *   - visible dirty regions within urgentDistance keep the budget at least as large as their count,
+ *     even during spikes, because they are stale geometry on screen next to the player
+ *   - when every dirty region is culled only part of the slice is spent, so culled work never takes
+ *     time that visible regions will need when they go dirty
+ *
+ * Only the count is controlled here. The engine rebuilds dirty regions from its own queue inside
+ * World::Update and exposes neither the queue order nor a timer around the rebuild step, so visible
+ * regions are not moved ahead of culled ones; the visible / culled split only scales the slice, and
+ * the cost is fitted from whole-update timings rather than read from the rebuild itself.
+ *
+ * Off by default. When not adaptive the engine's own per-frame count is left alone; the value the
+ * world had before the first adaptive frame is restored when adaptive is switched off at runtime.
+ *
+ * Configuration Path: Run/.enigma/settings.yml -> performance.regionRebuild
+ */
+
+#pragma once
+#include <cstdint>
+
+#include "Engine/Core/Yaml.hpp"
+
+namespace enigma::voxel
+{
+    class World;
+}
+
+namespace enigma::graphic
+{
+    class PerspectiveCamera;
+}
+
+struct ChunkRegionRebuildBudgetSettings
+{
+    bool     adaptive         = false;
+    float    sliceMs          = 2.0f;   // Rebuild time per frame at the target frame time
+    float    headroomShare    = 0.5f;   // Share of the unused frame time added to the slice
+    float    spikeRatio       = 1.25f;  // Frames slower than target * spikeRatio count as spikes
+    float    spikeSliceScale  = 0.25f;  // Slice multiplier during spikes
+    float    culledSliceScale = 0.5f;   // Slice multiplier when no dirty region is visible
+    float    urgentDistance   = 64.0f;  // Visible dirty regions closer than this (blocks) are never held back
+    uint32_t minPerFrame      = 1;
+    uint32_t maxPerFrame      = 32;
+    float    targetFrameMs    = 16.67f; // Derived from video.targetFPS
+};
+
+class ChunkRegionRebuildBudget
+{
+public:
+    ChunkRegionRebuildBudget()                                           = delete; // Prevent instantiation
+    ChunkRegionRebuildBudget(const ChunkRegionRebuildBudget&)            = delete; // Prevent copy
+    ChunkRegionRebuildBudget& operator=(const ChunkRegionRebuildBudget&) = delete; // Prevent assignment
+
+    static void LoadSettings(const enigma::core::YamlConfiguration& config);
+
+    /// After World::Update: feed the measured update time and, when adaptive, apply the budget for the next frame
+    static void Update(enigma::voxel::World& world, const enigma::graphic::PerspectiveCamera* cullingCamera, float frameSeconds, double worldUpdateMs);
+
+    static float    GetEstimatedRegionCostMs() { return s_regionCostMs; }
+    static float    GetBaselineUpdateMs() { return s_baselineMs; }
+    static float    GetCurrentSliceMs() { return s_currentSliceMs; }
+    static uint32_t GetCurrentBudget() { return s_currentBudget; }
+    static uint32_t GetVisibleDirtyRegions() { return s_visibleDirtyRegions; }
+    static uint32_t GetCulledDirtyRegions() { return s_culledDirtyRegions; }
+    static uint32_t GetUrgentDirtyRegions() { return s_urgentDirtyRegions; }
+    static uint32_t GetCostSampleCount() { return s_costSampleCount; }
+    static bool     IsSpiking() { return s_spiking; }
+
+    static ChunkRegionRebuildBudgetSettings& GetSettings() { return s_settings; }
+
+private:
+    static ChunkRegionRebuildBudgetSettings s_settings;
+    static float                            s_regionCostMs;
+    static float                            s_baselineMs;
+    static float                            s_currentSliceMs;
+    static uint32_t                         s_currentBudget;
+    static uint32_t                         s_visibleDirtyRegions;
+    static uint32_t                         s_culledDirtyRegions;
+    static uint32_t                         s_urgentDirtyRegions;
+    static uint32_t                         s_costSampleCount;
+    static bool                             s_spiking;
+    static bool                             s_overridingEngineBudget;
+    static uint32_t                         s_engineBudget;
+};
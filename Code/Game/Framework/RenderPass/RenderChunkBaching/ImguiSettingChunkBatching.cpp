@@ -5,6 +5,7 @@
 
 #include "ImguiSettingChunkBatching.hpp"
 #include "ChunkBachingRenderPass.hpp"
+#include "ChunkRegionRebuildBudget.hpp"
 
 #include <cmath>
 #include <functional>
@@ -16,8 +17,11 @@
 #include "Engine/Voxel/World/World.hpp"
 #include "Game/GameCommon.hpp"
 #include "Game/Framework/Camera/GameCameraDebugState.hpp"
+#include "Game/Framework/DistantTerrain/DistantTerrainLod.hpp"
+#include "Game/Framework/OcclusionCulling/ChunkOcclusionCuller.hpp"
 #include "Game/Gameplay/Game.hpp"
 #include "Game/Framework/RenderPass/RenderChunkBaching/ChunkBachingDebugViewState.hpp"
+#include "Game/Framework/RenderPass/RenderTerrain/PackedTerrainVertex.hpp"
 #include "ThirdParty/imgui/imgui.h"
 
 namespace
@@ -314,6 +318,7 @@ namespace
         }
 
         ImGui::TextDisabled("White = player camera frustum used for culling. Cyan = detached debug camera used for observation.");
+        ImGui::TextDisabled("Regions: red = outside the frustum, orange = occluded, green = drawn.");
     }
 
     float ComputeCullRatio(uint32_t visibleCount, uint32_t culledCount)
@@ -747,6 +752,23 @@ void ImguiSettingChunkBatching::Show(enigma::voxel::World* world)
         ImGui::Text("Loaded Chunks: %u", batchingSnapshot.loadedChunks);
         ImGui::Text("Queued Dirty Regions: %u", world->GetChunkRenderRegionStorage().GetDirtyRegionCount());
         ImGui::Text("Dirty Region Budget: %u", world->GetMaxChunkBatchRegionRebuildsPerFrame());
+        ChunkRegionRebuildBudgetSettings& budgetSettings = ChunkRegionRebuildBudget::GetSettings();
+        ImGui::Checkbox("Adaptive Rebuild Budget", &budgetSettings.adaptive);
+        if (budgetSettings.adaptive)
+        {
+            ImGui::SliderFloat("Rebuild Slice (ms)", &budgetSettings.sliceMs, 0.25f, 8.0f, "%.2f");
+            ImGui::Text("Current Slice: %.2f ms%s", ChunkRegionRebuildBudget::GetCurrentSliceMs(), ChunkRegionRebuildBudget::IsSpiking() ? " (frame spike)" : "");
+            ImGui::SliderFloat("Urgent Distance", &budgetSettings.urgentDistance, 0.0f, 256.0f, "%.0f");
+            ImGui::Text("Measured Cost: %.3f ms / region (update without rebuilds %.3f ms, %u frames)",
+                ChunkRegionRebuildBudget::GetEstimatedRegionCostMs(),
+                ChunkRegionRebuildBudget::GetBaselineUpdateMs(),
+                ChunkRegionRebuildBudget::GetCostSampleCount());
+        }
+        ImGui::Text("Dirty Regions: %u visible (%u urgent) / %u culled",
+            ChunkRegionRebuildBudget::GetVisibleDirtyRegions(),
+            ChunkRegionRebuildBudget::GetUrgentDirtyRegions(),
+            ChunkRegionRebuildBudget::GetCulledDirtyRegions());
+        ImGui::TextDisabled("The engine queue picks which dirty regions rebuild; the adaptive budget only sets how many.");
         ImGui::TextDisabled("Chunk batching is always enabled.");
         ImGui::TextDisabled("Legacy per-chunk submission has been removed from runtime.");
         ImGui::TextWrapped("Direct precise submission consumes exact sub-draw ranges while dirty regions keep the last committed region geometry until rebuilt buffers are ready.");
@@ -757,6 +779,22 @@ void ImguiSettingChunkBatching::Show(enigma::voxel::World* world)
         ImGui::Text("Visible Chunks: %u", stats.visibleChunks);
         ImGui::Text("Main Visible Regions: %u", stats.visibleRegions);
         ImGui::Text("Main Culled Regions: %u", stats.culledRegions);
+        ImGui::Checkbox("Software Occlusion Culling", &ChunkOcclusionCuller::GetSettings().enabled);
+        if (ChunkOcclusionCuller::GetSettings().enabled)
+        {
+            const ChunkOcclusionStats& occlusionStats = ChunkOcclusionCuller::GetStats();
+            ImGui::Text("Main Occluded Regions: %u / %u frustum-visible",
+                occlusionStats.occludedRegions,
+                occlusionStats.testedRegions);
+            ImGui::Text("Occluders: %u boxes rasterized (%u triangles), %u boxes in %u chunks",
+                occlusionStats.rasterizedOccluders,
+                occlusionStats.rasterizedTriangles,
+                occlusionStats.occluderBoxes,
+                occlusionStats.occluderChunks);
+            ImGui::Text("Occlusion Cost: %.3f ms raster / %.3f ms test",
+                occlusionStats.rasterMs,
+                occlusionStats.testMs);
+        }
         ImGui::Text("Shadow Visible Regions: %u", stats.shadowVisibleRegions);
         ImGui::Text("Shadow Culled Regions: %u", stats.shadowCulledRegions);
         ImGui::Text("Exact Batched Draws: %u", stats.batchedDraws);
@@ -802,10 +840,37 @@ void ImguiSettingChunkBatching::Show(enigma::voxel::World* world)
             vertexArenaUsed,
             batchingSnapshot.vertexArenaCapacity,
             batchingSnapshot.vertexArenaRemaining);
+        ImGui::Text("Vertex Arena Memory: %.1f MB used (%.1f MB as PackedTerrainVertex)",
+            static_cast<double>(vertexArenaUsed) * PackedTerrainVertex::FULL_VERTEX_BYTES / (1024.0 * 1024.0),
+            static_cast<double>(vertexArenaUsed) * sizeof(PackedTerrainVertex) / (1024.0 * 1024.0));
+        if (ImGui::IsItemHovered())
+        {
+            ImGui::SetTooltip("54-byte TerrainVertex vs the 20-byte packed format, an estimate: the engine mesher only writes TerrainVertex");
+        }
         ImGui::Text("Index Arena: %u used / %u total (%u free)",
             indexArenaUsed,
             batchingSnapshot.indexArenaCapacity,
             batchingSnapshot.indexArenaRemaining);
+        if (DistantTerrainLod::IsEnabled())
+        {
+            const DistantTerrainStats lodStats = DistantTerrainLod::GetStats();
+            ImGui::Text("Distant Terrain: %u regions (%u meshed, %u sampling), %u drawn / %u culled",
+                lodStats.regions,
+                lodStats.regionsWithMesh,
+                lodStats.pendingSamples,
+                lodStats.drawnRegions,
+                lodStats.culledRegions);
+            ImGui::Text("Distant Terrain Faces: %u drawn / %u back-facing",
+                lodStats.drawnFaceMeshes,
+                lodStats.backFaceMeshes);
+            ImGui::Text("Distant Terrain Memory: %llu vertices, %.1f MB in %u meshes",
+                static_cast<unsigned long long>(lodStats.vertices),
+                static_cast<double>(lodStats.vertexBytes) / (1024.0 * 1024.0),
+                lodStats.uniqueMeshes);
+            ImGui::Text("Distant Terrain Mesh Builds: %llu built / %llu reused from identical regions",
+                static_cast<unsigned long long>(lodStats.meshBuilds),
+                static_cast<unsigned long long>(lodStats.meshReuses));
+        }
         ImGui::Separator();
         ImGui::Text("Vertex Relocation: %u grows / %u relocations / %u relocated elements (lifetime)",
             vertexDiagnostics.growCountLifetime,
@@ -870,3 +935,13 @@ void ImguiSettingChunkBatching::CopyLifetimeSnapshotToClipboard(const enigma::vo
     CopyChunkBatchLifetimeDebugInfoToClipboard(world);
     RecordChunkBatchCopy("Lifetime snapshot copied.");
 }
+
+std::string ImguiSettingChunkBatching::BuildFrameSnapshotJson(const enigma::voxel::World& world)
+{
+    return BuildChunkBatchFrameDebugInfo(world);
+}
+
+std::string ImguiSettingChunkBatching::BuildLifetimeSnapshotJson(const enigma::voxel::World& world)
+{
+    return BuildChunkBatchLifetimeDebugInfo(world);
+}
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <string>
+
 namespace enigma::voxel
 {
     class World;
@@ -21,4 +23,8 @@ public:
     static void CopyFullSnapshotToClipboard(const enigma::voxel::World& world);
     static void CopyFrameSnapshotToClipboard(const enigma::voxel::World& world);
     static void CopyLifetimeSnapshotToClipboard(const enigma::voxel::World& world);
+
+    // Same JSON text the copy actions place on the clipboard (used by PerfCapture)
+    static std::string BuildFrameSnapshotJson(const enigma::voxel::World& world);
+    static std::string BuildLifetimeSnapshotJson(const enigma::voxel::World& world);
 };
@@ -31,6 +31,7 @@
 #include "Engine/Graphic/Shader/Uniform/PerObjectUniforms.hpp"
 #include "Engine/Graphic/Shader/Uniform/UniformManager.hpp"
 #include "Game/GameCommon.hpp"
+#include "Game/Framework/RenderGraph/SceneRenderGraph.hpp"
 #include "Game/Gameplay/Game.hpp"
 #include "Game/Framework/GameObject/PlayerCharacter.hpp"
 #include <cmath>
@@ -156,7 +157,7 @@ void CloudRenderPass::Execute()
         return;
     }
 
-    BeginPass();
+    TimedBeginPass();
 
     // [IMPORTANT] ModelMatrix Calculation
     // Geometry is in LOCAL space [-radius*12, +radius*12], must translate to WORLD space.
@@ -189,7 +190,7 @@ void CloudRenderPass::Execute()
     g_theRendererSubsystem->UseProgram(m_cloudsShader, {{RenderTargetType::ColorTex, 0}, {RenderTargetType::ColorTex, 3}, {RenderTargetType::DepthTex, 0}});
     g_theRendererSubsystem->DrawVertexBuffer(m_gpuVertexBuffer);
 
-    EndPass();
+    TimedEndPass();
 }
 
 void CloudRenderPass::OnShaderBundleLoaded(enigma::graphic::ShaderBundle* newBundle)
@@ -276,3 +277,15 @@ void CloudRenderPass::SetRenderMode(CloudStatus mode)
         m_needsRebuild = true;
     }
 }
+
+void CloudRenderPass::DeclareResources(RenderGraph& graph) const
+{
+    int pass = graph.AddPass("clouds");
+    graph.Write(pass, {RenderGraphResourceType::ColorTex, 0});
+    graph.Write(pass, {RenderGraphResourceType::ColorTex, 3});
+    graph.Write(pass, {RenderGraphResourceType::DepthTex, 0});
+    if (m_cloudsShader)
+    {
+        SceneRenderGraph::DeclareProgramReads(graph, pass, *m_cloudsShader);
+    }
+}
@@ -206,6 +206,7 @@ public:
 public:
     // [REQUIRED] SceneRenderPass interface implementation
     void Execute() override;
+    void DeclareResources(RenderGraph& graph) const override;
 
 protected:
     void OnShaderBundleLoaded(enigma::graphic::ShaderBundle* newBundle) override;
@@ -1,5 +1,6 @@
 ﻿#include "CompositeRenderPass.hpp"
 
+#include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/VertexUtils.hpp"
 #include "Engine/Graphic/Bundle/ShaderBundle.hpp"
 #include "Engine/Graphic/Bundle/Integration/ShaderBundleSubsystem.hpp"
@@ -10,16 +11,17 @@
 #include "Engine/Graphic/Target/D12RenderTarget.hpp"
 #include "Engine/Graphic/Target/ColorTextureProvider.hpp"
 #include "Engine/Graphic/Target/RenderTargetProviderCommon.hpp"
-#include "Engine/Graphic/Target/DepthTextureProvider.hpp"
-#include "Engine/Graphic/Target/ShadowTextureProvider.hpp"
 #include "Game/GameCommon.hpp"
+#include "Game/Framework/RenderGraph/SceneRenderGraph.hpp"
 #include "Game/Framework/RenderPass/ConstantBuffer/CommonConstantBuffer.hpp"
+#include "Game/Framework/RenderPass/RenderPassCulling.hpp"
 #include "Game/Framework/RenderPass/RenderPassHelper.hpp"
 #include "Game/Gameplay/Game.hpp"
 
 CompositeRenderPass::CompositeRenderPass()
 {
     m_shaderPrograms = g_theShaderBundleSubsystem->GetCurrentShaderBundle()->GetPrograms("composite.*");
+    rebuildProgramPlans();
 }
 
 CompositeRenderPass::~CompositeRenderPass()
@@ -28,7 +30,7 @@ CompositeRenderPass::~CompositeRenderPass()
 
 void CompositeRenderPass::Execute()
 {
-    BeginPass();
+    TimedBeginPass();
 
     bool hasProgramScope = false;
     auto beginProgramScope = [this, &hasProgramScope](const char* debugName)
@@ -44,9 +46,11 @@ void CompositeRenderPass::Execute()
         g_theRendererSubsystem->GetUniformManager()->UploadBuffer(COMMON_UNIFORM);
     };
 
-    for (auto program : m_shaderPrograms)
+    for (size_t i = 0; i < m_shaderPrograms.size(); ++i)
     {
-        if (program)
+        const auto& program = m_shaderPrograms[i];
+        const ProgramPlan& plan = i < m_programPlans.size() ? m_programPlans[i] : ProgramPlan{};
+        if (program && plan.execute)
         {
             beginProgramScope(program->GetName().c_str());
 
@@ -74,11 +78,12 @@ void CompositeRenderPass::Execute()
             g_theRendererSubsystem->SetBlendConfig(BlendConfig::Opaque());
 
             // Generate mipmaps between composite sub-passes so later passes
-            // (e.g. composite4 bloom) can read hardware mipmaps written by earlier passes
-            generateMipmapsForMarkedTargets();
+            // (e.g. composite4 bloom) can read hardware mipmaps written by earlier passes.
+            // Only targets this program wrote and a later stage samples are regenerated.
+            generateMipmapsForMarkedTargets(plan.mipTargetsAfter);
         }
     }
-    EndPass();
+    TimedEndPass();
 }
 
 void CompositeRenderPass::OnShaderBundleLoaded(enigma::graphic::ShaderBundle* newBundle)
@@ -87,25 +92,60 @@ void CompositeRenderPass::OnShaderBundleLoaded(enigma::graphic::ShaderBundle* ne
     {
         m_shaderPrograms = newBundle->GetPrograms("composite.*");
     }
+    RenderPassCulling::Reload(newBundle);
+    rebuildProgramPlans();
 }
 
 void CompositeRenderPass::OnShaderBundleUnloaded()
 {
     m_shaderPrograms.clear();
+    m_programPlans.clear();
+    RenderPassCulling::Reload(nullptr);
 }
 
-void CompositeRenderPass::BeginPass()
+void CompositeRenderPass::rebuildProgramPlans()
 {
-    // [FIX] Transition depthtex0/1 to SRV for composite sampling (SSR, VL, etc.)
-    // DeferredRenderPass::EndPass() restored them to DEPTH_WRITE for translucent passes
-    auto* depthProvider = static_cast<enigma::graphic::DepthTextureProvider*>(g_theRendererSubsystem->GetRenderTargetProvider(RenderTargetType::DepthTex));
-    depthProvider->GetDepthTexture(0)->TransitionToShaderResource();
-    depthProvider->GetDepthTexture(1)->TransitionToShaderResource();
+    using Mask = RenderPassCulling::ColorTexMask;
+
+    // Backward liveness over the composite chain. Targets read by any non-composite program
+    // (final, deferred, next-frame gbuffers) stay live; colortex0 is presented after final.
+    Mask live = RenderPassCulling::GetColorTexReadsExcludingPrefix("composite") | 1u;
+
+    m_programPlans.assign(m_shaderPrograms.size(), ProgramPlan{});
+    for (size_t i = m_shaderPrograms.size(); i-- > 0;)
+    {
+        const auto& program = m_shaderPrograms[i];
+        if (!program)
+            continue;
+
+        ProgramPlan& plan   = m_programPlans[i];
+        Mask         writes = RenderPassCulling::MaskFromIndices(program->GetDirectives().GetDrawBuffers());
+
+        // Programs without explicit outputs write the default target and are never culled
+        plan.execute         = writes == 0 || (writes & live) != 0;
+        plan.mipTargetsAfter = writes == 0 ? RenderPassCulling::ALL_COLOR_TEXTURES : (writes & live);
+        if (!plan.execute)
+        {
+            DebuggerPrintf("[CompositeRenderPass] Culled '%s': outputs never read\n", program->GetName().c_str());
+            continue;
+        }
+
+        // An opaque full-screen program overwrites its targets, so earlier writers only matter through
+        // its reads. Blended programs read the destination as well and keep earlier writes live.
+        const auto& directives = program->GetDirectives();
+        bool        overwrites = directives.GetBlendConfig().IsUndefined() && directives.GetBufferBlendOverrides().empty();
+        if (overwrites)
+        {
+            live &= ~writes;
+        }
+        live |= RenderPassCulling::GetProgramColorTexReads(program->GetName());
+    }
+}
 
-    // [FIX] Transition shadowtex0/1 to SRV for composite VL
-    auto* shadowProvider = static_cast<enigma::graphic::ShadowTextureProvider*>(g_theRendererSubsystem->GetRenderTargetProvider(RenderTargetType::ShadowTex));
-    shadowProvider->GetDepthTexture(0)->TransitionToShaderResource();
-    shadowProvider->GetDepthTexture(1)->TransitionToShaderResource();
+void CompositeRenderPass::BeginPass()
+{
+    // depthtex0/1 and shadowtex0/1 are transitioned to SRV for composite sampling (SSR, VL, etc.)
+    // by SceneRenderGraph from DeclareResources, and restored to DEPTH_WRITE at frame end
 
     g_theRendererSubsystem->SetDepthConfig(DepthConfig::Disabled());
     g_theRendererSubsystem->SetBlendConfig(BlendConfig::Opaque());
@@ -144,20 +184,13 @@ void CompositeRenderPass::EndPass()
     m_savedCustomImages.clear();
 
     g_theRendererSubsystem->SetRasterizationConfig(RasterizationConfig::CullBack());
-
-    // Restore depthtex0/1 to DEPTH_WRITE (transitioned to SRV by DeferredRenderPass)
-    auto* depthProvider = static_cast<enigma::graphic::DepthTextureProvider*>(g_theRendererSubsystem->GetRenderTargetProvider(RenderTargetType::DepthTex));
-    depthProvider->GetDepthTexture(0)->TransitionToDepthWrite();
-    depthProvider->GetDepthTexture(1)->TransitionToDepthWrite();
-
-    // Restore shadowtex0/1 to DEPTH_WRITE (transitioned to SRV by DeferredRenderPass)
-    auto* shadowProvider = static_cast<enigma::graphic::ShadowTextureProvider*>(g_theRendererSubsystem->GetRenderTargetProvider(RenderTargetType::ShadowTex));
-    shadowProvider->GetDepthTexture(0)->TransitionToDepthWrite();
-    shadowProvider->GetDepthTexture(1)->TransitionToDepthWrite();
 }
 
-void CompositeRenderPass::generateMipmapsForMarkedTargets()
+void CompositeRenderPass::generateMipmapsForMarkedTargets(uint32_t targetMask)
 {
+    if (targetMask == 0)
+        return;
+
     auto* colorProvider = static_cast<enigma::graphic::ColorTextureProvider*>(
         g_theRendererSubsystem->GetRenderTargetProvider(RenderTargetType::ColorTex));
     if (!colorProvider)
@@ -165,6 +198,9 @@ void CompositeRenderPass::generateMipmapsForMarkedTargets()
 
     for (int i = 0; i < enigma::graphic::MAX_COLOR_TEXTURES; ++i)
     {
+        if (i < 32 && (targetMask & (1u << i)) == 0)
+            continue;
+
         auto rt = colorProvider->GetRenderTarget(i);
         if (rt && rt->IsMipmapEnabled())
         {
@@ -178,3 +214,19 @@ void CompositeRenderPass::generateMipmapsForMarkedTargets()
         }
     }
 }
+
+void CompositeRenderPass::DeclareResources(RenderGraph& graph) const
+{
+    // Only programs the liveness plan keeps contribute reads and writes
+    int pass = graph.AddPass("composite");
+    for (size_t i = 0; i < m_shaderPrograms.size(); ++i)
+    {
+        const auto& program = m_shaderPrograms[i];
+        if (!program || (i < m_programPlans.size() && !m_programPlans[i].execute))
+            continue;
+
+        SceneRenderGraph::DeclareColorWrites(graph, pass, program->GetDirectives().GetDrawBuffers());
+        SceneRenderGraph::DeclareProgramReads(graph, pass, *program);
+    }
+    SceneRenderGraph::DeclareDepthAndShadowSampling(graph, pass);
+}
@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "Engine/Graphic/Camera/OrthographicCamera.hpp"
 #include "Game/Framework/RenderPass/SceneRenderPass.hpp"
@@ -18,6 +19,7 @@ public:
     CompositeRenderPass();
     ~CompositeRenderPass() override;
     void Execute() override;
+    void DeclareResources(RenderGraph& graph) const override;
 
 protected:
     void OnShaderBundleLoaded(enigma::graphic::ShaderBundle* newBundle) override;
@@ -29,8 +31,19 @@ protected:
 private:
     std::vector<std::shared_ptr<enigma::graphic::ShaderProgram>> m_shaderPrograms;
 
-    // Post-pass mipmap generation for mipmapped render targets
-    void generateMipmapsForMarkedTargets();
+    // Per-program execution plan derived from RENDERTARGETS outputs and scanned colortex reads
+    struct ProgramPlan
+    {
+        bool     execute         = true; // false when no later stage reads any of its outputs
+        uint32_t mipTargetsAfter = 0; // colortex mask to regenerate mips for after this program
+    };
+
+    std::vector<ProgramPlan> m_programPlans;
+
+    void rebuildProgramPlans();
+
+    // Post-pass mipmap generation for mipmapped render targets in targetMask
+    void generateMipmapsForMarkedTargets(uint32_t targetMask);
 
     // Saved customImage state for stage-scoped texture restore in EndPass
     // Key: customImage slot index, Value: previous D12Texture* at that slot
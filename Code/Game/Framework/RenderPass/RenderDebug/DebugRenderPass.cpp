@@ -84,11 +84,11 @@ DebugRenderPass::~DebugRenderPass()
 
 void DebugRenderPass::Execute()
 {
-    BeginPass();
+    TimedBeginPass();
     //RenderGrid();
     if (ENABLE_COORDINATE_GIZMOS)
         RenderCursor();
-    EndPass();
+    TimedEndPass();
 }
 
 void DebugRenderPass::BeginPass()
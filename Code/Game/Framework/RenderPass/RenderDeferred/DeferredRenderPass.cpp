@@ -9,9 +9,8 @@
 #include "Engine/Graphic/Shader/Uniform/MatricesUniforms.hpp"
 #include "Engine/Graphic/Shader/Uniform/UniformManager.hpp"
 #include "Engine/Graphic/Target/D12RenderTarget.hpp"
-#include "Engine/Graphic/Target/DepthTextureProvider.hpp"
-#include "Engine/Graphic/Target/ShadowTextureProvider.hpp"
 #include "Game/GameCommon.hpp"
+#include "Game/Framework/RenderGraph/SceneRenderGraph.hpp"
 #include "Game/Framework/RenderPass/ConstantBuffer/CommonConstantBuffer.hpp"
 #include "Game/Framework/RenderPass/RenderPassHelper.hpp"
 #include "Game/Gameplay/Game.hpp"
@@ -28,7 +27,7 @@ DeferredRenderPass::~DeferredRenderPass()
 
 void DeferredRenderPass::Execute()
 {
-    BeginPass();
+    TimedBeginPass();
 
     bool hasProgramScope = false;
     auto beginProgramScope = [this, &hasProgramScope](const char* debugName)
@@ -74,7 +73,7 @@ void DeferredRenderPass::Execute()
             g_theRendererSubsystem->SetBlendConfig(BlendConfig::Opaque());
         }
     }
-    EndPass();
+    TimedEndPass();
 }
 
 void DeferredRenderPass::BeginPass()
@@ -83,16 +82,8 @@ void DeferredRenderPass::BeginPass()
     g_theRendererSubsystem->SetDepthConfig(DepthConfig::Disabled());
     g_theRendererSubsystem->SetVertexLayout(Vertex_PCUTBNLayout::Get());
 
-    // Transition depthtex0/1 to PIXEL_SHADER_RESOURCE for GBuffer sampling
-    // D3D12 Rule: Cannot read (SRV) and write (DSV) same resource simultaneously
-    auto* depthProvider = static_cast<DepthTextureProvider*>(g_theRendererSubsystem->GetRenderTargetProvider(RenderTargetType::DepthTex));
-    depthProvider->GetDepthTexture(0)->TransitionToShaderResource();
-    depthProvider->GetDepthTexture(1)->TransitionToShaderResource();
-
-    // Transition shadowtex0/1 to PIXEL_SHADER_RESOURCE for shadow sampling
-    auto* shadowProvider = static_cast<ShadowTextureProvider*>(g_theRendererSubsystem->GetRenderTargetProvider(RenderTargetType::ShadowTex));
-    shadowProvider->GetDepthTexture(0)->TransitionToShaderResource();
-    shadowProvider->GetDepthTexture(1)->TransitionToShaderResource();
+    // depthtex0/1 and shadowtex0/1 are transitioned to PIXEL_SHADER_RESOURCE by SceneRenderGraph
+    // from DeclareResources (D3D12 Rule: cannot read (SRV) and write (DSV) same resource simultaneously)
 
     g_theRendererSubsystem->SetRasterizationConfig(RasterizationConfig::NoCull());
 
@@ -129,16 +120,8 @@ void DeferredRenderPass::EndPass()
 
     g_theRendererSubsystem->SetRasterizationConfig(RasterizationConfig::CullBack());
 
-    // [FIX] Restore depthtex0/1 to DEPTH_WRITE for translucent passes (water, cloud)
-    // TerrainTranslucentRenderPass and CloudRenderPass need depthtex0 as DSV
-    auto* depthProvider = static_cast<DepthTextureProvider*>(g_theRendererSubsystem->GetRenderTargetProvider(RenderTargetType::DepthTex));
-    depthProvider->GetDepthTexture(0)->TransitionToDepthWrite();
-    depthProvider->GetDepthTexture(1)->TransitionToDepthWrite();
-
-    // [FIX] Restore shadowtex0/1 to DEPTH_WRITE
-    auto* shadowProvider = static_cast<ShadowTextureProvider*>(g_theRendererSubsystem->GetRenderTargetProvider(RenderTargetType::ShadowTex));
-    shadowProvider->GetDepthTexture(0)->TransitionToDepthWrite();
-    shadowProvider->GetDepthTexture(1)->TransitionToDepthWrite();
+    // Depth/shadow textures stay in SRV; SceneRenderGraph only transitions the ones a later pass
+    // writes (depthtex0 for water/clouds), so water can keep sampling depthtex1 and shadowtex1
 }
 
 void DeferredRenderPass::OnShaderBundleLoaded(enigma::graphic::ShaderBundle* newBundle)
@@ -153,3 +136,17 @@ void DeferredRenderPass::OnShaderBundleUnloaded()
 {
     m_shaderPrograms.clear();
 }
+
+void DeferredRenderPass::DeclareResources(RenderGraph& graph) const
+{
+    int pass = graph.AddPass("deferred");
+    for (const auto& program : m_shaderPrograms)
+    {
+        if (program)
+        {
+            SceneRenderGraph::DeclareColorWrites(graph, pass, program->GetDirectives().GetDrawBuffers());
+            SceneRenderGraph::DeclareProgramReads(graph, pass, *program);
+        }
+    }
+    SceneRenderGraph::DeclareDepthAndShadowSampling(graph, pass);
+}
@@ -14,6 +14,7 @@ public:
     DeferredRenderPass();
     ~DeferredRenderPass() override;
     void Execute() override;
+    void DeclareResources(RenderGraph& graph) const override;
 
 protected:
     void BeginPass() override;
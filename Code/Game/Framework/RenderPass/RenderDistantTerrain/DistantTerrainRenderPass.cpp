@@ -0,0 +1,144 @@
+#include "DistantTerrainRenderPass.hpp"
+
+#include "Engine/Graphic/Bundle/ShaderBundle.hpp"
+#include "Engine/Graphic/Bundle/Integration/ShaderBundleSubsystem.hpp"
+#include "Engine/Graphic/Camera/PerspectiveCamera.hpp"
+#include "Engine/Graphic/Integration/RendererSubsystem.hpp"
+#include "Engine/Graphic/Resource/VertexLayout/Layouts/Vertex_PCULayout.hpp"
+#include "Engine/Graphic/Shader/Uniform/MatricesUniforms.hpp"
+#include "Engine/Graphic/Shader/Uniform/PerObjectUniforms.hpp"
+#include "Engine/Graphic/Shader/Uniform/UniformManager.hpp"
+#include "Engine/Graphic/Target/RTTypes.hpp"
+#include "Engine/Math/Frustum.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Game/GameCommon.hpp"
+#include "Game/Framework/DistantTerrain/DistantTerrainLod.hpp"
+#include "Game/Framework/OcclusionCulling/ChunkOcclusionCuller.hpp"
+#include "Game/Framework/RenderGraph/SceneRenderGraph.hpp"
+#include "Game/Framework/RenderPass/ConstantBuffer/CommonConstantBuffer.hpp"
+#include "Game/Framework/RenderPass/WorldRenderingPhase.hpp"
+#include "Game/Framework/TerrainMeshing/TerrainFaceBuckets.hpp"
+#include "Game/Gameplay/Game.hpp"
+
+using namespace enigma::graphic;
+
+DistantTerrainRenderPass::DistantTerrainRenderPass()
+{
+    m_shaderProgram = g_theShaderBundleSubsystem->GetCurrentShaderBundle()->GetProgram("dh_terrain");
+}
+
+void DistantTerrainRenderPass::Execute()
+{
+    DistantTerrainStats& stats = DistantTerrainLod::MutableStats();
+    stats.drawnRegions         = 0;
+    stats.culledRegions        = 0;
+    stats.drawnFaceMeshes      = 0;
+    stats.backFaceMeshes       = 0;
+    if (!m_shaderProgram || !DistantTerrainLod::IsEnabled() || DistantTerrainLod::GetRegions().empty())
+    {
+        return;
+    }
+
+    // Same tests the chunk batch collector applies to the full-detail regions
+    Frustum    frustum;
+    auto*      cullingCamera = g_theGame ? g_theGame->GetChunkBatchCullingCamera() : nullptr;
+    const bool hasFrustum    = cullingCamera && cullingCamera->GetFrustum(frustum);
+    const bool cullFacing    = cullingCamera && TerrainFaceBuckets::GetSettings().enabled;
+
+    TimedBeginPass();
+    for (const auto& entry : DistantTerrainLod::GetRegions())
+    {
+        const DistantTerrainRegion& region = entry.second;
+        if (!region.mesh)
+        {
+            continue;
+        }
+        if ((hasFrustum && !frustum.IsOverlapping(region.worldBounds)) || ChunkOcclusionCuller::IsOccluded(region.worldBounds))
+        {
+            ++stats.culledRegions;
+            continue;
+        }
+
+        // Vertices are region-local so they keep their precision far from the origin
+        const Mat44       modelMatrix = Mat44::MakeTranslation3D(region.origin);
+        PerObjectUniforms perObjectUniform;
+        perObjectUniform.modelMatrix        = modelMatrix;
+        perObjectUniform.modelMatrixInverse = modelMatrix.GetInverse();
+        Rgba8::WHITE.GetAsFloats(perObjectUniform.modelColor);
+        g_theRendererSubsystem->GetUniformManager()->UploadBuffer(perObjectUniform);
+
+        // Face meshes carry region-local bounds, so the camera goes into the same space
+        const Vec3 cameraInRegion = cullFacing ? cullingCamera->GetPosition() - region.origin : Vec3();
+        for (const DistantTerrainFaceMesh& faceMesh : region.mesh->faceMeshes)
+        {
+            if (cullFacing && !TerrainFaceBuckets::IsFrontFacing(faceMesh.bucket, cameraInRegion))
+            {
+                ++stats.backFaceMeshes;
+                continue;
+            }
+            g_theRendererSubsystem->DrawVertexBuffer(faceMesh.vertexBuffer);
+            ++stats.drawnFaceMeshes;
+        }
+        ++stats.drawnRegions;
+    }
+    TimedEndPass();
+}
+
+void DistantTerrainRenderPass::BeginPass()
+{
+    // Save current render states for restoration
+    m_savedDepthConfig         = g_theRendererSubsystem->GetDepthConfig();
+    m_savedBlendConfig         = g_theRendererSubsystem->GetBlendConfig();
+    m_savedRasterizationConfig = g_theRendererSubsystem->GetRasterizationConfig();
+
+    g_theRendererSubsystem->SetVertexLayout(Vertex_PCULayout::Get());
+    g_theRendererSubsystem->UseProgram(m_shaderProgram, {{RenderTargetType::ColorTex, 0}, {RenderTargetType::ColorTex, 1}, {RenderTargetType::ColorTex, 2}, {RenderTargetType::DepthTex, 0}});
+    g_theRendererSubsystem->SetDepthConfig(DepthConfig::Enabled());
+    g_theRendererSubsystem->SetBlendConfig(BlendConfig::Opaque());
+    g_theRendererSubsystem->SetRasterizationConfig(RasterizationConfig::CullBack());
+
+    SceneRenderPass::BeginPass();
+
+    if (g_theGame && g_theGame->GetRenderCamera())
+    {
+        g_theGame->GetRenderCamera()->UpdateMatrixUniforms(MATRICES_UNIFORM);
+        g_theRendererSubsystem->GetUniformManager()->UploadBuffer(MATRICES_UNIFORM);
+    }
+
+    COMMON_UNIFORM.renderStage = ToRenderStage(WorldRenderingPhase::TERRAIN_SOLID);
+    g_theRendererSubsystem->GetUniformManager()->UploadBuffer(COMMON_UNIFORM);
+}
+
+void DistantTerrainRenderPass::EndPass()
+{
+    // Later passes must not inherit the back-face culling set in BeginPass
+    g_theRendererSubsystem->SetDepthConfig(m_savedDepthConfig);
+    g_theRendererSubsystem->SetBlendConfig(m_savedBlendConfig);
+    g_theRendererSubsystem->SetRasterizationConfig(m_savedRasterizationConfig);
+
+    SceneRenderPass::EndPass();
+}
+
+void DistantTerrainRenderPass::OnShaderBundleLoaded(enigma::graphic::ShaderBundle* newBundle)
+{
+    if (newBundle)
+    {
+        m_shaderProgram = newBundle->GetProgram("dh_terrain");
+    }
+}
+
+void DistantTerrainRenderPass::OnShaderBundleUnloaded()
+{
+    m_shaderProgram = nullptr;
+}
+
+void DistantTerrainRenderPass::DeclareResources(RenderGraph& graph) const
+{
+    int pass = graph.AddPass("dh_terrain");
+    graph.WriteMask(pass, RenderGraphResourceType::ColorTex, 0x7u); // colortex0-2, matches UseProgram in BeginPass
+    graph.Write(pass, {RenderGraphResourceType::DepthTex, 0});
+    if (m_shaderProgram)
+    {
+        SceneRenderGraph::DeclareProgramReads(graph, pass, *m_shaderProgram);
+    }
+}
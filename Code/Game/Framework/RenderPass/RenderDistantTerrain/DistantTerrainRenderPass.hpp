@@ -0,0 +1,49 @@
+/**
+ * @file DistantTerrainRenderPass.hpp
+ * @brief G-Buffer pass for the distant terrain LOD regions (dh_terrain)
+ * @date 2026-10-16
+ *
+ * Draws the column meshes of DistantTerrainLod after the full-detail opaque terrain, into the same
+ * colortex0-2 + depth targets, so deferred lighting and fog treat them like regular terrain. Regions
+ * are culled against the chunk batch culling camera's frustum; within a drawn region, face directions
+ * that point away from that camera are skipped while terrainMeshing.faceBuckets is enabled. The program
+ * follows the Iris Distant Horizons naming (dh_terrain); the pass does nothing when the bundle does not
+ * provide it.
+ */
+
+#pragma once
+#include <memory>
+
+#include "Engine/Graphic/Core/RenderState/BlendState.hpp"
+#include "Engine/Graphic/Core/RenderState/DepthState.hpp"
+#include "Engine/Graphic/Core/RenderState/RasterizeState.hpp"
+#include "Game/Framework/RenderPass/SceneRenderPass.hpp"
+
+namespace enigma::graphic
+{
+    class ShaderProgram;
+}
+
+class DistantTerrainRenderPass : public SceneRenderPass
+{
+public:
+    DistantTerrainRenderPass();
+    ~DistantTerrainRenderPass() override = default;
+
+    void Execute() override;
+    void DeclareResources(RenderGraph& graph) const override;
+
+protected:
+    void BeginPass() override;
+    void EndPass() override;
+    void OnShaderBundleLoaded(enigma::graphic::ShaderBundle* newBundle) override;
+    void OnShaderBundleUnloaded() override;
+
+private:
+    std::shared_ptr<enigma::graphic::ShaderProgram> m_shaderProgram = nullptr;
+
+    // Saved render states (for restoration in EndPass)
+    enigma::graphic::DepthConfig         m_savedDepthConfig;
+    enigma::graphic::BlendConfig         m_savedBlendConfig;
+    enigma::graphic::RasterizationConfig m_savedRasterizationConfig;
+};
@@ -7,6 +7,7 @@
 #include "Engine/Graphic/Shader/Uniform/MatricesUniforms.hpp"
 #include "Engine/Graphic/Shader/Uniform/UniformManager.hpp"
 #include "Game/GameCommon.hpp"
+#include "Game/Framework/RenderGraph/SceneRenderGraph.hpp"
 #include "Game/Gameplay/Game.hpp"
 #include "Game/Framework/RenderPass/ConstantBuffer/CommonConstantBuffer.hpp"
 #include "Game/Framework/RenderPass/RenderPassHelper.hpp"
@@ -22,7 +23,7 @@ FinalRenderPass::~FinalRenderPass()
 
 void FinalRenderPass::Execute()
 {
-    BeginPass();
+    TimedBeginPass();
     /// Logic In Here
 
     if (m_shadowProgram)
@@ -32,7 +33,7 @@ void FinalRenderPass::Execute()
         FullQuadsRenderer::DrawFullQuads();
     }
 
-    EndPass();
+    TimedEndPass();
 }
 
 void FinalRenderPass::BeginPass()
@@ -66,3 +67,13 @@ void FinalRenderPass::OnShaderBundleUnloaded()
 {
     m_shadowProgram.reset();
 }
+
+void FinalRenderPass::DeclareResources(RenderGraph& graph) const
+{
+    int pass = graph.AddPass("final");
+    if (m_shadowProgram)
+    {
+        SceneRenderGraph::DeclareColorWrites(graph, pass, m_shadowProgram->GetDirectives().GetDrawBuffers());
+        SceneRenderGraph::DeclareProgramReads(graph, pass, *m_shadowProgram);
+    }
+}
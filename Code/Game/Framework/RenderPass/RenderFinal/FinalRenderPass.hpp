@@ -14,6 +14,7 @@ public:
     FinalRenderPass();
     ~FinalRenderPass() override;
     void Execute() override;
+    void DeclareResources(RenderGraph& graph) const override;
 
 protected:
     void BeginPass() override;
@@ -0,0 +1,332 @@
+/**
+ * @file RenderPassCulling.cpp
+ * @brief Sampler read analysis and pass culling implementation
+ * @date 2026-10-16
+ */
+
+#include "RenderPassCulling.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <regex>
+#include <sstream>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Graphic/Bundle/ShaderBundle.hpp"
+#include "Engine/Graphic/Bundle/Integration/ShaderBundleSubsystem.hpp"
+#include "Engine/Graphic/Shader/Program/ShaderProgram.hpp"
+
+using namespace enigma::core;
+
+namespace
+{
+    constexpr const char* SHADER_BUNDLE_ROOT      = ".enigma/shaderbundles";
+    constexpr const char* PIXEL_PROGRAM_EXTENSION = ".ps.hlsl";
+
+    /// Stem of <name>.ps.hlsl, empty for any other file
+    std::string GetPixelProgramName(const std::filesystem::path& path)
+    {
+        const std::string fileName  = path.filename().string();
+        const std::string extension = PIXEL_PROGRAM_EXTENSION;
+        if (fileName.size() <= extension.size() || fileName.compare(fileName.size() - extension.size(), extension.size(), extension) != 0)
+            return {};
+        return fileName.substr(0, fileName.size() - extension.size());
+    }
+
+    std::string Trim(const std::string& text)
+    {
+        size_t begin = text.find_first_not_of(" \t\r\n");
+        if (begin == std::string::npos)
+            return {};
+        size_t end = text.find_last_not_of(" \t\r\n");
+        return text.substr(begin, end - begin + 1);
+    }
+
+    /// Remove // and /* */ comments so documentation such as "Reads colortex5" is not counted as a read
+    std::string StripComments(const std::string& source)
+    {
+        std::string result;
+        result.reserve(source.size());
+        for (size_t i = 0; i < source.size(); ++i)
+        {
+            if (source[i] == '/' && i + 1 < source.size() && source[i + 1] == '/')
+            {
+                while (i < source.size() && source[i] != '\n')
+                    ++i;
+                result.push_back('\n');
+            }
+            else if (source[i] == '/' && i + 1 < source.size() && source[i + 1] == '*')
+            {
+                i += 2;
+                while (i + 1 < source.size() && !(source[i] == '*' && source[i + 1] == '/'))
+                    ++i;
+                ++i;
+            }
+            else
+            {
+                result.push_back(source[i]);
+            }
+        }
+        return result;
+    }
+
+    /// Source scanner for one analysis build; the patterns live as long as the build, not the process
+    class BundleSourceScanner
+    {
+    public:
+        using ProgramTextureReads = RenderPassCulling::ProgramTextureReads;
+
+        bool ScanProgram(const std::filesystem::path& sourcePath, ProgramTextureReads& outReads) const
+        {
+            std::vector<std::filesystem::path> visited;
+            outReads = {0, 0, 0, 0};
+            return ScanSourceFile(sourcePath, visited, outReads);
+        }
+
+        /// Format directives may live in any bundle file (e.g. lib/pipelineSettings.hlsl), not only in program
+        /// includes, and Iris-style bundles keep them inside comment blocks, so comments are not stripped here
+        void ScanColorTexFormats(const std::filesystem::path& shaderRoot, std::unordered_map<int, std::string>& outFormats) const
+        {
+            std::error_code                               ec;
+            std::filesystem::recursive_directory_iterator it(shaderRoot, ec);
+            if (ec)
+                return;
+
+            for (const auto& entry : it)
+            {
+                if (!entry.is_regular_file() || entry.path().extension() != ".hlsl")
+                    continue;
+
+                const std::string source = ReadFile(entry.path());
+                for (std::sregex_iterator match(source.begin(), source.end(), m_formatPattern), end; match != end; ++match)
+                {
+                    outFormats[std::stoi((*match)[1].str())] = (*match)[2].str();
+                }
+            }
+        }
+
+    private:
+        static std::string ReadFile(const std::filesystem::path& path)
+        {
+            std::ifstream     file(path);
+            std::stringstream buffer;
+            buffer << file.rdbuf();
+            return buffer.str();
+        }
+
+        bool ScanSourceFile(const std::filesystem::path& sourcePath, std::vector<std::filesystem::path>& visited, ProgramTextureReads& outReads) const
+        {
+            std::error_code       ec;
+            std::filesystem::path canonicalPath = std::filesystem::weakly_canonical(sourcePath, ec);
+            if (ec)
+                canonicalPath = sourcePath;
+            if (std::find(visited.begin(), visited.end(), canonicalPath) != visited.end())
+                return true;
+            visited.push_back(canonicalPath);
+
+            // Only the root program is required; missing includes (e.g. @engine headers) hold no sampler references
+            if (!std::filesystem::is_regular_file(sourcePath, ec))
+                return visited.size() > 1;
+
+            const std::string source = StripComments(ReadFile(sourcePath));
+            for (std::sregex_iterator it(source.begin(), source.end(), m_samplerPattern), end; it != end; ++it)
+            {
+                int index = std::stoi((*it)[2].str());
+                if (index < 0 || index >= 32)
+                    continue;
+
+                const std::string              family = (*it)[1].str();
+                RenderPassCulling::ColorTexMask& mask = family == "colortex" ? outReads.colorTex : family == "depthtex" ? outReads.depthTex : family == "shadowtex" ? outReads.shadowTex : outReads.shadowColor;
+                mask |= 1u << index;
+            }
+
+            for (std::sregex_iterator it(source.begin(), source.end(), m_includePattern), end; it != end; ++it)
+            {
+                ScanSourceFile(sourcePath.parent_path() / (*it)[1].str(), visited, outReads);
+            }
+            return true;
+        }
+
+    private:
+        const std::regex m_includePattern{R"(#\s*include\s*[<"]([^>"]+)[>"])"};
+        const std::regex m_samplerPattern{R"(\b(colortex|depthtex|shadowtex|shadowcolor)(\d+)\b)"};
+        const std::regex m_formatPattern{R"(\bcolortex(\d+)Format\s*=\s*(\w+))"};
+    };
+}
+
+// ------------------------------------------------------------------------------------------------
+void RenderPassCulling::Reload(enigma::graphic::ShaderBundle* bundle)
+{
+    if (!bundle)
+    {
+        DebuggerPrintf("[RenderPassCulling] No shader bundle loaded, nothing is culled\n");
+        s_analysis = BuildAnalysis({});
+        return;
+    }
+
+    std::vector<std::string> programNames;
+    for (const auto& program : bundle->GetPrograms(".*"))
+    {
+        if (program)
+            programNames.push_back(program->GetName());
+    }
+
+    // Scanning another bundle's sources could cull a pass the bound programs still sample
+    const std::filesystem::path shaderRoot = FindShaderRoot(SHADER_BUNDLE_ROOT, programNames);
+    if (shaderRoot.empty())
+    {
+        DebuggerPrintf("[RenderPassCulling] No folder under %s holds exactly the %zu loaded programs, nothing is culled\n", SHADER_BUNDLE_ROOT, programNames.size());
+        s_analysis = BuildAnalysis({});
+        return;
+    }
+    s_analysis = BuildAnalysis(shaderRoot);
+}
+
+// ------------------------------------------------------------------------------------------------
+std::filesystem::path RenderPassCulling::FindShaderRoot(const std::filesystem::path& bundlesRoot, const std::vector<std::string>& programNames)
+{
+    std::vector<std::string> expected = programNames;
+    std::sort(expected.begin(), expected.end());
+    expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+    if (expected.empty())
+        return {};
+
+    std::filesystem::path match;
+    std::error_code       ec;
+    for (std::filesystem::directory_iterator bundleIt(bundlesRoot, ec), end; !ec && bundleIt != end; bundleIt.increment(ec))
+    {
+        const std::filesystem::path shaderRoot = bundleIt->path() / "shaders";
+        std::vector<std::string>    found;
+        std::error_code             programError;
+        for (std::filesystem::directory_iterator it(shaderRoot / "program", programError); !programError && it != end; it.increment(programError))
+        {
+            std::string name = GetPixelProgramName(it->path());
+            if (!name.empty())
+                found.push_back(std::move(name));
+        }
+        std::sort(found.begin(), found.end());
+        if (found != expected)
+            continue;
+        if (!match.empty())
+        {
+            DebuggerPrintf("[RenderPassCulling] %s and %s hold the same programs\n", match.string().c_str(), shaderRoot.string().c_str());
+            return {};
+        }
+        match = shaderRoot;
+    }
+    return match;
+}
+
+// ------------------------------------------------------------------------------------------------
+std::shared_ptr<const RenderPassCulling::BundleAnalysis> RenderPassCulling::BuildAnalysis(const std::filesystem::path& shaderRoot)
+{
+    auto analysis = std::make_shared<BundleAnalysis>();
+    if (shaderRoot.empty())
+        return analysis;
+
+    // [STEP 1] Sampler reads of every pixel program; a program that fails to scan reads everything
+    BundleSourceScanner scanner;
+    std::error_code     ec;
+    for (std::filesystem::directory_iterator it(shaderRoot / "program", ec), end; !ec && it != end; it.increment(ec))
+    {
+        const std::string programName = GetPixelProgramName(it->path());
+        if (programName.empty())
+            continue;
+
+        ProgramTextureReads reads;
+        if (!scanner.ScanProgram(it->path(), reads))
+        {
+            reads = ProgramTextureReads{};
+        }
+        analysis->programReads[programName] = reads;
+    }
+    analysis->sourcesScanned = !ec;
+
+    // [STEP 2] colortexNFormat directives from the whole bundle
+    scanner.ScanColorTexFormats(shaderRoot, analysis->colorTexFormats);
+
+    DebuggerPrintf("[RenderPassCulling] Bundle '%s': %zu programs scanned\n",
+                   shaderRoot.parent_path().filename().string().c_str(),
+                   analysis->programReads.size());
+    return analysis;
+}
+
+// ------------------------------------------------------------------------------------------------
+const RenderPassCulling::BundleAnalysis& RenderPassCulling::GetAnalysis()
+{
+    if (!s_analysis)
+    {
+        // First query before any bundle event: analyse whatever bundle the subsystem holds right now
+        Reload(g_theShaderBundleSubsystem ? g_theShaderBundleSubsystem->GetCurrentShaderBundle().get() : nullptr);
+    }
+    return *s_analysis;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool RenderPassCulling::IsShadowPassEnabled()
+{
+    const BundleAnalysis& analysis = GetAnalysis();
+    if (!analysis.sourcesScanned)
+        return true;
+
+    // The shadow stage's own programs reading its maps do not make the maps visible in the frame
+    for (const auto& [programName, reads] : analysis.programReads)
+    {
+        if (programName.rfind("shadow", 0) != 0 && (reads.shadowTex | reads.shadowColor) != 0)
+            return true;
+    }
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+RenderPassCulling::ColorTexMask RenderPassCulling::MaskFromIndices(const std::vector<uint32_t>& indices)
+{
+    ColorTexMask mask = 0;
+    for (uint32_t index : indices)
+    {
+        if (index < 32)
+            mask |= 1u << index;
+    }
+    return mask;
+}
+
+// ------------------------------------------------------------------------------------------------
+const RenderPassCulling::ProgramTextureReads& RenderPassCulling::GetProgramTextureReads(const std::string& programName)
+{
+    static const ProgramTextureReads unknownReads;
+
+    const BundleAnalysis& analysis = GetAnalysis();
+    auto                  it       = analysis.programReads.find(programName);
+    return it != analysis.programReads.end() ? it->second : unknownReads;
+}
+
+// ------------------------------------------------------------------------------------------------
+RenderPassCulling::ColorTexMask RenderPassCulling::GetProgramColorTexReads(const std::string& programName)
+{
+    return GetProgramTextureReads(programName).colorTex;
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string RenderPassCulling::GetColorTexFormat(int index)
+{
+    const BundleAnalysis& analysis = GetAnalysis();
+    auto                  it       = analysis.colorTexFormats.find(index);
+    return it != analysis.colorTexFormats.end() ? it->second : std::string();
+}
+
+// ------------------------------------------------------------------------------------------------
+RenderPassCulling::ColorTexMask RenderPassCulling::GetColorTexReadsExcludingPrefix(const std::string& excludedPrefix)
+{
+    const BundleAnalysis& analysis = GetAnalysis();
+    if (!analysis.sourcesScanned)
+        return ALL_COLOR_TEXTURES;
+
+    ColorTexMask mask = 0;
+    for (const auto& [programName, reads] : analysis.programReads)
+    {
+        if (programName.rfind(excludedPrefix, 0) != 0)
+            mask |= reads.colorTex;
+    }
+    return mask;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file RenderPassCulling.hpp
+ * @brief Sampler read analysis and pass culling for the deferred pipeline
+ * @date 2026-10-16
+ *
+ * Responsibilities:
+ * - Scan program sources for colortex/depthtex/shadowtex/shadowcolor samples
+ * - Let full-screen stages skip programs and mip generation whose results are never read
+ * - Skip the shadow passes when no program outside the shadow stage samples a shadow map
+ *
+ * Everything is computed once per bundle load into a BundleAnalysis; queries only read it.
+ * ShaderBundle does not report its source folder, so Reload() finds it in the
+ * .enigma/shaderbundles/<name>/shaders layout: the folder whose program/<name>.ps.hlsl set equals the
+ * loaded bundle's programs. When no folder matches exactly, the analysis stays conservative: every
+ * pass runs and every program is treated as reading every texture.
+ */
+
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace enigma::graphic
+{
+    class ShaderBundle;
+}
+
+class RenderPassCulling
+{
+public:
+    RenderPassCulling()                                    = delete; // Prevent instantiation
+    RenderPassCulling(const RenderPassCulling&)            = delete; // Prevent copy
+    RenderPassCulling& operator=(const RenderPassCulling&) = delete; // Prevent assignment
+
+    /// Bitmask with one bit per colortex index; all bits set means "unknown, assume everything"
+    using ColorTexMask = uint32_t;
+    static constexpr ColorTexMask ALL_COLOR_TEXTURES = 0xFFFFFFFFu;
+
+    /// Texture indices sampled by one program, one mask per Iris sampler family
+    struct ProgramTextureReads
+    {
+        ColorTexMask colorTex    = ALL_COLOR_TEXTURES; // colortexN
+        ColorTexMask depthTex    = ALL_COLOR_TEXTURES; // depthtexN
+        ColorTexMask shadowTex   = ALL_COLOR_TEXTURES; // shadowtexN
+        ColorTexMask shadowColor = ALL_COLOR_TEXTURES; // shadowcolorN
+    };
+
+    /// Everything culling knows about one loaded bundle, built once by BuildAnalysis()
+    struct BundleAnalysis
+    {
+        std::unordered_map<std::string, ProgramTextureReads> programReads;    // every program/<name>.ps.hlsl
+        std::unordered_map<int, std::string>                 colorTexFormats; // colortexNFormat directives
+        bool                                                 sourcesScanned = false;
+    };
+
+public:
+    /// Rebuild the analysis for bundle. Called whenever a bundle is (re)loaded; nullptr (unloaded)
+    /// makes every query conservative.
+    static void Reload(enigma::graphic::ShaderBundle* bundle);
+
+    /// Scan <shaderRoot>/program; an empty root yields the conservative analysis
+    static std::shared_ptr<const BundleAnalysis> BuildAnalysis(const std::filesystem::path& shaderRoot);
+
+    /// <bundle>/shaders folder under bundlesRoot whose pixel programs are exactly programNames;
+    /// empty when none or more than one folder matches
+    static std::filesystem::path FindShaderRoot(const std::filesystem::path& bundlesRoot, const std::vector<std::string>& programNames);
+
+    /// True when a program outside the shadow stage (shadow*, shadowcomp*) samples shadowtexN or
+    /// shadowcolorN, i.e. the compiled programs actually consume the shadow maps
+    static bool IsShadowPassEnabled();
+
+    /// Samplers referenced by program/<programName>.ps.hlsl and its bundle-local includes.
+    /// Every mask is ALL_COLOR_TEXTURES when the program was not scanned so callers stay conservative.
+    static const ProgramTextureReads& GetProgramTextureReads(const std::string& programName);
+    static ColorTexMask               GetProgramColorTexReads(const std::string& programName);
+
+    /// colortexNFormat declared anywhere in the bundle sources, empty when not declared
+    static std::string GetColorTexFormat(int index);
+
+    /// Union of reads of every pixel program in the bundle whose name does not start with excludedPrefix.
+    /// Used to keep outputs alive that other stages (final, deferred, next-frame gbuffers) consume.
+    static ColorTexMask GetColorTexReadsExcludingPrefix(const std::string& excludedPrefix);
+
+    static ColorTexMask MaskFromIndices(const std::vector<uint32_t>& indices);
+
+private:
+    static const BundleAnalysis& GetAnalysis();
+
+private:
+    static inline std::shared_ptr<const BundleAnalysis> s_analysis;
+};
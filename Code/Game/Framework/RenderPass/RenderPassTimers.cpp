@@ -0,0 +1,238 @@
+/**
+ * @file RenderPassTimers.cpp
+ * @brief Per-frame CPU timers for SceneRenderPass phases implementation
+ * @date 2026-10-16
+ */
+
+#include "RenderPassTimers.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+std::array<RenderPassTimers::FrameSlot, RenderPassTimers::FRAME_HISTORY> RenderPassTimers::s_frames;
+std::atomic<uint64_t>                                                   RenderPassTimers::s_frameIndex{0};
+std::atomic<uint16_t>                                                   RenderPassTimers::s_currentPass{RenderPassTimers::UNASSIGNED_PASS};
+std::array<std::array<char, 32>, RenderPassTimers::MAX_PASSES>          RenderPassTimers::s_passNames = {};
+uint16_t                                                                RenderPassTimers::s_passCount = 0;
+
+namespace
+{
+    constexpr int PHASE_COUNT = static_cast<int>(RenderPassTimerPhase::Count);
+
+    double Percentile(const std::vector<double>& sorted, double fraction)
+    {
+        if (sorted.empty())
+            return 0.0;
+        // Nearest-rank: smallest value with at least fraction of the samples at or below it
+        size_t rank = static_cast<size_t>(fraction * static_cast<double>(sorted.size()) + 0.999999);
+        rank        = std::clamp<size_t>(rank, 1, sorted.size());
+        return sorted[rank - 1];
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void RenderPassTimers::BeginFrame()
+{
+    const uint64_t next = s_frameIndex.load(std::memory_order_relaxed) + 1;
+    s_frames[next % FRAME_HISTORY].count.store(0, std::memory_order_relaxed);
+    s_frameIndex.store(next, std::memory_order_release);
+    s_currentPass.store(UNASSIGNED_PASS, std::memory_order_relaxed);
+}
+
+// ------------------------------------------------------------------------------------------------
+uint16_t RenderPassTimers::RegisterPass(const std::string& passName)
+{
+    if (s_passCount == 0)
+    {
+        std::strncpy(s_passNames[UNASSIGNED_PASS].data(), "other", s_passNames[UNASSIGNED_PASS].size() - 1);
+        s_passCount = 1;
+    }
+
+    for (uint16_t id = 1; id < s_passCount; ++id)
+    {
+        if (passName == s_passNames[id].data())
+            return id;
+    }
+    if (s_passCount >= MAX_PASSES)
+        return UNASSIGNED_PASS;
+
+    std::strncpy(s_passNames[s_passCount].data(), passName.c_str(), s_passNames[s_passCount].size() - 1);
+    return s_passCount++;
+}
+
+// ------------------------------------------------------------------------------------------------
+void RenderPassTimers::SetCurrentPass(uint16_t passId)
+{
+    s_currentPass.store(passId, std::memory_order_relaxed);
+}
+
+// ------------------------------------------------------------------------------------------------
+uint16_t RenderPassTimers::GetCurrentPass()
+{
+    return s_currentPass.load(std::memory_order_relaxed);
+}
+
+// ------------------------------------------------------------------------------------------------
+void RenderPassTimers::Record(uint16_t passId, RenderPassTimerPhase phase, double milliseconds)
+{
+    FrameSlot&     slot  = s_frames[s_frameIndex.load(std::memory_order_acquire) % FRAME_HISTORY];
+    const uint32_t index = slot.count.fetch_add(1, std::memory_order_relaxed);
+    if (index >= MAX_SAMPLES_PER_FRAME)
+        return;
+    slot.samples[index] = {passId, phase, static_cast<float>(milliseconds)};
+}
+
+// ------------------------------------------------------------------------------------------------
+std::vector<RenderPassTimingStats> RenderPassTimers::BuildStats()
+{
+    // Per frame, samples of the same pass/phase are summed (e.g. several Collect calls in one pass)
+    const uint64_t currentFrame = s_frameIndex.load(std::memory_order_acquire);
+    const uint64_t frameCount   = std::min<uint64_t>(currentFrame, FRAME_HISTORY - 1);
+
+    std::vector<std::vector<double>> series(static_cast<size_t>(MAX_PASSES) * PHASE_COUNT);
+    std::vector<double>              last(series.size(), 0.0);
+    std::vector<double>              frameTotals(series.size());
+    std::vector<bool>                touched(series.size());
+
+    for (uint64_t age = frameCount; age >= 1; --age)
+    {
+        const FrameSlot& slot  = s_frames[(currentFrame - age) % FRAME_HISTORY];
+        const uint32_t   count = std::min<uint32_t>(slot.count.load(std::memory_order_relaxed), MAX_SAMPLES_PER_FRAME);
+
+        std::fill(frameTotals.begin(), frameTotals.end(), 0.0);
+        std::fill(touched.begin(), touched.end(), false);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const Sample& sample = slot.samples[i];
+            const size_t  key    = static_cast<size_t>(sample.passId) * PHASE_COUNT + static_cast<size_t>(sample.phase);
+            if (key >= series.size())
+                continue;
+            frameTotals[key] += sample.ms;
+            touched[key] = true;
+        }
+        for (size_t key = 0; key < series.size(); ++key)
+        {
+            if (!touched[key])
+                continue;
+            series[key].push_back(frameTotals[key]);
+            last[key] = frameTotals[key];
+        }
+    }
+
+    std::vector<RenderPassTimingStats> stats;
+    for (size_t key = 0; key < series.size(); ++key)
+    {
+        std::vector<double>& values = series[key];
+        if (values.empty())
+            continue;
+
+        RenderPassTimingStats entry;
+        entry.passName    = GetPassName(static_cast<uint16_t>(key / PHASE_COUNT));
+        entry.phase       = static_cast<RenderPassTimerPhase>(key % PHASE_COUNT);
+        entry.sampleCount = static_cast<int>(values.size());
+        entry.lastMs      = last[key];
+
+        double sum = 0.0;
+        for (double value : values)
+            sum += value;
+        entry.avgMs = sum / static_cast<double>(values.size());
+
+        std::sort(values.begin(), values.end());
+        entry.p50Ms = Percentile(values, 0.50);
+        entry.p95Ms = Percentile(values, 0.95);
+        entry.p99Ms = Percentile(values, 0.99);
+        entry.maxMs = values.back();
+        stats.push_back(entry);
+    }
+    return stats;
+}
+
+// ------------------------------------------------------------------------------------------------
+std::vector<RenderPassTimingStats> RenderPassTimers::BuildLastFrameStats()
+{
+    std::vector<RenderPassTimingStats> stats;
+    const uint64_t                     currentFrame = s_frameIndex.load(std::memory_order_acquire);
+    if (currentFrame == 0)
+        return stats;
+
+    std::array<double, static_cast<size_t>(MAX_PASSES) * PHASE_COUNT> totals  = {};
+    std::array<bool, static_cast<size_t>(MAX_PASSES) * PHASE_COUNT>   touched = {};
+
+    const FrameSlot& slot  = s_frames[(currentFrame - 1) % FRAME_HISTORY];
+    const uint32_t   count = std::min<uint32_t>(slot.count.load(std::memory_order_relaxed), MAX_SAMPLES_PER_FRAME);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        const Sample& sample = slot.samples[i];
+        const size_t  key    = static_cast<size_t>(sample.passId) * PHASE_COUNT + static_cast<size_t>(sample.phase);
+        if (key >= totals.size())
+            continue;
+        totals[key] += sample.ms;
+        touched[key] = true;
+    }
+
+    for (size_t key = 0; key < totals.size(); ++key)
+    {
+        if (!touched[key])
+            continue;
+
+        RenderPassTimingStats entry;
+        entry.passName    = GetPassName(static_cast<uint16_t>(key / PHASE_COUNT));
+        entry.phase       = static_cast<RenderPassTimerPhase>(key % PHASE_COUNT);
+        entry.sampleCount = 1;
+        entry.lastMs      = totals[key];
+        stats.push_back(entry);
+    }
+    return stats;
+}
+
+// ------------------------------------------------------------------------------------------------
+void RenderPassTimers::Reset()
+{
+    for (FrameSlot& slot : s_frames)
+    {
+        slot.count.store(0, std::memory_order_relaxed);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+const char* RenderPassTimers::GetPhaseName(RenderPassTimerPhase phase)
+{
+    switch (phase)
+    {
+    case RenderPassTimerPhase::Execute:
+        return "Execute";
+    case RenderPassTimerPhase::BeginPass:
+        return "BeginPass";
+    case RenderPassTimerPhase::EndPass:
+        return "EndPass";
+    case RenderPassTimerPhase::Collect:
+        return "Collect";
+    case RenderPassTimerPhase::Submit:
+        return "Submit";
+    default:
+        return "Unknown";
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+const char* RenderPassTimers::GetPassName(uint16_t passId)
+{
+    if (passId >= s_passCount)
+        return "other";
+    return s_passNames[passId].data();
+}
+
+// ------------------------------------------------------------------------------------------------
+ScopedRenderPassTimer::ScopedRenderPassTimer(RenderPassTimerPhase phase)
+    : m_passId(RenderPassTimers::GetCurrentPass())
+    , m_phase(phase)
+    , m_start(std::chrono::steady_clock::now())
+{
+}
+
+// ------------------------------------------------------------------------------------------------
+ScopedRenderPassTimer::~ScopedRenderPassTimer()
+{
+    const double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_start).count();
+    RenderPassTimers::Record(m_passId, m_phase, elapsedMs);
+}
@@ -0,0 +1,114 @@
+/**
+ * @file RenderPassTimers.hpp
+ * @brief Per-frame CPU timers for SceneRenderPass phases, stored in a lock-free frame ring
+ * @date 2026-10-16
+ *
+ * Responsibilities:
+ * - ScopedRenderPassTimer measures one phase (Execute, BeginPass, EndPass, Collect, Submit) of the
+ *   pass currently executing and appends it to the current frame slot
+ * - Writers reserve sample slots with an atomic counter, so phases timed off the main thread do not
+ *   take a lock
+ * - Readers (Render Inspection) aggregate completed frames into last/avg/percentile statistics
+ *
+ * Pass names are registered by SceneRenderGraph; samples store the small pass id only.
+ */
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum class RenderPassTimerPhase : uint8_t
+{
+    Execute,
+    BeginPass,
+    EndPass,
+    Collect,
+    Submit,
+    Count
+};
+
+struct RenderPassTimingStats
+{
+    std::string          passName;
+    RenderPassTimerPhase phase       = RenderPassTimerPhase::Execute;
+    int                  sampleCount = 0; // Frames in the ring where this pass/phase ran
+    double               lastMs      = 0.0;
+    double               avgMs       = 0.0;
+    double               p50Ms       = 0.0;
+    double               p95Ms       = 0.0;
+    double               p99Ms       = 0.0;
+    double               maxMs       = 0.0;
+};
+
+class RenderPassTimers
+{
+public:
+    RenderPassTimers()                                   = delete; // Prevent instantiation
+    RenderPassTimers(const RenderPassTimers&)            = delete; // Prevent copy
+    RenderPassTimers& operator=(const RenderPassTimers&) = delete; // Prevent assignment
+
+    static constexpr int      FRAME_HISTORY         = 240;
+    static constexpr int      MAX_SAMPLES_PER_FRAME = 256;
+    static constexpr int      MAX_PASSES            = 64;
+    static constexpr uint16_t UNASSIGNED_PASS       = 0; // Work outside the scene graph (debug passes)
+
+    /// Main thread, once per frame before any pass runs: retires the current slot and clears the next
+    static void BeginFrame();
+
+    /// Main thread: returns a stable id for the name (registering it on first use)
+    static uint16_t RegisterPass(const std::string& passName);
+    static void     SetCurrentPass(uint16_t passId);
+    static uint16_t GetCurrentPass();
+
+    /// Any thread
+    static void Record(uint16_t passId, RenderPassTimerPhase phase, double milliseconds);
+
+    /// Aggregate the completed frames in the ring; entries are ordered by pass id then phase
+    static std::vector<RenderPassTimingStats> BuildStats();
+
+    /// Only the last completed frame: passName, phase and lastMs (sampleCount 1); no sorting, for per-frame capture
+    static std::vector<RenderPassTimingStats> BuildLastFrameStats();
+    static void                               Reset();
+
+    static const char* GetPhaseName(RenderPassTimerPhase phase);
+    static const char* GetPassName(uint16_t passId);
+
+private:
+    struct Sample
+    {
+        uint16_t             passId = UNASSIGNED_PASS;
+        RenderPassTimerPhase phase  = RenderPassTimerPhase::Execute;
+        float                ms     = 0.0f;
+    };
+
+    struct FrameSlot
+    {
+        std::atomic<uint32_t>                     count{0};
+        std::array<Sample, MAX_SAMPLES_PER_FRAME> samples;
+    };
+
+    static std::array<FrameSlot, FRAME_HISTORY>         s_frames;
+    static std::atomic<uint64_t>                        s_frameIndex;
+    static std::atomic<uint16_t>                        s_currentPass;
+    static std::array<std::array<char, 32>, MAX_PASSES> s_passNames;
+    static uint16_t                                     s_passCount;
+};
+
+/// Times the enclosing scope as one phase of the pass that is current at construction
+class ScopedRenderPassTimer
+{
+public:
+    explicit ScopedRenderPassTimer(RenderPassTimerPhase phase);
+    ~ScopedRenderPassTimer();
+    ScopedRenderPassTimer(const ScopedRenderPassTimer&)            = delete;
+    ScopedRenderPassTimer& operator=(const ScopedRenderPassTimer&) = delete;
+
+private:
+    uint16_t                              m_passId;
+    RenderPassTimerPhase                  m_phase;
+    std::chrono::steady_clock::time_point m_start;
+};
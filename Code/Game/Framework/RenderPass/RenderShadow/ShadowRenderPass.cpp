@@ -1,5 +1,6 @@
 ﻿#include "ShadowRenderPass.hpp"
 #include "Game/GameCommon.hpp"
+#include "Game/Framework/RenderGraph/SceneRenderGraph.hpp"
 #include "Game/Gameplay/Game.hpp"
 #include "Game/Framework/GameObject/PlayerCharacter.hpp"
 #include "Engine/Graphic/Core/DX12/D3D12RenderSystem.hpp"
@@ -23,6 +24,7 @@
 #include "Engine/Voxel/Chunk/ChunkBatchCollector.hpp"
 #include "Engine/Voxel/Chunk/ChunkBatchRenderer.hpp"
 #include "Game/Framework/RenderPass/RenderPassHelper.hpp"
+#include "Game/Framework/RenderPass/RenderPassTimers.hpp"
 
 using namespace enigma::graphic;
 
@@ -70,7 +72,7 @@ ShadowRenderPass::ShadowRenderPass()
 
 void ShadowRenderPass::Execute()
 {
-    BeginPass();
+    TimedBeginPass();
 
     // Update shadow camera matrices
     UpdateShadowCamera();
@@ -78,7 +80,7 @@ void ShadowRenderPass::Execute()
     // Render terrain to shadow map
     RenderShadowMap();
 
-    EndPass();
+    TimedEndPass();
 }
 
 void ShadowRenderPass::OnShaderBundleLoaded(enigma::graphic::ShaderBundle* newBundle)
@@ -223,18 +225,22 @@ void ShadowRenderPass::RenderShadowMap()
     viewContext.world  = world;
     viewContext.camera = m_shadowCamera.get();
 
+    auto& stats = world->MutableChunkBatchStats();
+
     // ========================================================================
     // Pass 1: Render Opaque + Cutout → shadowtex0
     // [Iris Ref] ShadowRenderer.java:464-469 - solid, cutout, cutoutMipped
     // ========================================================================
-    enigma::voxel::ChunkBatchCollection opaqueCutoutCollection = enigma::voxel::ChunkBatchCollector::Collect(
-        viewContext,
-        enigma::voxel::ChunkBatchLayer::Opaque);
-    opaqueCutoutCollection.Append(enigma::voxel::ChunkBatchCollector::Collect(
-        viewContext,
-        enigma::voxel::ChunkBatchLayer::Cutout));
-    auto& stats = world->MutableChunkBatchStats();
-    stats.batchedDraws += enigma::voxel::ChunkBatchRenderer::Submit(opaqueCutoutCollection);
+    enigma::voxel::ChunkBatchCollection opaqueCutoutCollection;
+    {
+        ScopedRenderPassTimer collectTimer(RenderPassTimerPhase::Collect);
+        opaqueCutoutCollection = enigma::voxel::ChunkBatchCollector::Collect(viewContext, enigma::voxel::ChunkBatchLayer::Opaque);
+        opaqueCutoutCollection.Append(enigma::voxel::ChunkBatchCollector::Collect(viewContext, enigma::voxel::ChunkBatchLayer::Cutout));
+    }
+    {
+        ScopedRenderPassTimer submitTimer(RenderPassTimerPhase::Submit);
+        stats.batchedDraws += enigma::voxel::ChunkBatchRenderer::Submit(opaqueCutoutCollection);
+    }
 
     // ========================================================================
     // Copy shadowtex0 → shadowtex1 (freeze pre-translucent depth)
@@ -248,10 +254,15 @@ void ShadowRenderPass::RenderShadowMap()
     // [Iris Ref] ShadowRenderer.java:540-542 - translucent layer
     // shadowtex1 remains "frozen" with opaque+cutout depth only
     // ========================================================================
-    const enigma::voxel::ChunkBatchCollection translucentCollection = enigma::voxel::ChunkBatchCollector::Collect(
-        viewContext,
-        enigma::voxel::ChunkBatchLayer::Translucent);
-    stats.batchedDraws += enigma::voxel::ChunkBatchRenderer::Submit(translucentCollection);
+    enigma::voxel::ChunkBatchCollection translucentCollection;
+    {
+        ScopedRenderPassTimer collectTimer(RenderPassTimerPhase::Collect);
+        translucentCollection = enigma::voxel::ChunkBatchCollector::Collect(viewContext, enigma::voxel::ChunkBatchLayer::Translucent);
+    }
+    {
+        ScopedRenderPassTimer submitTimer(RenderPassTimerPhase::Submit);
+        stats.batchedDraws += enigma::voxel::ChunkBatchRenderer::Submit(translucentCollection);
+    }
 }
 
 Vec3 ShadowRenderPass::SnapToGrid(const Vec3& pos, float interval)
@@ -274,3 +285,14 @@ Vec3 ShadowRenderPass::SnapToGrid(const Vec3& pos, float interval)
         pos.z - offsetZ
     );
 }
+
+void ShadowRenderPass::DeclareResources(RenderGraph& graph) const
+{
+    // shadow.ps pulls lib/lighting.hlsl, whose shadow lookups are never called while rendering the
+    // shadow map, so no scanned reads. shadowtex1 is the Copy(0, 1) destination between draws.
+    int pass = graph.AddPass("shadow");
+    graph.Write(pass, {RenderGraphResourceType::ShadowTex, 0});
+    graph.Write(pass, {RenderGraphResourceType::ShadowTex, 1});
+    graph.Write(pass, {RenderGraphResourceType::ShadowColor, 0});
+    graph.Write(pass, {RenderGraphResourceType::ShadowColor, 1});
+}
@@ -39,6 +39,7 @@ public:
     ~ShadowRenderPass() override = default;
 
     void Execute() override;
+    void DeclareResources(RenderGraph& graph) const override;
 
 protected:
     void OnShaderBundleLoaded(enigma::graphic::ShaderBundle* newBundle) override;
@@ -2,6 +2,7 @@
 
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Graphic/Bundle/Integration/ShaderBundleSubsystem.hpp"
+#include "Game/Framework/RenderGraph/SceneRenderGraph.hpp"
 
 void ShadowCompositeRenderPass::Execute()
 {
@@ -56,3 +57,16 @@ void ShadowCompositeRenderPass::EndPass()
 {
     // Intentionally empty while ShadowComposite has no draw path.
 }
+
+void ShadowCompositeRenderPass::DeclareResources(RenderGraph& graph) const
+{
+    // No draw path yet; reads are declared so ordering is already validated when one lands
+    int pass = graph.AddPass("shadowcomp");
+    for (const auto& program : m_shaderPrograms)
+    {
+        if (program)
+        {
+            SceneRenderGraph::DeclareProgramReads(graph, pass, *program);
+        }
+    }
+}
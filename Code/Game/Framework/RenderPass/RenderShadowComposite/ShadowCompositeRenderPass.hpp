@@ -7,6 +7,7 @@ public:
     ~ShadowCompositeRenderPass() override;
     ShadowCompositeRenderPass();
     void Execute() override;
+    void DeclareResources(RenderGraph& graph) const override;
 
 protected:
     void OnShaderBundleLoaded(enigma::graphic::ShaderBundle* newBundle) override;
@@ -4,6 +4,7 @@
 #include "Engine/Graphic/Integration/RendererSubsystem.hpp"
 #include "Engine/Graphic/Target/RTTypes.hpp"
 #include "Game/GameCommon.hpp"
+#include "Game/Framework/RenderGraph/SceneRenderGraph.hpp"
 #include "Engine/Graphic/Shader/Uniform/UniformManager.hpp"
 #include "Game/Framework/RenderPass/ConstantBuffer/CelestialConstantBuffer.hpp"
 #include "Game/Framework/RenderPass/ConstantBuffer/CommonConstantBuffer.hpp"
@@ -62,7 +63,7 @@ void SkyBasicRenderPass::Execute()
 {
     if (!m_skyBasicShader) return;
 
-    BeginPass();
+    TimedBeginPass();
 
     auto uploadSkyScopeMatrices = [this]()
     {
@@ -116,7 +117,7 @@ void SkyBasicRenderPass::Execute()
         RenderSunsetStrip();
     }
 
-    EndPass();
+    TimedEndPass();
 }
 
 void SkyBasicRenderPass::BeginPass()
@@ -210,9 +211,22 @@ bool SkyBasicRenderPass::ShouldRenderSunsetStrip(float sunAngle) const
     return (cosValue >= -THRESHOLD) && (cosValue <= THRESHOLD);
 }
 
+void SkyBasicRenderPass::BeginFrame()
+{
+    // Rebake the color tables if ImGui edited them, also in frames where the sky pass is skipped
+    SkyColorHelper::RefreshLuts();
+}
+
 bool SkyBasicRenderPass::ShouldRenderVoidDome() const
 {
     constexpr float HORIZON_HEIGHT = 63.0f;
     Vec3            cameraPos      = g_theGame->GetRenderCamera()->GetPosition();
     return cameraPos.z < HORIZON_HEIGHT;
 }
+
+void SkyBasicRenderPass::DeclareResources(RenderGraph& graph) const
+{
+    int pass = graph.AddPass("skybasic");
+    graph.Write(pass, {RenderGraphResourceType::ColorTex, 0});
+    graph.Write(pass, {RenderGraphResourceType::DepthTex, 0});
+}
@@ -20,6 +20,10 @@ public:
     SkyBasicRenderPass();
     ~SkyBasicRenderPass() override;
     void Execute() override;
+    void DeclareResources(RenderGraph& graph) const override;
+
+    // Called once per frame before any pass: rebakes the CPU sky color tables if ImGui edited them
+    void BeginFrame();
 
 protected:
     void BeginPass() override;
@@ -77,6 +77,74 @@ SkyPhaseColors     SkyColorHelper::s_fogColors    = SkyPhaseColors::GetDefaultFo
 SunriseStripColors SkyColorHelper::s_stripColors  = SunriseStripColors::GetDefault();
 SkyEasingConfig    SkyColorHelper::s_easingConfig = SkyEasingConfig::GetDefault();
 
+std::vector<Vec3> SkyColorHelper::s_skyLut;
+std::vector<Vec3> SkyColorHelper::s_fogLut;
+std::vector<Vec4> SkyColorHelper::s_sunriseLut;
+std::vector<Vec3> SkyColorHelper::s_skyWithFogLut;
+bool              SkyColorHelper::s_lutDirty   = true;
+
+namespace
+{
+    // Configuration the tables were baked from, to catch in-place edits through the Get* references
+    SkyPhaseColors     s_bakedSkyColors;
+    SkyPhaseColors     s_bakedFogColors;
+    SunriseStripColors s_bakedStripColors;
+    SkyEasingConfig    s_bakedEasingConfig;
+
+    bool SameVec3(const Vec3& a, const Vec3& b)
+    {
+        return a.x == b.x && a.y == b.y && a.z == b.z;
+    }
+
+    bool SameEasingCurve(const BezierEasing& a, const BezierEasing& b)
+    {
+        return a.p1.x == b.p1.x && a.p1.y == b.p1.y && a.p2.x == b.p2.x && a.p2.y == b.p2.y;
+    }
+
+    bool SamePhaseColors(const SkyPhaseColors& a, const SkyPhaseColors& b)
+    {
+        return SameVec3(a.sunrise, b.sunrise) && SameVec3(a.dawn, b.dawn) && SameVec3(a.noon, b.noon) &&
+            SameVec3(a.sunset, b.sunset) && SameVec3(a.midnight, b.midnight);
+    }
+
+    bool SameStripColors(const SunriseStripColors& a, const SunriseStripColors& b)
+    {
+        return SameVec3(a.sunriseStrip, b.sunriseStrip) && SameVec3(a.sunsetStrip, b.sunsetStrip);
+    }
+
+    bool SameEasing(const SkyEasingConfig& a, const SkyEasingConfig& b)
+    {
+        return SameEasingCurve(a.noonToSunset, b.noonToSunset) && SameEasingCurve(a.sunsetToMidnight, b.sunsetToMidnight) &&
+            SameEasingCurve(a.midnightToSunrise, b.midnightToSunrise) && SameEasingCurve(a.sunriseToDawn, b.sunriseToDawn) &&
+            SameEasingCurve(a.dawnToNoon, b.dawnToNoon);
+    }
+
+    Vec3 LerpColor(const Vec3& a, const Vec3& b, float t)
+    {
+        return Interpolate(a, b, t);
+    }
+
+    Vec4 LerpColor(const Vec4& a, const Vec4& b, float t)
+    {
+        return Vec4(a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t, a.z + (b.z - a.z) * t, a.w + (b.w - a.w) * t);
+    }
+
+    /// Linear lookup into a table over celestialAngle [0, 1), wrapping at 1
+    template <typename T>
+    T SampleAngleLut(const std::vector<T>& lut, float celestialAngle, int rowOffset = 0)
+    {
+        constexpr int SAMPLES = SkyColorHelper::LUT_ANGLE_SAMPLES;
+
+        float angle = celestialAngle - std::floor(celestialAngle);
+        float f     = angle * static_cast<float>(SAMPLES);
+        int   i0    = static_cast<int>(f);
+        if (i0 >= SAMPLES) i0 = SAMPLES - 1;
+        const int   i1 = (i0 + 1) % SAMPLES;
+        const float t  = f - static_cast<float>(i0);
+        return LerpColor(lut[rowOffset + i0], lut[rowOffset + i1], t);
+    }
+}
+
 //-----------------------------------------------------------------------------------------------
 // Calculate daylight factor from celestial angle
 // Reference: WorldTimeProvider.cpp CalculateCloudColor()
@@ -139,21 +207,25 @@ SkyPhaseColors& SkyColorHelper::GetFogColors()
 void SkyColorHelper::SetSkyColors(const SkyPhaseColors& colors)
 {
     s_skyColors = colors;
+    s_lutDirty = true;
 }
 
 void SkyColorHelper::SetFogColors(const SkyPhaseColors& colors)
 {
     s_fogColors = colors;
+    s_lutDirty = true;
 }
 
 void SkyColorHelper::ResetSkyColorsToDefault()
 {
     s_skyColors = SkyPhaseColors::GetDefaultSkyColors();
+    s_lutDirty = true;
 }
 
 void SkyColorHelper::ResetFogColorsToDefault()
 {
     s_fogColors = SkyPhaseColors::GetDefaultFogColors();
+    s_lutDirty = true;
 }
 
 // Sunrise strip color accessors
@@ -165,11 +237,13 @@ SunriseStripColors& SkyColorHelper::GetStripColors()
 void SkyColorHelper::SetStripColors(const SunriseStripColors& colors)
 {
     s_stripColors = colors;
+    s_lutDirty = true;
 }
 
 void SkyColorHelper::ResetStripColorsToDefault()
 {
     s_stripColors = SunriseStripColors::GetDefault();
+    s_lutDirty = true;
 }
 
 // Easing configuration accessors
@@ -181,20 +255,78 @@ SkyEasingConfig& SkyColorHelper::GetEasingConfig()
 void SkyColorHelper::SetEasingConfig(const SkyEasingConfig& config)
 {
     s_easingConfig = config;
+    s_lutDirty = true;
 }
 
 void SkyColorHelper::ResetEasingToDefault()
 {
     s_easingConfig = SkyEasingConfig::GetDefault();
+    s_lutDirty = true;
 }
 
 void SkyColorHelper::SetMinecraftStyleEasing()
 {
     s_easingConfig = SkyEasingConfig::GetMinecraftStyle();
+    s_lutDirty = true;
+}
+
+//-----------------------------------------------------------------------------------------------
+// Calculate sky color from the baked table (5-phase interpolation with Bezier easing)
+Vec3 SkyColorHelper::CalculateSkyColor(float celestialAngle)
+{
+    EnsureLuts();
+    return SampleAngleLut(s_skyLut, celestialAngle);
 }
 
 //-----------------------------------------------------------------------------------------------
-// Calculate sky color using 5-phase interpolation with Bezier easing
+// Calculate fog color from the baked table (same phases as CalculateSkyColor)
+Vec3 SkyColorHelper::CalculateFogColor(float celestialAngle, float sunAngle)
+{
+    // sunAngle parameter is kept for API compatibility but not used
+    (void)sunAngle;
+
+    EnsureLuts();
+    return SampleAngleLut(s_fogLut, celestialAngle);
+}
+
+//-----------------------------------------------------------------------------------------------
+// Calculate sunrise/sunset glow color from the baked table
+Vec4 SkyColorHelper::CalculateSunriseColor(float celestialAngle)
+{
+    EnsureLuts();
+    Vec4 result = SampleAngleLut(s_sunriseLut, celestialAngle);
+
+    // Early exit if no glow visible (equivalent to Minecraft returning null)
+    if (result.w < 0.001f)
+    {
+        return Vec4(0.0f, 0.0f, 0.0f, 0.0f);
+    }
+    return result;
+}
+
+//-----------------------------------------------------------------------------------------------
+// Calculate sky color with CPU-side fog blending from the baked (angle, elevation) table
+Vec3 SkyColorHelper::CalculateSkyColorWithFog(float celestialAngle, float elevationDegrees)
+{
+    EnsureLuts();
+
+    // Elevation rows cover [0, 90] degrees
+    float clampedElevation = elevationDegrees;
+    if (clampedElevation < 0.0f) clampedElevation = 0.0f;
+    if (clampedElevation > 90.0f) clampedElevation = 90.0f;
+
+    const float row  = clampedElevation / 90.0f * static_cast<float>(LUT_ELEVATION_SAMPLES - 1);
+    const int   row0 = static_cast<int>(row);
+    const int   row1 = row0 + 1 < LUT_ELEVATION_SAMPLES ? row0 + 1 : row0;
+    const float t    = row - static_cast<float>(row0);
+
+    const Vec3 color0 = SampleAngleLut(s_skyWithFogLut, celestialAngle, row0 * LUT_ANGLE_SAMPLES);
+    const Vec3 color1 = SampleAngleLut(s_skyWithFogLut, celestialAngle, row1 * LUT_ANGLE_SAMPLES);
+    return Interpolate(color0, color1, t);
+}
+
+//-----------------------------------------------------------------------------------------------
+// 5-phase interpolation with Bezier easing, evaluated exactly (table baking only)
 //
 // Phase boundaries (5-phase):
 // - Phase 0 (0.0 - 0.25):   Noon -> Sunset
@@ -202,14 +334,13 @@ void SkyColorHelper::SetMinecraftStyleEasing()
 // - Phase 2 (0.5 - 0.75):   Midnight -> Sunrise
 // - Phase 3 (0.75 - 0.79):  Sunrise -> Dawn
 // - Phase 4 (0.79 - 1.0):   Dawn -> Noon
-Vec3 SkyColorHelper::CalculateSkyColor(float celestialAngle)
+Vec3 SkyColorHelper::EvaluatePhaseColor(const SkyPhaseColors& colors, float celestialAngle)
 {
-    // Use static phase colors (can be modified via ImGui)
-    const Vec3& COLOR_SUNRISE  = s_skyColors.sunrise;
-    const Vec3& COLOR_DAWN     = s_skyColors.dawn;
-    const Vec3& COLOR_NOON     = s_skyColors.noon;
-    const Vec3& COLOR_SUNSET   = s_skyColors.sunset;
-    const Vec3& COLOR_MIDNIGHT = s_skyColors.midnight;
+    const Vec3& COLOR_SUNRISE  = colors.sunrise;
+    const Vec3& COLOR_DAWN     = colors.dawn;
+    const Vec3& COLOR_NOON     = colors.noon;
+    const Vec3& COLOR_SUNSET   = colors.sunset;
+    const Vec3& COLOR_MIDNIGHT = colors.midnight;
 
     // Normalize celestialAngle to [0, 1)
     float angle = celestialAngle;
@@ -259,71 +390,10 @@ Vec3 SkyColorHelper::CalculateSkyColor(float celestialAngle)
 }
 
 //-----------------------------------------------------------------------------------------------
-// Calculate fog color using 5-phase interpolation with Bezier easing
-Vec3 SkyColorHelper::CalculateFogColor(float celestialAngle, float sunAngle)
-{
-    // Use static phase colors (can be modified via ImGui)
-    const Vec3& FOG_SUNRISE  = s_fogColors.sunrise;
-    const Vec3& FOG_DAWN     = s_fogColors.dawn;
-    const Vec3& FOG_NOON     = s_fogColors.noon;
-    const Vec3& FOG_SUNSET   = s_fogColors.sunset;
-    const Vec3& FOG_MIDNIGHT = s_fogColors.midnight;
-
-    // Normalize celestialAngle to [0, 1)
-    float angle = celestialAngle;
-    while (angle < 0.0f) angle += 1.0f;
-    while (angle >= 1.0f) angle -= 1.0f;
-
-    Vec3 result;
-
-    // 5-phase interpolation with Bezier easing (same phases as CalculateSkyColor)
-    if (angle < 0.25f)
-    {
-        // Phase 0: Noon (0.0) to Sunset (0.25)
-        float t      = angle / 0.25f;
-        float easedT = s_easingConfig.noonToSunset.Apply(t);
-        result       = Interpolate(FOG_NOON, FOG_SUNSET, easedT);
-    }
-    else if (angle < 0.5f)
-    {
-        // Phase 1: Sunset (0.25) to Midnight (0.5)
-        float t      = (angle - 0.25f) / 0.25f;
-        float easedT = s_easingConfig.sunsetToMidnight.Apply(t);
-        result       = Interpolate(FOG_SUNSET, FOG_MIDNIGHT, easedT);
-    }
-    else if (angle < 0.75f)
-    {
-        // Phase 2: Midnight (0.5) to Sunrise (0.75)
-        float t      = (angle - 0.5f) / 0.25f;
-        float easedT = s_easingConfig.midnightToSunrise.Apply(t);
-        result       = Interpolate(FOG_MIDNIGHT, FOG_SUNRISE, easedT);
-    }
-    else if (angle < 0.79f)
-    {
-        // Phase 3: Sunrise (0.75) to Dawn (0.79)
-        float t      = (angle - 0.75f) / 0.04f;
-        float easedT = s_easingConfig.sunriseToDawn.Apply(t);
-        result       = Interpolate(FOG_SUNRISE, FOG_DAWN, easedT);
-    }
-    else
-    {
-        // Phase 4: Dawn (0.79) to Noon (1.0/0.0)
-        float t      = (angle - 0.79f) / 0.21f;
-        float easedT = s_easingConfig.dawnToNoon.Apply(t);
-        result       = Interpolate(FOG_DAWN, FOG_NOON, easedT);
-    }
-
-    // sunAngle parameter is kept for API compatibility but not used
-    (void)sunAngle;
-
-    return result;
-}
-
-//-----------------------------------------------------------------------------------------------
-// Calculate sunrise/sunset glow color using configurable strip colors
+// Sunrise/sunset glow color using configurable strip colors, evaluated exactly (table baking only)
 // Reference: Minecraft DimensionSpecialEffects.java:44-59 getSunriseColor()
 // @param celestialAngle timeOfDay value (0.0-1.0), NOT Iris sunAngle
-Vec4 SkyColorHelper::CalculateSunriseColor(float celestialAngle)
+Vec4 SkyColorHelper::EvaluateSunriseColor(float celestialAngle)
 {
     float intensity = CalculateSunsetFactor(celestialAngle);
 
@@ -356,33 +426,63 @@ Vec4 SkyColorHelper::CalculateSunriseColor(float celestialAngle)
 }
 
 //-----------------------------------------------------------------------------------------------
-// Calculate sky color with CPU-side fog blending based on elevation angle
-Vec3 SkyColorHelper::CalculateSkyColorWithFog(float celestialAngle, float elevationDegrees)
+// Rebake when the configuration was edited in place since the last bake
+void SkyColorHelper::RefreshLuts()
 {
-    // Step 1: Get base colors for current time
-    Vec3 skyColor = CalculateSkyColor(celestialAngle);
-    Vec3 fogColor = CalculateFogColor(celestialAngle, 0.0f);
+    if (!SamePhaseColors(s_bakedSkyColors, s_skyColors) ||
+        !SamePhaseColors(s_bakedFogColors, s_fogColors) ||
+        !SameStripColors(s_bakedStripColors, s_stripColors) ||
+        !SameEasing(s_bakedEasingConfig, s_easingConfig))
+    {
+        s_lutDirty = true;
+    }
+    EnsureLuts();
+}
 
-    // Step 2: Clamp elevation to valid range [0, 90] for sky dome
-    float clampedElevation = elevationDegrees;
-    if (clampedElevation < 0.0f) clampedElevation = 0.0f;
-    if (clampedElevation > 90.0f) clampedElevation = 90.0f;
+//-----------------------------------------------------------------------------------------------
+// Rebake when a setter marked the tables dirty
+void SkyColorHelper::EnsureLuts()
+{
+    if (s_lutDirty)
+    {
+        BakeLuts();
+    }
+}
 
-    // Step 3: Calculate elevation factor with smooth falloff
-    constexpr float DEG_TO_RAD   = 0.017453292f;
-    float           elevationRad = clampedElevation * DEG_TO_RAD;
-    float           sinElevation = std::sin(elevationRad);
+//-----------------------------------------------------------------------------------------------
+// Bake all tables from the current configuration
+void SkyColorHelper::BakeLuts()
+{
+    s_skyLut.resize(LUT_ANGLE_SAMPLES);
+    s_fogLut.resize(LUT_ANGLE_SAMPLES);
+    s_sunriseLut.resize(LUT_ANGLE_SAMPLES);
+    s_skyWithFogLut.resize(static_cast<size_t>(LUT_ANGLE_SAMPLES) * LUT_ELEVATION_SAMPLES);
 
-    // Smooth falloff: sqrt gives more gradual transition near horizon
-    float elevationFactor = std::sqrt(sinElevation);
+    for (int i = 0; i < LUT_ANGLE_SAMPLES; ++i)
+    {
+        const float angle = static_cast<float>(i) / static_cast<float>(LUT_ANGLE_SAMPLES);
+        s_skyLut[i]       = EvaluatePhaseColor(s_skyColors, angle);
+        s_fogLut[i]       = EvaluatePhaseColor(s_fogColors, angle);
+        s_sunriseLut[i]   = EvaluateSunriseColor(angle);
+    }
 
-    // Step 4: Blend fogColor -> skyColor based on elevation
-    Vec3 result;
-    result.x = fogColor.x + (skyColor.x - fogColor.x) * elevationFactor;
-    result.y = fogColor.y + (skyColor.y - fogColor.y) * elevationFactor;
-    result.z = fogColor.z + (skyColor.z - fogColor.z) * elevationFactor;
+    // Blend fogColor -> skyColor by elevation; sqrt gives a more gradual transition near the horizon
+    constexpr float DEG_TO_RAD = 0.017453292f;
+    for (int row = 0; row < LUT_ELEVATION_SAMPLES; ++row)
+    {
+        const float elevationDegrees = 90.0f * static_cast<float>(row) / static_cast<float>(LUT_ELEVATION_SAMPLES - 1);
+        const float elevationFactor  = std::sqrt(std::sin(elevationDegrees * DEG_TO_RAD));
+        for (int i = 0; i < LUT_ANGLE_SAMPLES; ++i)
+        {
+            s_skyWithFogLut[row * LUT_ANGLE_SAMPLES + i] = Interpolate(s_fogLut[i], s_skyLut[i], elevationFactor);
+        }
+    }
 
-    return result;
+    s_bakedSkyColors    = s_skyColors;
+    s_bakedFogColors    = s_fogColors;
+    s_bakedStripColors  = s_stripColors;
+    s_bakedEasingConfig = s_easingConfig;
+    s_lutDirty          = false;
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -1,4 +1,6 @@
 #pragma once
+#include <vector>
+
 #include "Engine/Math/Vec2.hpp"
 #include "Engine/Math/Vec3.hpp"
 #include "Engine/Math/Vec4.hpp"
@@ -204,6 +206,12 @@ struct SunriseStripColors
  *       - celestialAngle 0.79  = tick 1000  = 7:00 AM  (Dawn)
  *
  * @note Reference: Iris CelestialUniforms.java:24-32 getSunAngle()
+ *
+ * @note The Calculate* functions read lookup tables baked from the phase colors and easing curves
+ *       (1D over celestialAngle, 2D over celestialAngle x elevation), so per-vertex calls are table
+ *       lookups instead of Newton-Raphson Bezier solves. The setters rebake on the next lookup;
+ *       in-place edits through the references returned by the Get* accessors (ImGui) are picked
+ *       up by RefreshLuts(), which the sky pass calls once per frame.
  */
 class SkyColorHelper
 {
@@ -293,6 +301,16 @@ public:
      */
     static float CalculateElevationAngle(const Vec3& vertexPos);
 
+    //-----------------------------------------------------------------------------------------------
+    // Baked lookup tables (CPU only): sky, fog and sunrise strip color per celestialAngle sample in
+    // [0, 1), and sky blended with fog per celestialAngle x elevation (0 to 90 degrees)
+
+    static constexpr int LUT_ANGLE_SAMPLES     = 512;
+    static constexpr int LUT_ELEVATION_SAMPLES = 64;
+
+    /// Once per frame: rebake if the configuration was edited through the Get* references
+    static void RefreshLuts();
+
 private:
     // Static storage for configurable phase colors and easing
     static SkyPhaseColors     s_skyColors;
@@ -300,6 +318,20 @@ private:
     static SunriseStripColors s_stripColors;
     static SkyEasingConfig    s_easingConfig;
 
+    // Baked tables and the configuration they were baked from
+    static std::vector<Vec3> s_skyLut;
+    static std::vector<Vec3> s_fogLut;
+    static std::vector<Vec4> s_sunriseLut;
+    static std::vector<Vec3> s_skyWithFogLut; // angle + elevation * LUT_ANGLE_SAMPLES
+    static bool              s_lutDirty;
+
+    static void EnsureLuts();
+    static void BakeLuts();
+
+    /// Exact evaluation used for baking
+    static Vec3 EvaluatePhaseColor(const SkyPhaseColors& colors, float celestialAngle);
+    static Vec4 EvaluateSunriseColor(float celestialAngle);
+
     //-----------------------------------------------------------------------------------------------
     /**
      * @brief Calculate daylight factor from celestialAngle (matches Minecraft vanilla)
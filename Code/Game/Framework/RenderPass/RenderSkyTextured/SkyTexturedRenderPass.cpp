@@ -5,6 +5,7 @@
 #include "Engine/Graphic/Target/RTTypes.hpp"
 #include "Engine/Graphic/Shader/Uniform/PerObjectUniforms.hpp"
 #include "Game/GameCommon.hpp"
+#include "Game/Framework/RenderGraph/SceneRenderGraph.hpp"
 #include "Engine/Graphic/Sprite/SpriteAtlas.hpp"
 #include "Engine/Graphic/Shader/Uniform/UniformManager.hpp"
 #include "Engine/Graphic/Sprite/Sprite.hpp"
@@ -65,7 +66,7 @@ void SkyTexturedRenderPass::Execute()
 {
     if (!m_skyBasicShader || !m_skyTexturedShader) return;
 
-    BeginPass();
+    TimedBeginPass();
 
     // Pre-compute celestial matrices once per frame
     UpdateCelestialMatrices();
@@ -111,7 +112,7 @@ void SkyTexturedRenderPass::Execute()
     beginSkyScope("SkyTextured::Moon");
     RenderMoon();
 
-    EndPass();
+    TimedEndPass();
 }
 
 void SkyTexturedRenderPass::BeginPass()
@@ -266,3 +267,10 @@ void SkyTexturedRenderPass::UpdateCelestialMatrices()
 
     m_celestialViewInverse = m_celestialView.GetInverse();
 }
+
+void SkyTexturedRenderPass::DeclareResources(RenderGraph& graph) const
+{
+    int pass = graph.AddPass("skytextured");
+    graph.Write(pass, {RenderGraphResourceType::ColorTex, 0});
+    graph.Write(pass, {RenderGraphResourceType::DepthTex, 0});
+}
@@ -25,6 +25,7 @@ public:
     SkyTexturedRenderPass();
     ~SkyTexturedRenderPass() override;
     void Execute() override;
+    void DeclareResources(RenderGraph& graph) const override;
 
 protected:
     void BeginPass() override;
@@ -0,0 +1,174 @@
+#include "PackedTerrainVertex.hpp"
+
+#include <cmath>
+
+namespace
+{
+    constexpr float INV_SQRT2 = 0.70710678f;
+
+    // Must match TERRAIN_FACE_NORMALS in lib/terrainVertex.hlsl
+    const Vec3 FACE_NORMALS[static_cast<int>(TerrainVertexFace::Count)] = {
+        Vec3(-1.0f, 0.0f, 0.0f),
+        Vec3(1.0f, 0.0f, 0.0f),
+        Vec3(0.0f, -1.0f, 0.0f),
+        Vec3(0.0f, 1.0f, 0.0f),
+        Vec3(0.0f, 0.0f, -1.0f),
+        Vec3(0.0f, 0.0f, 1.0f),
+        Vec3(INV_SQRT2, INV_SQRT2, 0.0f),
+        Vec3(-INV_SQRT2, INV_SQRT2, 0.0f),
+        Vec3(-INV_SQRT2, -INV_SQRT2, 0.0f),
+        Vec3(INV_SQRT2, -INV_SQRT2, 0.0f),
+    };
+
+    bool QuantizeUnsigned(float value, float scale, int maxValue, int& outValue)
+    {
+        const float scaled = std::round(value * scale);
+        if (scaled < 0.0f || scaled > static_cast<float>(maxValue))
+        {
+            return false;
+        }
+        outValue = static_cast<int>(scaled);
+        return true;
+    }
+
+    uint32_t QuantizeLight(float level)
+    {
+        const float clamped = level < 0.0f ? 0.0f : (level > 1.0f ? 1.0f : level);
+        return static_cast<uint32_t>(std::round(clamped * 15.0f));
+    }
+
+    int GetLog2(int value)
+    {
+        int log2 = 0;
+        while ((1 << log2) < value)
+        {
+            ++log2;
+        }
+        return log2;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+TerrainVertexFace GetTerrainVertexFace(const Vec3& normal)
+{
+    int   best    = 0;
+    float bestDot = -2.0f;
+    for (int i = 0; i < static_cast<int>(TerrainVertexFace::Count); ++i)
+    {
+        const Vec3& candidate = FACE_NORMALS[i];
+        const float dot       = normal.x * candidate.x + normal.y * candidate.y + normal.z * candidate.z;
+        if (dot > bestDot)
+        {
+            bestDot = dot;
+            best    = i;
+        }
+    }
+    return static_cast<TerrainVertexFace>(best);
+}
+
+// ------------------------------------------------------------------------------------------------
+Vec3 GetTerrainVertexFaceNormal(TerrainVertexFace face)
+{
+    const int index = static_cast<int>(face);
+    if (index < 0 || index >= static_cast<int>(TerrainVertexFace::Count))
+    {
+        return FACE_NORMALS[static_cast<int>(TerrainVertexFace::PosZ)];
+    }
+    return FACE_NORMALS[index];
+}
+
+// ------------------------------------------------------------------------------------------------
+bool PackTerrainVertex(const TerrainVertexAttributes& vertex, const TerrainAtlasGrid& grid, PackedTerrainVertex& outPacked)
+{
+    const int tileTexels = grid.tileTexels;
+    if (tileTexels <= 0 || (tileTexels & (tileTexels - 1)) != 0 || grid.atlasTexels.x <= 0 || grid.atlasTexels.y <= 0)
+    {
+        return false;
+    }
+
+    // [STEP 1] Position, relative to the draw origin
+    int x = 0;
+    int y = 0;
+    int z = 0;
+    if (!QuantizeUnsigned(vertex.position.x, PackedTerrainVertex::POSITION_SCALE, 0xFFFF, x) ||
+        !QuantizeUnsigned(vertex.position.y, PackedTerrainVertex::POSITION_SCALE, 0xFFFF, y) ||
+        !QuantizeUnsigned(vertex.position.z, PackedTerrainVertex::POSITION_SCALE, 0xFFFF, z))
+    {
+        return false;
+    }
+
+    // [STEP 2] Atlas tile from midTexCoord, which has to be the tile center for the tile to rebuild it
+    const float atlasWidth  = static_cast<float>(grid.atlasTexels.x);
+    const float atlasHeight = static_cast<float>(grid.atlasTexels.y);
+    const float tileSize    = static_cast<float>(tileTexels);
+    const int   column      = static_cast<int>(std::floor(vertex.midTexCoord.x * atlasWidth / tileSize));
+    const int   row         = static_cast<int>(std::floor(vertex.midTexCoord.y * atlasHeight / tileSize));
+    if (column < 0 || row < 0 || column > static_cast<int>(PackedTerrainVertex::TILE_COORD_MASK) || row > static_cast<int>(PackedTerrainVertex::TILE_COORD_MASK))
+    {
+        return false;
+    }
+
+    const float centerU = (static_cast<float>(column) + 0.5f) * tileSize / atlasWidth;
+    const float centerV = (static_cast<float>(row) + 0.5f) * tileSize / atlasHeight;
+    if (std::fabs(centerU - vertex.midTexCoord.x) * atlasWidth > 0.5f || std::fabs(centerV - vertex.midTexCoord.y) * atlasHeight > 0.5f)
+    {
+        return false;
+    }
+
+    // [STEP 3] UV corner inside the tile, or whole tile counts for quads that repeat the texture
+    const float tileU      = (vertex.uv.x * atlasWidth - static_cast<float>(column) * tileSize) / tileSize;
+    const float tileV      = (vertex.uv.y * atlasHeight - static_cast<float>(row) * tileSize) / tileSize;
+    int         cornerU    = 0;
+    int         cornerV    = 0;
+    bool        wholeTiles = false;
+    if (!QuantizeUnsigned(tileU, PackedTerrainVertex::CORNER_SCALE, 0xFF, cornerU) ||
+        !QuantizeUnsigned(tileV, PackedTerrainVertex::CORNER_SCALE, 0xFF, cornerV))
+    {
+        wholeTiles = QuantizeUnsigned(tileU, 1.0f, 0xFF, cornerU) && QuantizeUnsigned(tileV, 1.0f, 0xFF, cornerV) &&
+            std::fabs(static_cast<float>(cornerU) - tileU) * tileSize <= 0.5f && std::fabs(static_cast<float>(cornerV) - tileV) * tileSize <= 0.5f;
+        if (!wholeTiles)
+        {
+            return false;
+        }
+    }
+
+    // [STEP 4] Face, light and the pass-through attributes
+    const uint32_t face       = static_cast<uint32_t>(GetTerrainVertexFace(vertex.normal));
+    const uint32_t blockLight = QuantizeLight(vertex.lightmap.x);
+    const uint32_t skyLight   = QuantizeLight(vertex.lightmap.y);
+    const uint32_t tileLog2   = static_cast<uint32_t>(GetLog2(tileTexels));
+
+    outPacked.x         = static_cast<uint16_t>(x);
+    outPacked.y         = static_cast<uint16_t>(y);
+    outPacked.z         = static_cast<uint16_t>(z);
+    outPacked.faceLight = static_cast<uint16_t>(face << 8 | blockLight << 4 | skyLight | (wholeTiles ? PackedTerrainVertex::WHOLE_TILE_CORNERS : 0u));
+    outPacked.color     = vertex.color;
+    outPacked.tile      = static_cast<uint32_t>(column) | static_cast<uint32_t>(row) << PackedTerrainVertex::TILE_COORD_BITS | tileLog2 << PackedTerrainVertex::TILE_SIZE_LOG2_SHIFT;
+    outPacked.corner    = static_cast<uint16_t>(cornerU | cornerV << 8);
+    outPacked.entityId  = vertex.entityId;
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+TerrainVertexAttributes UnpackTerrainVertex(const PackedTerrainVertex& packed, const TerrainAtlasGrid& grid)
+{
+    TerrainVertexAttributes vertex;
+    vertex.position = Vec3(static_cast<float>(packed.x), static_cast<float>(packed.y), static_cast<float>(packed.z)) / PackedTerrainVertex::POSITION_SCALE;
+    vertex.color    = packed.color;
+    vertex.normal   = GetTerrainVertexFaceNormal(static_cast<TerrainVertexFace>(packed.faceLight >> 8 & 0xF));
+    vertex.lightmap = Vec2(static_cast<float>(packed.faceLight >> 4 & 0xF), static_cast<float>(packed.faceLight & 0xF)) / 15.0f;
+    vertex.entityId = packed.entityId;
+
+    const float tileSize    = static_cast<float>(1u << (packed.tile >> PackedTerrainVertex::TILE_SIZE_LOG2_SHIFT & 0xF));
+    const float column      = static_cast<float>(packed.tile & PackedTerrainVertex::TILE_COORD_MASK);
+    const float row         = static_cast<float>(packed.tile >> PackedTerrainVertex::TILE_COORD_BITS & PackedTerrainVertex::TILE_COORD_MASK);
+    const float cornerScale = (packed.faceLight & PackedTerrainVertex::WHOLE_TILE_CORNERS) != 0 ? 1.0f : PackedTerrainVertex::CORNER_SCALE;
+    const float cornerU     = static_cast<float>(packed.corner & 0xFF) / cornerScale;
+    const float cornerV     = static_cast<float>(packed.corner >> 8) / cornerScale;
+    const float atlasWidth  = static_cast<float>(grid.atlasTexels.x);
+    const float atlasHeight = static_cast<float>(grid.atlasTexels.y);
+
+    vertex.uv          = Vec2((column + cornerU) * tileSize / atlasWidth, (row + cornerV) * tileSize / atlasHeight);
+    vertex.midTexCoord = Vec2((column + 0.5f) * tileSize / atlasWidth, (row + 0.5f) * tileSize / atlasHeight);
+    return vertex;
+}
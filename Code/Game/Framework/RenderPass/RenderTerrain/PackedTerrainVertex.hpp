@@ -0,0 +1,107 @@
+/**
+ * @file PackedTerrainVertex.hpp
+ * @brief 20-byte terrain vertex with chunk-relative quantized positions and atlas tile addressing
+ * @date 2026-10-16
+ *
+ * TerrainVertex (Engine/Voxel/World/TerrainVertexLayout.hpp) is 54 bytes: float3 position, RGBA8 color,
+ * float2 UV, float3 normal, float2 lightmap, uint16 entity id and float2 midTexCoord. A voxel mesh needs
+ * much less: positions are small fractions of a block relative to the draw origin, UVs are corners inside
+ * one atlas tile, normals are one of a few directions and light levels are 4-bit.
+ *
+ *   offset  format             semantic    content
+ *   0       R16G16B16A16_UINT  POSITION    xyz = (position - origin) * POSITION_SCALE
+ *                                          w   = wholeTiles << 12 | face << 8 | blockLight << 4 | skyLight
+ *   8       R8G8B8A8_UNORM     COLOR0      tint and AO, unchanged
+ *   12      R32_UINT           TEXCOORD0   atlas tile: column | row << 12 | log2(tile texels) << 24
+ *   16      R16G16_UINT        TEXCOORD2   x = corner u | corner v << 8 (1/CORNER_SCALE tile), y = entity id
+ *
+ * Greedy-merged quads (GreedyTerrainMesher) repeat their texture over many tiles; their corners are whole
+ * tile counts, stored in whole tiles with the wholeTiles bit set instead of 1/CORNER_SCALE steps.
+ *
+ * The origin is the translation of the draw's model matrix (chunk or batching region min corner), so the
+ * vertex shader only rescales before the usual modelMatrix transform. UV and midTexCoord are rebuilt from
+ * the tile and the atlas size of customImage0, which every terrain and shadow pass binds.
+ *
+ * No shader reads this layout: the engine mesher only writes TerrainVertex, so the terrain programs keep
+ * the 54-byte input. The format is used CPU-side (meshing benchmark, arena size estimate) until the mesher
+ * can emit it; UnpackTerrainVertex() is the reference decode.
+ */
+
+#pragma once
+#include <cstdint>
+
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/IntVec2.hpp"
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Math/Vec3.hpp"
+
+/// Contents of one 54-byte TerrainVertex, positions already relative to the draw origin
+struct TerrainVertexAttributes
+{
+    Vec3     position;
+    Rgba8    color = Rgba8::WHITE;
+    Vec2     uv;
+    Vec3     normal;
+    Vec2     lightmap; // 0-1, x = block light, y = sky light
+    uint16_t entityId = 0;
+    Vec2     midTexCoord;
+};
+
+/// Tile grid of the block atlas, needed to turn UVs into tile + corner and back
+struct TerrainAtlasGrid
+{
+    IntVec2 atlasTexels;     // Atlas image size
+    int     tileTexels = 16; // Power of two
+};
+
+/// Quantized normal directions; cross-shaped plants use the horizontal diagonals
+enum class TerrainVertexFace : uint8_t
+{
+    NegX = 0,
+    PosX,
+    NegY,
+    PosY,
+    NegZ,
+    PosZ,
+    DiagPosXPosY,
+    DiagNegXPosY,
+    DiagNegXNegY,
+    DiagPosXNegY,
+    Count
+};
+
+#pragma pack(push, 1)
+struct PackedTerrainVertex
+{
+    static constexpr float    POSITION_SCALE       = 32.0f;  // 1/32 block steps, 2048 blocks from the origin
+    static constexpr float    CORNER_SCALE         = 128.0f; // 1/128 tile steps, corners up to ~2 tiles
+    static constexpr uint32_t FULL_VERTEX_BYTES    = 54;     // sizeof(TerrainVertex)
+    static constexpr uint32_t TILE_COORD_BITS      = 12;
+    static constexpr uint32_t TILE_COORD_MASK      = (1u << TILE_COORD_BITS) - 1u;
+    static constexpr uint32_t TILE_SIZE_LOG2_SHIFT = 24;
+    static constexpr uint16_t WHOLE_TILE_CORNERS   = 1u << 12; // faceLight flag: corner counts whole tiles
+
+    uint16_t x         = 0;
+    uint16_t y         = 0;
+    uint16_t z         = 0;
+    uint16_t faceLight = 0; // wholeTiles << 12 | face << 8 | block << 4 | sky
+    Rgba8    color;
+    uint32_t tile      = 0;
+    uint16_t corner    = 0; // u | v << 8
+    uint16_t entityId  = 0;
+};
+#pragma pack(pop)
+
+static_assert(sizeof(PackedTerrainVertex) == 20, "PackedTerrainVertex must match the 20-byte input layout in lib/terrainVertex.hlsl");
+
+/// Nearest quantized direction of a normal
+TerrainVertexFace GetTerrainVertexFace(const Vec3& normal);
+Vec3              GetTerrainVertexFaceNormal(TerrainVertexFace face);
+
+/// Pack one vertex. Returns false when it cannot be represented losslessly enough (position outside the
+/// 2048 block range, UV too far outside its midTexCoord tile, non power of two tiles); the mesher then keeps
+/// the full TerrainVertex for that mesh.
+bool PackTerrainVertex(const TerrainVertexAttributes& vertex, const TerrainAtlasGrid& grid, PackedTerrainVertex& outPacked);
+
+/// CPU reference of DecodeTerrainVertex() in lib/terrainVertex.hlsl
+TerrainVertexAttributes UnpackTerrainVertex(const PackedTerrainVertex& packed, const TerrainAtlasGrid& grid);
@@ -20,6 +20,8 @@
 #include "Engine/Voxel/World/TerrainVertexLayout.hpp"
 #include "Engine/Voxel/World/World.hpp"
 #include "Game/GameCommon.hpp"
+#include "Game/Framework/RenderGraph/SceneRenderGraph.hpp"
+#include "Game/Framework/RenderPass/RenderPassTimers.hpp"
 #include "Game/Framework/RenderPass/WorldRenderingPhase.hpp"
 #include "Game/Gameplay/Game.hpp"
 
@@ -56,18 +58,23 @@ void TerrainRenderPass::Execute()
         return;
     }
 
-    BeginPass();
+    TimedBeginPass();
 
     enigma::voxel::ChunkBatchViewContext viewContext;
     viewContext.world  = world;
     viewContext.camera = g_theGame ? g_theGame->GetChunkBatchCullingCamera() : nullptr;
 
-    const enigma::voxel::ChunkBatchCollection collection = enigma::voxel::ChunkBatchCollector::Collect(
-        viewContext,
-        enigma::voxel::ChunkBatchLayer::Opaque);
-    world->MutableChunkBatchStats().batchedDraws += enigma::voxel::ChunkBatchRenderer::Submit(collection);
+    enigma::voxel::ChunkBatchCollection collection;
+    {
+        ScopedRenderPassTimer collectTimer(RenderPassTimerPhase::Collect);
+        collection = enigma::voxel::ChunkBatchCollector::Collect(viewContext, enigma::voxel::ChunkBatchLayer::Opaque);
+    }
+    {
+        ScopedRenderPassTimer submitTimer(RenderPassTimerPhase::Submit);
+        world->MutableChunkBatchStats().batchedDraws += enigma::voxel::ChunkBatchRenderer::Submit(collection);
+    }
 
-    EndPass();
+    TimedEndPass();
 }
 
 void TerrainRenderPass::BeginPass()
@@ -121,3 +128,14 @@ void TerrainRenderPass::OnShaderBundleUnloaded()
 {
     m_shaderProgram = nullptr;
 }
+
+void TerrainRenderPass::DeclareResources(RenderGraph& graph) const
+{
+    int pass = graph.AddPass("terrain");
+    graph.WriteMask(pass, RenderGraphResourceType::ColorTex, 0x7u); // colortex0-2, matches UseProgram in BeginPass
+    graph.Write(pass, {RenderGraphResourceType::DepthTex, 0});
+    if (m_shaderProgram)
+    {
+        SceneRenderGraph::DeclareProgramReads(graph, pass, *m_shaderProgram);
+    }
+}
@@ -17,6 +17,7 @@ public:
     TerrainRenderPass();
     ~TerrainRenderPass() override;
     void Execute() override;
+    void DeclareResources(RenderGraph& graph) const override;
 
 protected:
     void BeginPass() override;
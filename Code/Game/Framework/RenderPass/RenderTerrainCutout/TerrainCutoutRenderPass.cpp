@@ -36,6 +36,8 @@
 #include "Engine/Voxel/World/TerrainVertexLayout.hpp"
 #include "Engine/Voxel/World/World.hpp"
 #include "Game/GameCommon.hpp"
+#include "Game/Framework/RenderGraph/SceneRenderGraph.hpp"
+#include "Game/Framework/RenderPass/RenderPassTimers.hpp"
 #include "Game/Framework/RenderPass/WorldRenderingPhase.hpp"
 #include "Game/Gameplay/Game.hpp"
 
@@ -77,18 +79,23 @@ void TerrainCutoutRenderPass::Execute()
         return;
     }
 
-    BeginPass();
+    TimedBeginPass();
 
     enigma::voxel::ChunkBatchViewContext viewContext;
     viewContext.world  = world;
     viewContext.camera = g_theGame ? g_theGame->GetChunkBatchCullingCamera() : nullptr;
 
-    const enigma::voxel::ChunkBatchCollection       collection = enigma::voxel::ChunkBatchCollector::Collect(
-        viewContext,
-        enigma::voxel::ChunkBatchLayer::Cutout);
-    world->MutableChunkBatchStats().batchedDraws += enigma::voxel::ChunkBatchRenderer::Submit(collection);
+    enigma::voxel::ChunkBatchCollection collection;
+    {
+        ScopedRenderPassTimer collectTimer(RenderPassTimerPhase::Collect);
+        collection = enigma::voxel::ChunkBatchCollector::Collect(viewContext, enigma::voxel::ChunkBatchLayer::Cutout);
+    }
+    {
+        ScopedRenderPassTimer submitTimer(RenderPassTimerPhase::Submit);
+        world->MutableChunkBatchStats().batchedDraws += enigma::voxel::ChunkBatchRenderer::Submit(collection);
+    }
 
-    EndPass();
+    TimedEndPass();
 }
 
 void TerrainCutoutRenderPass::OnShaderBundleLoaded(enigma::graphic::ShaderBundle* newBundle)
@@ -151,3 +158,16 @@ void TerrainCutoutRenderPass::EndPass()
     g_theRendererSubsystem->GetRenderTargetProvider(RenderTargetType::DepthTex)->Copy(0, 1);
     LogDebug(LogRenderer, "TerrainCutoutRenderPass: Depth copied depthtex0 -> depthtex1 (noTranslucents)");
 }
+
+void TerrainCutoutRenderPass::DeclareResources(RenderGraph& graph) const
+{
+    // depthtex1 receives the Copy(0, 1) pre-translucent depth snapshot at the end of this pass
+    int pass = graph.AddPass("terrain_cutout");
+    graph.WriteMask(pass, RenderGraphResourceType::ColorTex, 0x7u);
+    graph.Write(pass, {RenderGraphResourceType::DepthTex, 0});
+    graph.Write(pass, {RenderGraphResourceType::DepthTex, 1});
+    if (m_shaderProgram)
+    {
+        SceneRenderGraph::DeclareProgramReads(graph, pass, *m_shaderProgram);
+    }
+}
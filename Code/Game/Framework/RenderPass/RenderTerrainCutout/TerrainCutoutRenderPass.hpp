@@ -30,6 +30,7 @@ public:
     TerrainCutoutRenderPass();
     ~TerrainCutoutRenderPass() override;
     void Execute() override;
+    void DeclareResources(RenderGraph& graph) const override;
 
 protected:
     void OnShaderBundleLoaded(enigma::graphic::ShaderBundle* newBundle) override;
@@ -20,6 +20,7 @@
 #include "Engine/Graphic/Bundle/ShaderBundle.hpp"
 #include "Engine/Graphic/Bundle/Integration/ShaderBundleSubsystem.hpp"
 #include "Game/GameCommon.hpp"
+#include "Game/Framework/RenderGraph/SceneRenderGraph.hpp"
 #include "Game/Gameplay/Game.hpp"
 #include "Engine/Graphic/Core/DX12/D3D12RenderSystem.hpp"
 #include "Engine/Graphic/Integration/RendererSubsystem.hpp"
@@ -35,6 +36,7 @@
 #include "Engine/Voxel/Chunk/ChunkBatchRenderer.hpp"
 #include "Engine/Voxel/World/TerrainVertexLayout.hpp"
 #include "Engine/Voxel/World/World.hpp"
+#include "Game/Framework/RenderPass/RenderPassTimers.hpp"
 #include "Game/Framework/RenderPass/WorldRenderingPhase.hpp"
 
 using namespace enigma::graphic;
@@ -73,18 +75,23 @@ void TerrainTranslucentRenderPass::Execute()
         return;
     }
 
-    BeginPass();
+    TimedBeginPass();
 
     enigma::voxel::ChunkBatchViewContext viewContext;
     viewContext.world  = world;
     viewContext.camera = g_theGame ? g_theGame->GetChunkBatchCullingCamera() : nullptr;
 
-    const enigma::voxel::ChunkBatchCollection       collection = enigma::voxel::ChunkBatchCollector::Collect(
-        viewContext,
-        enigma::voxel::ChunkBatchLayer::Translucent);
-    world->MutableChunkBatchStats().batchedDraws += enigma::voxel::ChunkBatchRenderer::Submit(collection);
+    enigma::voxel::ChunkBatchCollection collection;
+    {
+        ScopedRenderPassTimer collectTimer(RenderPassTimerPhase::Collect);
+        collection = enigma::voxel::ChunkBatchCollector::Collect(viewContext, enigma::voxel::ChunkBatchLayer::Translucent);
+    }
+    {
+        ScopedRenderPassTimer submitTimer(RenderPassTimerPhase::Submit);
+        world->MutableChunkBatchStats().batchedDraws += enigma::voxel::ChunkBatchRenderer::Submit(collection);
+    }
 
-    EndPass();
+    TimedEndPass();
 }
 
 void TerrainTranslucentRenderPass::OnShaderBundleLoaded(enigma::graphic::ShaderBundle* newBundle)
@@ -210,3 +217,14 @@ void TerrainTranslucentRenderPass::RestoreRenderState()
     g_theRendererSubsystem->SetDepthConfig(m_savedDepthConfig);
     g_theRendererSubsystem->SetBlendConfig(m_savedBlendConfig);
 }
+
+void TerrainTranslucentRenderPass::DeclareResources(RenderGraph& graph) const
+{
+    int pass = graph.AddPass("water");
+    graph.Write(pass, {RenderGraphResourceType::DepthTex, 0});
+    if (m_waterShader)
+    {
+        SceneRenderGraph::DeclareColorWrites(graph, pass, m_waterShader->GetDirectives().GetDrawBuffers());
+        SceneRenderGraph::DeclareProgramReads(graph, pass, *m_waterShader);
+    }
+}
@@ -4,6 +4,7 @@
 #include "Engine/Graphic/Bundle/ShaderBundle.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Graphic/Integration/RendererSubsystem.hpp"
+#include "Game/Framework/RenderPass/RenderPassTimers.hpp"
 
 // ----------------------------------------------------------------------------
 SceneRenderPass::SceneRenderPass()
@@ -29,6 +30,20 @@ void SceneRenderPass::EndPass()
     EndPassScope();
 }
 
+// ----------------------------------------------------------------------------
+void SceneRenderPass::TimedBeginPass()
+{
+    ScopedRenderPassTimer timer(RenderPassTimerPhase::BeginPass);
+    BeginPass();
+}
+
+// ----------------------------------------------------------------------------
+void SceneRenderPass::TimedEndPass()
+{
+    ScopedRenderPassTimer timer(RenderPassTimerPhase::EndPass);
+    EndPass();
+}
+
 // ----------------------------------------------------------------------------
 void SceneRenderPass::SubscribeToShaderBundleEvents()
 {
@@ -59,6 +74,12 @@ void SceneRenderPass::UnsubscribeFromShaderBundleEvents()
     }
 }
 
+// ----------------------------------------------------------------------------
+void SceneRenderPass::DeclareResources(RenderGraph& /*graph*/) const
+{
+    // Default: no declaration. SceneRenderGraph inserts an empty placeholder pass.
+}
+
 // ----------------------------------------------------------------------------
 void SceneRenderPass::OnShaderBundleLoaded(enigma::graphic::ShaderBundle* /*newBundle*/)
 {
@@ -12,6 +12,8 @@ namespace enigma::graphic
     class ShaderProgram;
 }
 
+class RenderGraph;
+
 class SceneRenderPass
 {
 public:
@@ -21,10 +23,19 @@ public:
     virtual void Execute() = 0;
     static bool ShouldSuppressWorldRenderingForReload();
 
+    // Frame graph declaration: add exactly one pass and the colortex/depthtex/shadowtex
+    // targets it reads and writes. Passes that do not override appear as "undeclared".
+    virtual void DeclareResources(RenderGraph& graph) const;
+
 protected:
     virtual void BeginPass();
     virtual void EndPass();
 
+    // Execute() entry points: call the virtual BeginPass/EndPass inside a CPU timer
+    // attributed to the pass SceneRenderGraph is currently running.
+    void TimedBeginPass();
+    void TimedEndPass();
+
     // Scope helpers let subclasses reuse the default pass boundary hookup
     // and opt into explicit subpass transitions inside Execute().
     void BeginPassScope(const char* debugName = nullptr);
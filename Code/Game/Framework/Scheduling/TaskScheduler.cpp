@@ -0,0 +1,566 @@
+/**
+ * @file TaskScheduler.cpp
+ * @brief Work-stealing worker pool with per-type priority classes and soft reservations
+ * @date 2026-10-16
+ */
+
+#include "TaskScheduler.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/Yaml.hpp"
+
+using namespace enigma::core;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr size_t      TYPE_COUNT              = static_cast<size_t>(TaskType::Count);
+    constexpr int         MAX_WORKERS             = 16;
+    constexpr size_t      WAIT_SAMPLE_WINDOW      = 128;
+    constexpr float       RUN_TIME_SMOOTHING      = 0.1f;
+    constexpr const char* DEFAULT_SCHEDULE_OUTPUT = ".enigma/cache/schedule.yml";
+    constexpr const char* TYPE_SETTING_KEYS[]     = {"fileIO", "generic", "background"};
+
+    struct QueuedTask
+    {
+        TaskScheduler::TaskFn fn;
+        TaskType              type;
+        Clock::time_point     enqueued;
+    };
+
+    struct Worker
+    {
+        std::mutex                                     mutex;
+        std::array<std::deque<QueuedTask>, TYPE_COUNT> queues;
+        std::thread                                    thread;
+        int                                            reservedType = -1; // Soft reservation, -1 = none
+    };
+
+    struct TypeState
+    {
+        TaskPriority          priority        = TaskPriority::Normal;
+        uint32_t              reservedWorkers = 0;
+        std::atomic<uint32_t> queued{0};
+        std::atomic<uint32_t> executing{0};
+        std::atomic<uint64_t> submitted{0};
+        std::atomic<uint64_t> completed{0};
+        std::atomic<uint64_t> stolen{0};
+
+        std::mutex                            latencyMutex;
+        std::array<float, WAIT_SAMPLE_WINDOW> waitSamples     = {};
+        size_t                                waitSampleCount = 0;
+        size_t                                waitSampleNext  = 0;
+        float                                 avgRunMs        = 0.0f;
+    };
+
+    std::vector<std::unique_ptr<Worker>> s_workers;
+    std::array<TypeState, TYPE_COUNT>    s_types;
+    std::array<TaskType, TYPE_COUNT>     s_priorityOrder = {TaskType::FileIO, TaskType::Generic, TaskType::Background};
+    std::mutex                           s_sleepMutex;
+    std::condition_variable              s_wake;
+    std::atomic<uint64_t>                s_pending{0}; // Queued tasks not yet taken by a worker
+    std::atomic<uint32_t>                s_nextWorker{0};
+    std::atomic<bool>                    s_running{false};
+    bool                                 s_shutdown    = false;
+    thread_local int                     t_workerIndex = -1;
+
+    // Thread budget plan, written by SizeEngineSchedule() before the engine and the workers start
+    uint32_t                    s_threadBudget   = 0;
+    int                         s_plannedWorkers = 0; // 0 = Startup() resolves it on its own
+    std::vector<EnginePoolSize> s_enginePools;
+
+    TypeState& GetTypeState(TaskType type)
+    {
+        return s_types[static_cast<size_t>(type)];
+    }
+
+    uint32_t GetHardwareThreads()
+    {
+        const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+        return hardwareThreads > 0 ? hardwareThreads : 8u;
+    }
+
+    /// scheduler.threadBudget; 0 = the engine pools keep their schedule.yml sizes next to the game pool
+    uint32_t GetConfiguredThreadBudget(const YamlConfiguration& config)
+    {
+        return static_cast<uint32_t>(std::max(config.GetInt("scheduler.threadBudget", 0), 0));
+    }
+
+    /// scheduler.workers, or a quarter of the configured budget (of the hardware threads without one) when it is 0
+    int ResolveWorkerCount(const YamlConfiguration& config)
+    {
+        int workerCount = config.GetInt("scheduler.workers", 0);
+        if (workerCount <= 0)
+        {
+            const uint32_t threadBudget = GetConfiguredThreadBudget(config);
+            workerCount                 = static_cast<int>(std::max((threadBudget > 0 ? threadBudget : GetHardwareThreads()) / 4, 1u));
+        }
+        return std::clamp(workerCount, 1, MAX_WORKERS);
+    }
+
+    std::string TrimLine(const std::string& text)
+    {
+        const size_t first = text.find_first_not_of(" \t\r-");
+        if (first == std::string::npos)
+            return {};
+        const size_t last = text.find_last_not_of(" \t\r");
+        return text.substr(first, last - first + 1);
+    }
+
+    /// Value of "key: value" on a schedule.yml line, comments and quotes stripped; empty when the key differs
+    std::string GetScheduleValue(const std::string& line, const char* key)
+    {
+        const std::string content = TrimLine(line.substr(0, line.find('#')));
+        const std::string prefix  = std::string(key) + ":";
+        if (content.compare(0, prefix.size(), prefix) != 0)
+            return {};
+        std::string value = TrimLine(content.substr(prefix.size()));
+        value.erase(std::remove(value.begin(), value.end(), '"'), value.end());
+        return value;
+    }
+
+    uint32_t SumThreads(const std::vector<EnginePoolSize>& pools, uint32_t EnginePoolSize::*field)
+    {
+        return std::accumulate(pools.begin(), pools.end(), 0u, [field](uint32_t sum, const EnginePoolSize& pool)
+        {
+            return sum + pool.*field;
+        });
+    }
+
+    /// Proportional share of engineBudget per pool (largest remainder), at least one thread each; pools that already fit are kept
+    void FitEnginePools(std::vector<EnginePoolSize>& pools, uint32_t engineBudget)
+    {
+        const uint32_t configured = SumThreads(pools, &EnginePoolSize::configuredThreads);
+        if (configured <= engineBudget)
+        {
+            for (EnginePoolSize& pool : pools)
+                pool.threads = pool.configuredThreads;
+            return;
+        }
+
+        const auto getShare = [configured, engineBudget](const EnginePoolSize& pool)
+        {
+            return static_cast<double>(pool.configuredThreads) * engineBudget / configured;
+        };
+        for (EnginePoolSize& pool : pools)
+            pool.threads = std::max(static_cast<uint32_t>(getShare(pool)), 1u);
+
+        // Hand out what rounding down left over, or take back what the one-thread floor overshot
+        uint32_t total = SumThreads(pools, &EnginePoolSize::threads);
+        while (total < engineBudget)
+        {
+            auto neediest = std::max_element(pools.begin(), pools.end(), [&getShare](const EnginePoolSize& a, const EnginePoolSize& b)
+            {
+                return getShare(a) - a.threads < getShare(b) - b.threads;
+            });
+            ++neediest->threads;
+            ++total;
+        }
+        while (total > engineBudget)
+        {
+            auto largest = std::max_element(pools.begin(), pools.end(), [](const EnginePoolSize& a, const EnginePoolSize& b)
+            {
+                return a.threads < b.threads;
+            });
+            if (largest->threads <= 1)
+                break;
+            --largest->threads;
+            --total;
+        }
+    }
+
+    bool ParsePriority(const std::string& name, TaskPriority& outPriority)
+    {
+        for (TaskPriority priority : {TaskPriority::Critical, TaskPriority::High, TaskPriority::Normal, TaskPriority::Background})
+        {
+            if (name == TaskScheduler::GetPriorityName(priority))
+            {
+                outPriority = priority;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void RunTask(QueuedTask& task, bool stolen)
+    {
+        TypeState&              state = GetTypeState(task.type);
+        const Clock::time_point start = Clock::now();
+        state.queued.fetch_sub(1, std::memory_order_relaxed);
+        state.executing.fetch_add(1, std::memory_order_relaxed);
+
+        task.fn();
+
+        const float waitMs = std::chrono::duration<float, std::milli>(start - task.enqueued).count();
+        const float runMs  = std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+        state.executing.fetch_sub(1, std::memory_order_relaxed);
+        state.completed.fetch_add(1, std::memory_order_relaxed);
+        if (stolen)
+            state.stolen.fetch_add(1, std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(state.latencyMutex);
+        state.waitSamples[state.waitSampleNext] = waitMs;
+        state.waitSampleNext                    = (state.waitSampleNext + 1) % WAIT_SAMPLE_WINDOW;
+        state.waitSampleCount                   = std::min(state.waitSampleCount + 1, WAIT_SAMPLE_WINDOW);
+        state.avgRunMs += (runMs - state.avgRunMs) * RUN_TIME_SMOOTHING;
+    }
+
+    /// Own deque from the back, then steal from the front of the others; reserved type first, then by priority
+    bool TryTakeTask(int workerIndex, QueuedTask& outTask, bool& outStolen)
+    {
+        const int workerCount = static_cast<int>(s_workers.size());
+        const int reserved    = s_workers[workerIndex]->reservedType;
+
+        std::array<TaskType, TYPE_COUNT + 1> order;
+        size_t                               orderCount = 0;
+        if (reserved >= 0)
+            order[orderCount++] = static_cast<TaskType>(reserved);
+        for (TaskType type : s_priorityOrder)
+            order[orderCount++] = type;
+
+        for (size_t i = 0; i < orderCount; ++i)
+        {
+            const size_t typeIndex = static_cast<size_t>(order[i]);
+            {
+                Worker&                     self = *s_workers[workerIndex];
+                std::lock_guard<std::mutex> lock(self.mutex);
+                if (!self.queues[typeIndex].empty())
+                {
+                    outTask = std::move(self.queues[typeIndex].back());
+                    self.queues[typeIndex].pop_back();
+                    outStolen = false;
+                    return true;
+                }
+            }
+            for (int offset = 1; offset < workerCount; ++offset)
+            {
+                Worker&                     victim = *s_workers[(workerIndex + offset) % workerCount];
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if (!victim.queues[typeIndex].empty())
+                {
+                    outTask = std::move(victim.queues[typeIndex].front());
+                    victim.queues[typeIndex].pop_front();
+                    outStolen = true;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void WorkerMain(int workerIndex)
+    {
+        t_workerIndex = workerIndex;
+        while (true)
+        {
+            QueuedTask task;
+            bool       stolen = false;
+            if (TryTakeTask(workerIndex, task, stolen))
+            {
+                s_pending.fetch_sub(1, std::memory_order_acq_rel);
+                RunTask(task, stolen);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(s_sleepMutex);
+            s_wake.wait(lock, []() { return s_shutdown || s_pending.load(std::memory_order_acquire) > 0; });
+            if (s_shutdown && s_pending.load(std::memory_order_acquire) == 0)
+                return;
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string TaskScheduler::SizeEngineSchedule(const YamlConfiguration& config, const std::string& schedulePath)
+{
+    const uint32_t configuredBudget = GetConfiguredThreadBudget(config);
+    s_threadBudget                  = configuredBudget > 0 ? configuredBudget : GetHardwareThreads(); // Until the engine pools are known
+    s_plannedWorkers                = ResolveWorkerCount(config);
+    s_enginePools.clear();
+
+    // [STEP 1] Collect the "- type:" / "threads:" pairs of every pool
+    std::vector<std::string> lines;
+    {
+        std::ifstream input(schedulePath);
+        if (!input)
+        {
+            DebuggerPrintf("[TaskScheduler] Cannot read %s, engine pools keep their defaults\n", schedulePath.c_str());
+            return schedulePath;
+        }
+        for (std::string line; std::getline(input, line);)
+            lines.push_back(line);
+    }
+    std::vector<size_t> threadLines;
+    for (size_t i = 0; i < lines.size(); ++i)
+    {
+        const std::string type = GetScheduleValue(lines[i], "type");
+        if (!type.empty())
+        {
+            s_enginePools.push_back({type, 0, 0});
+            threadLines.push_back(SIZE_MAX);
+            continue;
+        }
+        const std::string threads = GetScheduleValue(lines[i], "threads");
+        if (!threads.empty() && !s_enginePools.empty() && threadLines.back() == SIZE_MAX)
+        {
+            s_enginePools.back().configuredThreads = static_cast<uint32_t>(std::max(std::atoi(threads.c_str()), 1));
+            threadLines.back()                     = i;
+        }
+    }
+    for (size_t i = s_enginePools.size(); i-- > 0;)
+    {
+        if (threadLines[i] == SIZE_MAX)
+        {
+            s_enginePools.erase(s_enginePools.begin() + static_cast<std::ptrdiff_t>(i));
+            threadLines.erase(threadLines.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+    }
+    if (s_enginePools.empty())
+        return schedulePath;
+
+    // [STEP 2] The game pool is reserved first, the engine pools share what is left. Without an explicit
+    // budget that is exactly their schedule.yml total, so none of them shrinks.
+    if (configuredBudget == 0)
+        s_threadBudget = SumThreads(s_enginePools, &EnginePoolSize::configuredThreads) + static_cast<uint32_t>(s_plannedWorkers);
+    const uint32_t engineBudget = std::max(s_threadBudget - std::min(static_cast<uint32_t>(s_plannedWorkers), s_threadBudget), static_cast<uint32_t>(s_enginePools.size()));
+    FitEnginePools(s_enginePools, engineBudget);
+
+    // [STEP 3] Same file with only the thread counts replaced, so descriptions and comments survive
+    for (size_t i = 0; i < s_enginePools.size(); ++i)
+    {
+        std::string& line   = lines[threadLines[i]];
+        const size_t indent = line.find_first_not_of(" \t");
+        line                = line.substr(0, indent) + "threads: " + std::to_string(s_enginePools[i].threads);
+    }
+
+    const std::filesystem::path outputPath = config.GetString("scheduler.engineScheduleOutput", DEFAULT_SCHEDULE_OUTPUT);
+    std::error_code             error;
+    if (outputPath.has_parent_path())
+        std::filesystem::create_directories(outputPath.parent_path(), error);
+    std::ofstream output(outputPath, std::ios::trunc);
+    if (!output)
+    {
+        DebuggerPrintf("[TaskScheduler] Cannot write %s, engine pools keep their schedule.yml sizes\n", outputPath.string().c_str());
+        for (EnginePoolSize& pool : s_enginePools)
+            pool.threads = pool.configuredThreads;
+        return schedulePath;
+    }
+    output << "# Generated from " << schedulePath << " by TaskScheduler::SizeEngineSchedule(); edit that file instead\n";
+    output << "# Thread budget " << s_threadBudget << ": " << s_plannedWorkers << " game workers, " << GetEngineThreadCount() << " engine threads\n";
+    for (const std::string& line : lines)
+        output << line << '\n';
+    DebuggerPrintf("[TaskScheduler] Thread budget %u: %u engine threads (schedule.yml asks for %u), %d game workers\n",
+                   s_threadBudget, GetEngineThreadCount(),
+                   SumThreads(s_enginePools, &EnginePoolSize::configuredThreads),
+                   s_plannedWorkers);
+    return outputPath.string();
+}
+
+// ------------------------------------------------------------------------------------------------
+void TaskScheduler::Startup(const YamlConfiguration& config)
+{
+    if (s_running)
+        return;
+
+    std::array<TaskPriority, TYPE_COUNT> priorities = {TaskPriority::High, TaskPriority::Normal, TaskPriority::Background};
+    std::array<int, TYPE_COUNT>          reserved   = {0, 0, 0};
+    for (size_t i = 0; i < TYPE_COUNT; ++i)
+    {
+        const std::string prefix       = std::string("scheduler.") + TYPE_SETTING_KEYS[i];
+        const std::string priorityName = config.GetString(prefix + ".priority", GetPriorityName(priorities[i]));
+        if (!ParsePriority(priorityName, priorities[i]))
+            DebuggerPrintf("[TaskScheduler] Unknown priority '%s' for %s\n", priorityName.c_str(), prefix.c_str());
+        reserved[i] = std::max(config.GetInt(prefix + ".reserved", reserved[i]), 0);
+    }
+
+    // Same size SizeEngineSchedule() reserved next to the engine pools
+    if (s_threadBudget == 0)
+    {
+        const uint32_t configuredBudget = GetConfiguredThreadBudget(config);
+        s_threadBudget                  = configuredBudget > 0 ? configuredBudget : GetHardwareThreads();
+    }
+    const int workerCount = s_plannedWorkers > 0 ? s_plannedWorkers : ResolveWorkerCount(config);
+
+    for (size_t i = 0; i < TYPE_COUNT; ++i)
+    {
+        s_types[i].priority        = priorities[i];
+        s_types[i].reservedWorkers = static_cast<uint32_t>(reserved[i]);
+    }
+    std::stable_sort(s_priorityOrder.begin(), s_priorityOrder.end(), [](TaskType a, TaskType b)
+    {
+        return GetTypeState(a).priority < GetTypeState(b).priority;
+    });
+
+    // Hand out reservations in priority order; reservations beyond the pool size are dropped
+    s_workers.clear();
+    for (int i = 0; i < workerCount; ++i)
+        s_workers.push_back(std::make_unique<Worker>());
+    int nextReserved = 0;
+    for (TaskType type : s_priorityOrder)
+    {
+        for (uint32_t r = 0; r < GetTypeState(type).reservedWorkers && nextReserved < workerCount - 1; ++r)
+            s_workers[nextReserved++]->reservedType = static_cast<int>(type);
+    }
+
+    s_shutdown = false;
+    s_running  = true;
+    for (int i = 0; i < workerCount; ++i)
+        s_workers[i]->thread = std::thread(&WorkerMain, i);
+    DebuggerPrintf("[TaskScheduler] Started %d workers\n", workerCount);
+}
+
+// ------------------------------------------------------------------------------------------------
+void TaskScheduler::Shutdown()
+{
+    // Submit() checks s_running and enqueues under s_sleepMutex, so once this flips no submitter can reach
+    // s_workers anymore: later tasks (including ones submitted by the draining workers) run inline
+    {
+        std::lock_guard<std::mutex> lock(s_sleepMutex);
+        if (!s_running)
+            return;
+        s_running  = false;
+        s_shutdown = true;
+    }
+    s_wake.notify_all();
+    for (const std::unique_ptr<Worker>& worker : s_workers)
+    {
+        if (worker->thread.joinable())
+            worker->thread.join();
+    }
+    s_workers.clear();
+}
+
+// ------------------------------------------------------------------------------------------------
+void TaskScheduler::Submit(TaskType type, TaskFn task)
+{
+    TypeState& state = GetTypeState(type);
+    state.submitted.fetch_add(1, std::memory_order_relaxed);
+    state.queued.fetch_add(1, std::memory_order_relaxed);
+
+    QueuedTask queuedTask{std::move(task), type, Clock::now()};
+    {
+        // Held across the enqueue so Shutdown() cannot stop the workers between the check and the push
+        std::unique_lock<std::mutex> sleepLock(s_sleepMutex);
+        if (s_running)
+        {
+            const size_t workerIndex = t_workerIndex >= 0 ? static_cast<size_t>(t_workerIndex) : s_nextWorker.fetch_add(1, std::memory_order_relaxed) % s_workers.size();
+            {
+                Worker&                     worker = *s_workers[workerIndex];
+                std::lock_guard<std::mutex> lock(worker.mutex);
+                worker.queues[static_cast<size_t>(type)].push_back(std::move(queuedTask));
+            }
+            s_pending.fetch_add(1, std::memory_order_acq_rel);
+            sleepLock.unlock();
+            s_wake.notify_one();
+            return;
+        }
+    }
+    RunTask(queuedTask, false);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool TaskScheduler::IsRunning()
+{
+    return s_running;
+}
+
+// ------------------------------------------------------------------------------------------------
+uint32_t TaskScheduler::GetWorkerCount()
+{
+    return s_running ? static_cast<uint32_t>(s_workers.size()) : 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+uint32_t TaskScheduler::GetThreadBudget()
+{
+    return s_threadBudget;
+}
+
+// ------------------------------------------------------------------------------------------------
+uint32_t TaskScheduler::GetEngineThreadCount()
+{
+    return SumThreads(s_enginePools, &EnginePoolSize::threads);
+}
+
+// ------------------------------------------------------------------------------------------------
+const std::vector<EnginePoolSize>& TaskScheduler::GetEnginePools()
+{
+    return s_enginePools;
+}
+
+// ------------------------------------------------------------------------------------------------
+TaskTypeStats TaskScheduler::GetStats(TaskType type)
+{
+    TypeState&    state = GetTypeState(type);
+    TaskTypeStats stats;
+    stats.priority        = state.priority;
+    stats.reservedWorkers = state.reservedWorkers;
+    stats.queued          = state.queued.load(std::memory_order_relaxed);
+    stats.executing       = state.executing.load(std::memory_order_relaxed);
+    stats.submitted       = state.submitted.load(std::memory_order_relaxed);
+    stats.completed       = state.completed.load(std::memory_order_relaxed);
+    stats.stolen          = state.stolen.load(std::memory_order_relaxed);
+
+    std::array<float, WAIT_SAMPLE_WINDOW> samples;
+    size_t                                sampleCount;
+    {
+        std::lock_guard<std::mutex> lock(state.latencyMutex);
+        samples        = state.waitSamples;
+        sampleCount    = state.waitSampleCount;
+        stats.avgRunMs = state.avgRunMs;
+    }
+    if (sampleCount > 0)
+    {
+        float sum = 0.0f;
+        for (size_t i = 0; i < sampleCount; ++i)
+            sum += samples[i];
+        stats.avgWaitMs = sum / static_cast<float>(sampleCount);
+
+        const size_t p95Index = (sampleCount - 1) * 95 / 100;
+        std::nth_element(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(p95Index), samples.begin() + static_cast<std::ptrdiff_t>(sampleCount));
+        stats.p95WaitMs = samples[p95Index];
+    }
+    return stats;
+}
+
+// ------------------------------------------------------------------------------------------------
+const char* TaskScheduler::GetTypeName(TaskType type)
+{
+    switch (type)
+    {
+    case TaskType::FileIO: return "FileIO";
+    case TaskType::Generic: return "Generic";
+    case TaskType::Background: return "Background";
+    default: return "Unknown";
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+const char* TaskScheduler::GetPriorityName(TaskPriority priority)
+{
+    switch (priority)
+    {
+    case TaskPriority::Critical: return "critical";
+    case TaskPriority::High: return "high";
+    case TaskPriority::Normal: return "normal";
+    case TaskPriority::Background: return "background";
+    default: return "unknown";
+    }
+}
@@ -0,0 +1,109 @@
+/**
+ * @file TaskScheduler.hpp
+ * @brief Shared work-stealing worker pool for game-side tasks, with priority classes per task type
+ * @date 2026-10-16
+ *
+ * One pool serves every game-side task type instead of a dedicated pool per type, so a type with a
+ * backlog can use workers another type leaves idle.
+ *
+ * Thread budget: the engine's schedule.yml pools (Generic, FileIO, ChunkGen, ...) and this pool share
+ * scheduler.threadBudget worker threads. By default (0) the budget is the schedule.yml total plus the
+ * game pool, so the engine pools keep their configured sizes. With an explicit budget,
+ * SizeEngineSchedule() reserves the game pool first, scales the engine pools down proportionally (at
+ * least one thread each) until they fit the rest, and writes the resized schedule that App hands to
+ * ScheduleConfig. The engine pools themselves stay engine-owned; only their sizes come from here. In
+ * particular ChunkGen and MeshBuilding remain separate engine pools with no stealing between them: the
+ * engine exposes no hook to queue chunk work elsewhere, so the shared pool below only covers the
+ * game-side task types.
+ *
+ * - Every worker owns one deque per task type. Tasks submitted from a worker go to its own deque
+ *   (popped LIFO, cache-warm); tasks from other threads are spread round-robin.
+ * - Idle workers steal from the front of other workers' deques.
+ * - Types are served in priority class order (Critical first). A worker with a soft reservation
+ *   looks at its reserved type before the priority order, but runs other work when that type is
+ *   empty, so reserved capacity is never left idle.
+ *
+ * Per-type queue depth, executing count, steals and wait/run latency are exposed for the diagnostics
+ * panel. When the scheduler is not running (tools, early startup) tasks run inline on the caller.
+ *
+ * Configuration Path: Run/.enigma/settings.yml -> scheduler
+ */
+
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Engine/Core/Yaml.hpp"
+
+enum class TaskType : uint8_t
+{
+    FileIO = 0,        // Region file appends and other disk work
+    Generic,
+    Background,        // Benchmarks and other work nobody waits for
+    Count
+};
+
+enum class TaskPriority : uint8_t
+{
+    Critical = 0,
+    High,
+    Normal,
+    Background,
+};
+
+struct TaskTypeStats
+{
+    TaskPriority priority        = TaskPriority::Normal;
+    uint32_t     reservedWorkers = 0;
+    uint32_t     queued          = 0;
+    uint32_t     executing       = 0;
+    uint64_t     submitted       = 0;
+    uint64_t     completed       = 0;
+    uint64_t     stolen          = 0; // Completed tasks that ran on a worker other than the one they were queued on
+    float        avgWaitMs       = 0.0f; // Queue latency over the recent sample window
+    float        p95WaitMs       = 0.0f;
+    float        avgRunMs        = 0.0f;
+};
+
+/// One engine schedule.yml pool after SizeEngineSchedule()
+struct EnginePoolSize
+{
+    std::string type;
+    uint32_t    configuredThreads = 0; // As written in schedule.yml
+    uint32_t    threads           = 0; // Handed to the engine
+};
+
+class TaskScheduler
+{
+public:
+    TaskScheduler()                                = delete; // Prevent instantiation
+    TaskScheduler(const TaskScheduler&)            = delete; // Prevent copy
+    TaskScheduler& operator=(const TaskScheduler&) = delete; // Prevent assignment
+
+    using TaskFn = std::function<void()>;
+
+    /// Fits the engine pools of schedulePath and the game pool into the thread budget and returns the
+    /// schedule file the engine should load: the resized copy, or schedulePath when it cannot be read or
+    /// the copy cannot be written. Call before the ScheduleSubsystem is created and before Startup().
+    static std::string SizeEngineSchedule(const enigma::core::YamlConfiguration& config, const std::string& schedulePath);
+
+    /// Reads the scheduler section for the worker count and per-type priorities, then starts the workers
+    static void Startup(const enigma::core::YamlConfiguration& config);
+    /// Runs the tasks still queued, then joins the workers; tasks submitted from then on run inline
+    static void Shutdown();
+
+    static void Submit(TaskType type, TaskFn task);
+
+    static bool          IsRunning();
+    static uint32_t      GetWorkerCount();
+    static uint32_t      GetThreadBudget();
+    static uint32_t      GetEngineThreadCount();
+
+    static const std::vector<EnginePoolSize>& GetEnginePools();
+    static TaskTypeStats GetStats(TaskType type);
+
+    static const char* GetTypeName(TaskType type);
+    static const char* GetPriorityName(TaskPriority priority);
+};
@@ -0,0 +1,344 @@
+/**
+ * @file GreedyTerrainMesher.cpp
+ * @brief Greedy full-block face merging implementation
+ * @date 2026-10-16
+ */
+
+#include "GreedyTerrainMesher.hpp"
+
+#include <algorithm>
+#include <fstream>
+
+#include "Engine/Core/Json.hpp"
+#include "Engine/Core/Yaml.hpp"
+
+using namespace enigma::core;
+
+TerrainMeshingSettings GreedyTerrainMesher::s_settings;
+
+namespace
+{
+    constexpr const char* DEFAULT_NAMESPACE = "simpleminer";
+
+    // Vertex color brightness per AO level, 0 = both sides and the corner blocked
+    constexpr float AO_BRIGHTNESS[4] = {0.5f, 0.7f, 0.85f, 1.0f};
+
+    struct FaceAxes
+    {
+        int axis; // Normal axis, 0 = X, 1 = Y, 2 = Z
+        int sign; // +1 / -1
+        int u;    // First tangent axis
+        int v;    // Second tangent axis
+    };
+
+    FaceAxes GetFaceAxes(TerrainVertexFace face)
+    {
+        switch (face)
+        {
+        case TerrainVertexFace::NegX: return {0, -1, 1, 2};
+        case TerrainVertexFace::PosX: return {0, 1, 1, 2};
+        case TerrainVertexFace::NegY: return {1, -1, 0, 2};
+        case TerrainVertexFace::PosY: return {1, 1, 0, 2};
+        case TerrainVertexFace::NegZ: return {2, -1, 0, 1};
+        default: return {2, 1, 0, 1};
+        }
+    }
+
+    bool IsOpaqueCube(const TerrainMeshingVolume& volume, const int (&p)[3])
+    {
+        return volume.GetClass(p[0], p[1], p[2]) == TerrainMeshCellClass::OpaqueCube;
+    }
+
+    /// AO of the four face corners from the opaque cubes around the cell in front of the face
+    uint8_t ComputeFaceAo(const TerrainMeshingVolume& volume, const int (&front)[3], const FaceAxes& axes)
+    {
+        static constexpr int CORNERS[4][2] = {{-1, -1}, {1, -1}, {1, 1}, {-1, 1}};
+
+        uint8_t ao = 0;
+        for (int corner = 0; corner < 4; ++corner)
+        {
+            int side1[3]    = {front[0], front[1], front[2]};
+            int side2[3]    = {front[0], front[1], front[2]};
+            int diagonal[3] = {front[0], front[1], front[2]};
+            side1[axes.u] += CORNERS[corner][0];
+            side2[axes.v] += CORNERS[corner][1];
+            diagonal[axes.u] += CORNERS[corner][0];
+            diagonal[axes.v] += CORNERS[corner][1];
+
+            const int s1    = IsOpaqueCube(volume, side1) ? 1 : 0;
+            const int s2    = IsOpaqueCube(volume, side2) ? 1 : 0;
+            const int c     = IsOpaqueCube(volume, diagonal) ? 1 : 0;
+            const int level = (s1 && s2) ? 0 : 3 - (s1 + s2 + c);
+            ao |= static_cast<uint8_t>(level << (corner * 2));
+        }
+        return ao;
+    }
+
+    // Key of a visible face, 0 = no mergeable face. Equal keys merge.
+    uint64_t MakeFaceKey(uint16_t material, uint8_t light, uint8_t ao, TerrainMeshLayer layer)
+    {
+        return static_cast<uint64_t>(material) << 24 | static_cast<uint64_t>(light) << 16 | static_cast<uint64_t>(ao) << 8 | static_cast<uint64_t>(layer);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void TerrainMeshingVolume::Resize(int32_t x, int32_t y, int32_t z)
+{
+    sizeX = x;
+    sizeY = y;
+    sizeZ = z;
+    materials.assign(static_cast<size_t>(x) * y * z, 0);
+    light.assign(static_cast<size_t>(x) * y * z, 0x0F);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool TerrainMeshingVolume::IsInside(int32_t x, int32_t y, int32_t z) const
+{
+    return x >= 0 && y >= 0 && z >= 0 && x < sizeX && y < sizeY && z < sizeZ;
+}
+
+// ------------------------------------------------------------------------------------------------
+uint16_t TerrainMeshingVolume::GetMaterial(int32_t x, int32_t y, int32_t z) const
+{
+    return IsInside(x, y, z) ? materials[GetIndex(x, y, z)] : 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+TerrainMeshCellClass TerrainMeshingVolume::GetClass(int32_t x, int32_t y, int32_t z) const
+{
+    const uint16_t material = GetMaterial(x, y, z);
+    return material < materialClasses.size() ? materialClasses[material] : TerrainMeshCellClass::Empty;
+}
+
+// ------------------------------------------------------------------------------------------------
+uint8_t TerrainMeshingVolume::GetLight(int32_t x, int32_t y, int32_t z) const
+{
+    return IsInside(x, y, z) ? light[GetIndex(x, y, z)] : 0x0F;
+}
+
+// ------------------------------------------------------------------------------------------------
+void GreedyTerrainMesher::LoadSettings(const YamlConfiguration& config)
+{
+    s_settings.maxQuadExtent = static_cast<uint16_t>(std::clamp(config.GetInt("terrainMeshing.maxQuadExtent", s_settings.maxQuadExtent), 1, 255));
+}
+
+// ------------------------------------------------------------------------------------------------
+TerrainMeshCellClass GreedyTerrainMesher::ClassifyBlock(const std::string& registryName)
+{
+    const size_t      colon     = registryName.find(':');
+    const std::string nameSpace = colon != std::string::npos ? registryName.substr(0, colon) : DEFAULT_NAMESPACE;
+    const std::string path      = colon != std::string::npos ? registryName.substr(colon + 1) : registryName;
+
+    if (path == "air" || path.empty())
+        return TerrainMeshCellClass::Empty;
+
+    // Render layer is not part of the block data; the same short list the renderer sorts as translucent
+    const bool translucent = path == "water" || path == "ice" || path.find("glass") != std::string::npos;
+
+    // [STEP 1] A block model decides whether the block is a full cube
+    std::ifstream modelFile(".enigma/assets/" + nameSpace + "/models/block/" + path + ".json");
+    if (modelFile)
+    {
+        const Json model = Json::parse(modelFile, nullptr, false);
+        if (model.is_discarded() || !model.is_object())
+            return TerrainMeshCellClass::Other;
+
+        std::string  parent      = model.value("parent", std::string());
+        const size_t parentColon = parent.find(':');
+        if (parentColon != std::string::npos)
+            parent = parent.substr(parentColon + 1);
+        if (parent.rfind("block/cube", 0) != 0)
+            return TerrainMeshCellClass::Other;
+        return translucent ? TerrainMeshCellClass::TranslucentCube : TerrainMeshCellClass::OpaqueCube;
+    }
+
+    // [STEP 2] Without a model file the engine falls back to a textured cube; leaves still render as cutout
+    if (path.find("leaves") != std::string::npos)
+        return TerrainMeshCellClass::Other;
+    return translucent ? TerrainMeshCellClass::TranslucentCube : TerrainMeshCellClass::OpaqueCube;
+}
+
+// ------------------------------------------------------------------------------------------------
+void GreedyTerrainMesher::BuildQuads(const TerrainMeshingVolume& volume, bool greedy, std::vector<TerrainMeshQuad>& outQuads, TerrainMeshStats* outStats)
+{
+    BuildQuads(volume, 0, volume.sizeZ, greedy, outQuads, outStats);
+}
+
+// ------------------------------------------------------------------------------------------------
+void GreedyTerrainMesher::BuildQuads(const TerrainMeshingVolume& volume, int32_t zBegin, int32_t zEnd, bool greedy, std::vector<TerrainMeshQuad>& outQuads, TerrainMeshStats* outStats)
+{
+    zBegin = std::clamp(zBegin, 0, volume.sizeZ);
+    zEnd   = std::clamp(zEnd, zBegin, volume.sizeZ);
+
+    const int        begin[3]  = {0, 0, zBegin};
+    const int        size[3]   = {volume.sizeX, volume.sizeY, zEnd - zBegin};
+    const int        maxExtent = greedy ? s_settings.maxQuadExtent : 1;
+    TerrainMeshStats stats;
+
+    std::vector<uint64_t>        mask;
+    std::vector<TerrainMaskRect> rects;
+    for (int faceIndex = 0; faceIndex <= static_cast<int>(TerrainVertexFace::PosZ); ++faceIndex)
+    {
+        const TerrainVertexFace face  = static_cast<TerrainVertexFace>(faceIndex);
+        const FaceAxes          axes  = GetFaceAxes(face);
+        const int               sizeU = size[axes.u];
+        const int               sizeV = size[axes.v];
+        mask.assign(static_cast<size_t>(sizeU) * sizeV, 0);
+
+        // Mask coordinates are relative to the range; cells and quads use volume coordinates
+        for (int d = 0; d < size[axes.axis]; ++d)
+        {
+            // [STEP 1] Mask of visible faces in this slice
+            bool anyFace = false;
+            for (int v = 0; v < sizeV; ++v)
+            {
+                for (int u = 0; u < sizeU; ++u)
+                {
+                    int cell[3];
+                    cell[axes.axis] = begin[axes.axis] + d;
+                    cell[axes.u]    = begin[axes.u] + u;
+                    cell[axes.v]    = begin[axes.v] + v;
+                    int front[3]    = {cell[0], cell[1], cell[2]};
+                    front[axes.axis] += axes.sign;
+
+                    uint64_t&                  key       = mask[u + v * sizeU];
+                    const TerrainMeshCellClass cellClass = volume.GetClass(cell[0], cell[1], cell[2]);
+                    const TerrainMeshCellClass faceClass = volume.GetClass(front[0], front[1], front[2]);
+                    key                                  = 0;
+                    if (cellClass == TerrainMeshCellClass::Empty || faceClass == TerrainMeshCellClass::OpaqueCube)
+                        continue;
+
+                    if (cellClass == TerrainMeshCellClass::Other)
+                    {
+                        ++stats.otherFaces;
+                        continue;
+                    }
+
+                    const uint16_t material = volume.GetMaterial(cell[0], cell[1], cell[2]);
+                    if (cellClass == TerrainMeshCellClass::TranslucentCube && volume.GetMaterial(front[0], front[1], front[2]) == material)
+                        continue;
+
+                    const TerrainMeshLayer layer = cellClass == TerrainMeshCellClass::OpaqueCube ? TerrainMeshLayer::Opaque : TerrainMeshLayer::Translucent;
+                    key                          = MakeFaceKey(material, volume.GetLight(front[0], front[1], front[2]), ComputeFaceAo(volume, front, axes), layer);
+                    anyFace                      = true;
+                    ++stats.faces[static_cast<int>(layer)];
+                }
+            }
+            if (!anyFace)
+                continue;
+
+            // [STEP 2] Grow rectangles of equal keys
+            rects.clear();
+            MergeMask(mask, sizeU, sizeV, maxExtent, rects);
+
+            // [STEP 3] Quads on the face plane, which is the far side of the cell for positive faces
+            for (const TerrainMaskRect& rect : rects)
+            {
+                int origin[3];
+                origin[axes.axis] = begin[axes.axis] + d + (axes.sign > 0 ? 1 : 0);
+                origin[axes.u]    = begin[axes.u] + rect.u;
+                origin[axes.v]    = begin[axes.v] + rect.v;
+
+                TerrainMeshQuad quad;
+                quad.x        = static_cast<int16_t>(origin[0]);
+                quad.y        = static_cast<int16_t>(origin[1]);
+                quad.z        = static_cast<int16_t>(origin[2]);
+                quad.width    = static_cast<uint16_t>(rect.width);
+                quad.height   = static_cast<uint16_t>(rect.height);
+                quad.material = static_cast<uint16_t>(rect.key >> 24);
+                quad.face     = face;
+                quad.light    = static_cast<uint8_t>(rect.key >> 16);
+                quad.ao       = static_cast<uint8_t>(rect.key >> 8);
+                quad.layer    = static_cast<TerrainMeshLayer>(rect.key & 0xFF);
+                outQuads.push_back(quad);
+                ++stats.quads[static_cast<int>(quad.layer)];
+            }
+        }
+    }
+
+    if (outStats)
+        *outStats = stats;
+}
+
+// ------------------------------------------------------------------------------------------------
+void GreedyTerrainMesher::MergeMask(std::vector<uint64_t>& mask, int32_t sizeU, int32_t sizeV, int32_t maxExtent, std::vector<TerrainMaskRect>& outRects)
+{
+    for (int32_t v = 0; v < sizeV; ++v)
+    {
+        for (int32_t u = 0; u < sizeU;)
+        {
+            const uint64_t key = mask[u + v * sizeU];
+            if (key == 0)
+            {
+                ++u;
+                continue;
+            }
+
+            int32_t width = 1;
+            while (width < maxExtent && u + width < sizeU && mask[u + width + v * sizeU] == key)
+                ++width;
+
+            int32_t height = 1;
+            while (height < maxExtent && v + height < sizeV)
+            {
+                bool rowMatches = true;
+                for (int32_t k = 0; k < width && rowMatches; ++k)
+                    rowMatches = mask[u + k + (v + height) * sizeU] == key;
+                if (!rowMatches)
+                    break;
+                ++height;
+            }
+
+            for (int32_t dv = 0; dv < height; ++dv)
+                std::fill_n(mask.begin() + (u + (v + dv) * sizeU), width, 0);
+
+            outRects.push_back({u, v, width, height, key});
+            u += width;
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void GreedyTerrainMesher::EmitQuadVertices(const TerrainMeshQuad& quad, const Vec2& midTexCoord, const Vec2& tileSizeUV, std::vector<TerrainVertexAttributes>& outVertices)
+{
+    static constexpr int CORNERS[4][2] = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+
+    const FaceAxes axes = GetFaceAxes(quad.face);
+    const float    w    = static_cast<float>(quad.width);
+    const float    h    = static_cast<float>(quad.height);
+
+    // U x V points along +X, -Y and +Z; the other faces walk the corners backwards to stay counter-clockwise
+    const bool uvAlongNormal = (axes.axis == 1) ? axes.sign < 0 : axes.sign > 0;
+    // Faces seen from +X / +Y have their U axis pointing left, mirror U so textures are not flipped
+    const bool mirrorU       = axes.axis != 2 && axes.sign > 0;
+    const bool sideFace      = axes.axis != 2;
+
+    const Vec2 lightmap(static_cast<float>(quad.light >> 4) / 15.0f, static_cast<float>(quad.light & 0xF) / 15.0f);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        const int corner = uvAlongNormal ? i : (4 - i) % 4;
+        const int cu     = CORNERS[corner][0];
+        const int cv     = CORNERS[corner][1];
+
+        float position[3] = {static_cast<float>(quad.x), static_cast<float>(quad.y), static_cast<float>(quad.z)};
+        position[axes.u] += static_cast<float>(cu) * w;
+        position[axes.v] += static_cast<float>(cv) * h;
+
+        // Texture V grows downwards, so side faces count it from the top edge
+        const float tileU = mirrorU ? w * static_cast<float>(1 - cu) : w * static_cast<float>(cu);
+        const float tileV = sideFace ? h * static_cast<float>(1 - cv) : h * static_cast<float>(cv);
+
+        const uint8_t aoLevel    = static_cast<uint8_t>(quad.ao >> (corner * 2) & 0x3);
+        const uint8_t brightness = static_cast<uint8_t>(AO_BRIGHTNESS[aoLevel] * 255.0f + 0.5f);
+
+        TerrainVertexAttributes vertex;
+        vertex.position    = Vec3(position[0], position[1], position[2]);
+        vertex.color       = Rgba8(brightness, brightness, brightness, 255);
+        vertex.uv          = Vec2(midTexCoord.x + (tileU - 0.5f) * tileSizeUV.x, midTexCoord.y + (tileV - 0.5f) * tileSizeUV.y);
+        vertex.normal      = GetTerrainVertexFaceNormal(quad.face);
+        vertex.lightmap    = lightmap;
+        vertex.midTexCoord = midTexCoord;
+        outVertices.push_back(vertex);
+    }
+}
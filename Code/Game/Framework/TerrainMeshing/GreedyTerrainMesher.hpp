@@ -0,0 +1,138 @@
+/**
+ * @file GreedyTerrainMesher.hpp
+ * @brief Greedy merging of coplanar full-block faces into larger quads with tiled UVs
+ * @date 2026-10-16
+ *
+ * Per-face meshing emits one quad for every visible block face, so oceans, deserts, snow plains and
+ * stone walls turn into huge numbers of identical coplanar quads. The greedy mode sweeps every slice of
+ * a chunk per face direction and merges neighbouring faces into rectangles when they agree on:
+ *   - material (block state, so the same texture for that face)
+ *   - light of the cell in front of the face
+ *   - ambient occlusion of all four corners, so merged quads shade exactly like the faces they replace
+ * Only opaque and translucent full cubes are merged; everything else (leaves, plants, custom models)
+ * stays on the per-face path.
+ *
+ * A merged quad's UVs run from 0 to its size in tiles around midTexCoord. No terrain shader wraps them
+ * back into the atlas tile: the only merged geometry that is drawn is the distant terrain LOD, whose
+ * quads are flat-coloured.
+ *
+ * MergeMask() is the rectangle sweep itself. Besides BuildQuads() it merges the column tops and walls of
+ * the distant terrain LOD meshes (DistantTerrainLod), which the game builds and draws every frame.
+ *
+ * Full-detail chunk meshes are built by the engine's chunk mesher, which does not call BuildQuads() yet;
+ * TerrainMeshingBenchmark runs it headless on generated chunks (with TerrainFaceBuckets and
+ * TerrainSectionMeshCache) to measure what the engine path would gain. There is deliberately no switch
+ * for greedy full-detail terrain until the engine mesher can emit merged quads.
+ *
+ * Configuration Path: Run/.enigma/settings.yml -> terrainMeshing
+ */
+
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Engine/Core/Yaml.hpp"
+#include "Game/Framework/RenderPass/RenderTerrain/PackedTerrainVertex.hpp"
+
+enum class TerrainMeshLayer : uint8_t
+{
+    Opaque = 0,
+    Translucent,
+    Count
+};
+
+enum class TerrainMeshCellClass : uint8_t
+{
+    Empty = 0,       // Air
+    OpaqueCube,      // Occludes neighbours, greedy candidate
+    TranslucentCube, // Greedy candidate, culled only against itself and opaque cubes
+    Other            // Not a full cube, meshed per face by the regular path
+};
+
+/// Block snapshot of one chunk; material ids are assigned by the caller, 0 is air
+struct TerrainMeshingVolume
+{
+    int32_t sizeX = 0;
+    int32_t sizeY = 0;
+    int32_t sizeZ = 0;
+
+    std::vector<uint16_t>             materials;       // Index x + (y + z * sizeY) * sizeX
+    std::vector<uint8_t>              light;           // Same indexing, block << 4 | sky; a face uses the cell in front
+    std::vector<TerrainMeshCellClass> materialClasses; // Indexed by material id
+
+    void                 Resize(int32_t x, int32_t y, int32_t z);
+    int32_t              GetIndex(int32_t x, int32_t y, int32_t z) const { return x + (y + z * sizeY) * sizeX; }
+    bool                 IsInside(int32_t x, int32_t y, int32_t z) const;
+    uint16_t             GetMaterial(int32_t x, int32_t y, int32_t z) const; // 0 outside the volume
+    TerrainMeshCellClass GetClass(int32_t x, int32_t y, int32_t z) const;
+    uint8_t              GetLight(int32_t x, int32_t y, int32_t z) const;    // Full sky light outside the volume
+};
+
+struct TerrainMeshQuad
+{
+    int16_t           x        = 0; // Min corner of the face rectangle, blocks from the volume origin
+    int16_t           y        = 0;
+    int16_t           z        = 0;
+    uint16_t          width    = 1; // Along the face's first tangent axis U (X for Y/Z faces, Y for X faces)
+    uint16_t          height   = 1; // Along the second tangent axis V (Z for side faces, Y for Z faces)
+    uint16_t          material = 0;
+    TerrainVertexFace face     = TerrainVertexFace::PosZ;
+    uint8_t           light    = 0; // block << 4 | sky
+    uint8_t           ao       = 0; // 2 bits per corner (0 = darkest, 3 = open), corners (0,0) (w,0) (w,h) (0,h) in UV
+    TerrainMeshLayer  layer    = TerrainMeshLayer::Opaque;
+};
+
+struct TerrainMeshStats
+{
+    uint32_t faces[static_cast<int>(TerrainMeshLayer::Count)] = {}; // Visible full-block faces
+    uint32_t quads[static_cast<int>(TerrainMeshLayer::Count)] = {}; // Quads emitted for them
+    uint32_t otherFaces                                       = 0;  // Visible faces of non-cube blocks, meshed per face
+};
+
+/// One rectangle of equal keys found by GreedyTerrainMesher::MergeMask()
+struct TerrainMaskRect
+{
+    int32_t  u      = 0;
+    int32_t  v      = 0;
+    int32_t  width  = 1; // Along U
+    int32_t  height = 1; // Along V
+    uint64_t key    = 0;
+};
+
+struct TerrainMeshingSettings
+{
+    uint16_t maxQuadExtent = 16; // Blocks per merged quad side; keeps UVs small for the packed vertex format
+};
+
+class GreedyTerrainMesher
+{
+public:
+    GreedyTerrainMesher()                                      = delete; // Prevent instantiation
+    GreedyTerrainMesher(const GreedyTerrainMesher&)            = delete; // Prevent copy
+    GreedyTerrainMesher& operator=(const GreedyTerrainMesher&) = delete; // Prevent assignment
+
+    static void                          LoadSettings(const enigma::core::YamlConfiguration& config);
+    static const TerrainMeshingSettings& GetSettings() { return s_settings; }
+
+    /// Class of a block from its registry name ("namespace:path"), using the block model's parent
+    static TerrainMeshCellClass ClassifyBlock(const std::string& registryName);
+
+    /// Quads for every visible full-cube face; greedy = false emits one quad per face
+    static void BuildQuads(const TerrainMeshingVolume& volume, bool greedy, std::vector<TerrainMeshQuad>& outQuads, TerrainMeshStats* outStats = nullptr);
+
+    /// Same for the faces of cells with z in [zBegin, zEnd) only, e.g. one section. Cells outside the
+    /// range are still read for culling, light and AO; merged quads never cross the range bounds.
+    static void BuildQuads(const TerrainMeshingVolume& volume, int32_t zBegin, int32_t zEnd, bool greedy, std::vector<TerrainMeshQuad>& outQuads, TerrainMeshStats* outStats = nullptr);
+
+    /// Greedy rectangles of equal non-zero keys in a sizeU x sizeV mask (index u + v * sizeU), grown
+    /// along U first, then V, at most maxExtent per side. Consumes the mask: it is all zero afterwards.
+    static void MergeMask(std::vector<uint64_t>& mask, int32_t sizeU, int32_t sizeV, int32_t maxExtent, std::vector<TerrainMaskRect>& outRects);
+
+    /// Four vertices of a quad, counter-clockwise seen from outside (indices 0 1 2, 0 2 3). UVs are
+    /// in tiles around midTexCoord; no terrain shader wraps them back into the atlas tile.
+    static void EmitQuadVertices(const TerrainMeshQuad& quad, const Vec2& midTexCoord, const Vec2& tileSizeUV, std::vector<TerrainVertexAttributes>& outVertices);
+
+private:
+    static TerrainMeshingSettings s_settings;
+};
@@ -0,0 +1,165 @@
+/**
+ * @file TerrainFaceBuckets.cpp
+ * @brief Section / direction bucketing of terrain quads and the per-bucket facing tests
+ * @date 2026-10-16
+ */
+
+#include "TerrainFaceBuckets.hpp"
+
+#include <algorithm>
+
+#include "Engine/Core/Yaml.hpp"
+#include "Game/Framework/TerrainMeshing/GreedyTerrainMesher.hpp"
+
+using namespace enigma::core;
+
+TerrainFaceBucketSettings TerrainFaceBuckets::s_settings;
+
+namespace
+{
+    constexpr int32_t DIRECTION_COUNT = TerrainFaceBucket::ANY_DIRECTION + 1;
+
+    uint8_t GetBucketDirection(const TerrainMeshQuad& quad)
+    {
+        if (quad.layer == TerrainMeshLayer::Translucent || static_cast<uint8_t>(quad.face) >= TerrainFaceBucket::ANY_DIRECTION)
+            return TerrainFaceBucket::ANY_DIRECTION;
+        return static_cast<uint8_t>(quad.face);
+    }
+
+    /// Section layer of the block a quad belongs to; +Z faces sit on top of their block
+    int32_t GetQuadSectionZ(const TerrainMeshQuad& quad, int32_t sectionSize)
+    {
+        const int32_t blockZ = quad.face == TerrainVertexFace::PosZ ? quad.z - 1 : quad.z;
+        return std::max(blockZ, 0) / sectionSize;
+    }
+
+    AABB3 GetQuadBounds(const TerrainMeshQuad& quad)
+    {
+        Vec3 mins(static_cast<float>(quad.x), static_cast<float>(quad.y), static_cast<float>(quad.z));
+        Vec3 maxs = mins;
+        switch (quad.face)
+        {
+        case TerrainVertexFace::NegX:
+        case TerrainVertexFace::PosX:
+            maxs.y += static_cast<float>(quad.width);
+            maxs.z += static_cast<float>(quad.height);
+            break;
+        case TerrainVertexFace::NegY:
+        case TerrainVertexFace::PosY:
+            maxs.x += static_cast<float>(quad.width);
+            maxs.z += static_cast<float>(quad.height);
+            break;
+        default:
+            maxs.x += static_cast<float>(quad.width);
+            maxs.y += static_cast<float>(quad.height);
+            break;
+        }
+        return AABB3(mins, maxs);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void TerrainFaceBuckets::LoadSettings(const YamlConfiguration& config)
+{
+    s_settings.enabled             = config.GetBoolean("terrainMeshing.faceBuckets.enabled", s_settings.enabled);
+    s_settings.shadowGrazingMargin = config.GetFloat("terrainMeshing.faceBuckets.shadowGrazingMargin", s_settings.shadowGrazingMargin);
+
+    s_settings.shadowGrazingMargin = std::clamp(s_settings.shadowGrazingMargin, 0.0f, 1.0f);
+}
+
+// ------------------------------------------------------------------------------------------------
+void TerrainFaceBuckets::Build(std::vector<TerrainMeshQuad>& quads, int32_t sectionSize, std::vector<TerrainFaceBucket>& outBuckets)
+{
+    outBuckets.clear();
+    if (quads.empty())
+        return;
+
+    // [STEP 1] Bucket key per quad; translucent quads share one key past every section
+    std::vector<uint32_t> keys(quads.size());
+    int32_t               sectionCount = 1;
+    for (const TerrainMeshQuad& quad : quads)
+        sectionCount = std::max(sectionCount, GetQuadSectionZ(quad, sectionSize) + 1);
+
+    const uint32_t translucentKey = static_cast<uint32_t>(sectionCount * DIRECTION_COUNT);
+    for (size_t i = 0; i < quads.size(); ++i)
+    {
+        const uint8_t direction = GetBucketDirection(quads[i]);
+        keys[i]                 = direction == TerrainFaceBucket::ANY_DIRECTION
+                                      ? translucentKey
+                                      : static_cast<uint32_t>(GetQuadSectionZ(quads[i], sectionSize) * DIRECTION_COUNT + direction);
+    }
+
+    // [STEP 2] Stable counting sort, so quads keep their mesher order inside a bucket
+    std::vector<uint32_t> offsets(translucentKey + 2, 0);
+    for (uint32_t key : keys)
+        ++offsets[key + 1];
+    for (size_t key = 1; key < offsets.size(); ++key)
+        offsets[key] += offsets[key - 1];
+
+    std::vector<TerrainMeshQuad> sorted(quads.size());
+    std::vector<uint32_t>        cursor(offsets.begin(), offsets.end() - 1);
+    for (size_t i = 0; i < quads.size(); ++i)
+        sorted[cursor[keys[i]]++] = quads[i];
+    quads.swap(sorted);
+
+    // [STEP 3] One bucket per non-empty key
+    for (uint32_t key = 0; key <= translucentKey; ++key)
+    {
+        const uint32_t first = offsets[key];
+        const uint32_t count = offsets[key + 1] - first;
+        if (count == 0)
+            continue;
+
+        TerrainFaceBucket bucket;
+        bucket.direction = key == translucentKey ? TerrainFaceBucket::ANY_DIRECTION : static_cast<uint8_t>(key % DIRECTION_COUNT);
+        bucket.sectionZ  = static_cast<int16_t>(key == translucentKey ? 0 : key / DIRECTION_COUNT);
+        bucket.firstQuad = first;
+        bucket.quadCount = count;
+        bucket.bounds    = GetQuadBounds(quads[first]);
+        for (uint32_t i = first + 1; i < first + count; ++i)
+        {
+            const AABB3 quadBounds = GetQuadBounds(quads[i]);
+            bucket.bounds.m_mins.x = std::min(bucket.bounds.m_mins.x, quadBounds.m_mins.x);
+            bucket.bounds.m_mins.y = std::min(bucket.bounds.m_mins.y, quadBounds.m_mins.y);
+            bucket.bounds.m_mins.z = std::min(bucket.bounds.m_mins.z, quadBounds.m_mins.z);
+            bucket.bounds.m_maxs.x = std::max(bucket.bounds.m_maxs.x, quadBounds.m_maxs.x);
+            bucket.bounds.m_maxs.y = std::max(bucket.bounds.m_maxs.y, quadBounds.m_maxs.y);
+            bucket.bounds.m_maxs.z = std::max(bucket.bounds.m_maxs.z, quadBounds.m_maxs.z);
+        }
+        outBuckets.push_back(bucket);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+bool TerrainFaceBuckets::IsFrontFacing(const TerrainFaceBucket& bucket, const Vec3& cameraInVolume)
+{
+    // Face planes of the bucket span bounds along the normal axis; one plane behind the camera is enough
+    switch (static_cast<TerrainVertexFace>(bucket.direction))
+    {
+    case TerrainVertexFace::NegX: return cameraInVolume.x < bucket.bounds.m_maxs.x;
+    case TerrainVertexFace::PosX: return cameraInVolume.x > bucket.bounds.m_mins.x;
+    case TerrainVertexFace::NegY: return cameraInVolume.y < bucket.bounds.m_maxs.y;
+    case TerrainVertexFace::PosY: return cameraInVolume.y > bucket.bounds.m_mins.y;
+    case TerrainVertexFace::NegZ: return cameraInVolume.z < bucket.bounds.m_maxs.z;
+    case TerrainVertexFace::PosZ: return cameraInVolume.z > bucket.bounds.m_mins.z;
+    default: return true;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+bool TerrainFaceBuckets::IsFrontFacingDirection(const TerrainFaceBucket& bucket, const Vec3& viewDirection)
+{
+    // Cosine between the face normal and the view direction; positive faces away
+    float awayCosine = 0.0f;
+    switch (static_cast<TerrainVertexFace>(bucket.direction))
+    {
+    case TerrainVertexFace::NegX: awayCosine = -viewDirection.x; break;
+    case TerrainVertexFace::PosX: awayCosine = viewDirection.x; break;
+    case TerrainVertexFace::NegY: awayCosine = -viewDirection.y; break;
+    case TerrainVertexFace::PosY: awayCosine = viewDirection.y; break;
+    case TerrainVertexFace::NegZ: awayCosine = -viewDirection.z; break;
+    case TerrainVertexFace::PosZ: awayCosine = viewDirection.z; break;
+    default: return true;
+    }
+    return awayCosine <= s_settings.shadowGrazingMargin;
+}
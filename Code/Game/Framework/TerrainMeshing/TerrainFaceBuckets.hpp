@@ -0,0 +1,77 @@
+/**
+ * @file TerrainFaceBuckets.hpp
+ * @brief Per-section face-direction buckets of terrain quads, so whole back-facing groups can be skipped
+ * @date 2026-10-16
+ *
+ * A region's sub-draws mix faces of all six directions, so roughly half of every opaque region's
+ * triangles face away from the camera and are only rejected by the rasterizer after vertex shading.
+ * Build() reorders a chunk's quads into contiguous buckets keyed by 16-block section layer and face
+ * direction; each bucket is one index range (6 indices per quad, firstQuad * 6 onwards) plus the
+ * bounds of its quads.
+ *
+ * A bucket of +X faces can only show a front face when the camera is on the +X side of its lowest
+ * face plane, so IsFrontFacing() is exact per bucket and never hides a visible face. For the
+ * orthographic shadow view IsFrontFacingDirection() tests the light direction instead; the shadow pass
+ * renders without back-face culling to avoid light leaks at grazing angles, so buckets within
+ * shadowGrazingMargin of edge-on are kept.
+ *
+ * Translucent quads stay together in one direction-less bucket at the end, in mesh order.
+ *
+ * Drawn today: the distant terrain LOD meshes are split by face direction when they are built, and
+ * DistantTerrainRenderPass skips the directions that fail IsFrontFacing() while GetSettings().enabled
+ * is set. Full-detail chunks are not: the engine mesher owns their index buffers and ChunkBatchCollector
+ * their sub-draw lists, and neither takes ranges from the game. For those, TerrainMeshingBenchmark runs
+ * Build() on generated chunks and reports how many quads the tests would skip.
+ *
+ * Configuration Path: Run/.enigma/settings.yml -> terrainMeshing.faceBuckets
+ */
+
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Core/Yaml.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/Vec3.hpp"
+
+struct TerrainMeshQuad;
+
+struct TerrainFaceBucket
+{
+    static constexpr uint8_t ANY_DIRECTION = 6; // Translucent quads, never culled by direction
+
+    uint8_t  direction = ANY_DIRECTION; // TerrainVertexFace of every quad in the bucket
+    int16_t  sectionZ  = 0;             // Section layer of the quads' min corner
+    uint32_t firstQuad = 0;
+    uint32_t quadCount = 0;
+    AABB3    bounds;                    // Volume coordinates; spans past the section for quads merged across it
+};
+
+struct TerrainFaceBucketSettings
+{
+    bool  enabled             = true;
+    float shadowGrazingMargin = 0.1f; // Cosine between face normal and light below which a face counts as edge-on
+};
+
+class TerrainFaceBuckets
+{
+public:
+    TerrainFaceBuckets()                                     = delete; // Prevent instantiation
+    TerrainFaceBuckets(const TerrainFaceBuckets&)            = delete; // Prevent copy
+    TerrainFaceBuckets& operator=(const TerrainFaceBuckets&) = delete; // Prevent assignment
+
+    static void                       LoadSettings(const enigma::core::YamlConfiguration& config);
+    static TerrainFaceBucketSettings& GetSettings() { return s_settings; }
+
+    /// Reorders quads into buckets (section layer, then direction; translucent last) and lists them
+    static void Build(std::vector<TerrainMeshQuad>& quads, int32_t sectionSize, std::vector<TerrainFaceBucket>& outBuckets);
+
+    /// Whether any quad of the bucket can face a perspective camera; cameraInVolume in volume coordinates
+    static bool IsFrontFacing(const TerrainFaceBucket& bucket, const Vec3& cameraInVolume);
+
+    /// Same for an orthographic view looking along viewDirection (shadow: from the light into the scene)
+    static bool IsFrontFacingDirection(const TerrainFaceBucket& bucket, const Vec3& viewDirection);
+
+private:
+    static TerrainFaceBucketSettings s_settings;
+};
@@ -0,0 +1,430 @@
+/**
+ * @file TerrainMeshingBenchmark.cpp
+ * @brief Per-face vs greedy meshing comparison on generated chunks
+ * @date 2026-10-16
+ */
+
+#include "TerrainMeshingBenchmark.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "GreedyTerrainMesher.hpp"
+#include "TerrainFaceBuckets.hpp"
+#include "TerrainSectionMeshCache.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Core/Yaml.hpp"
+#include "Engine/Voxel/Chunk/Chunk.hpp"
+#include "Engine/Voxel/World/World.hpp"
+#include "Game/Framework/Scheduling/TaskScheduler.hpp"
+
+using namespace enigma::core;
+using enigma::voxel::BlockState;
+using enigma::voxel::Chunk;
+
+TerrainMeshingBenchmarkSettings TerrainMeshingBenchmark::s_settings;
+
+namespace
+{
+    constexpr uint32_t LAYER_COUNT            = static_cast<uint32_t>(TerrainMeshLayer::Count);
+    constexpr int32_t  SECTION_SIZE           = 16;
+    constexpr uint32_t MAX_CAPTURES_PER_FRAME = 4;
+
+    // Views the face-bucket test is measured from: above the chunk, off to one side, and a mid-morning sun
+    enum FaceView
+    {
+        FACE_VIEW_OVERHEAD = 0,
+        FACE_VIEW_SIDE,
+        FACE_VIEW_SHADOW,
+        FACE_VIEW_COUNT
+    };
+
+    constexpr const char* FACE_VIEW_NAMES[FACE_VIEW_COUNT] = {"overhead", "side", "shadow"};
+
+    struct CapturedChunk
+    {
+        int32_t              chunkX = 0;
+        int32_t              chunkY = 0;
+        TerrainMeshingVolume volume;
+    };
+
+    struct ModeResult
+    {
+        uint64_t quads[LAYER_COUNT] = {};
+        uint64_t vertices           = 0;
+        uint32_t maxVertices        = 0;
+        double   totalMs            = 0.0;
+    };
+
+    struct SectionCacheResult
+    {
+        uint64_t sections           = 0;
+        uint64_t opaqueEdgeSections = 0; // All four neighbour edges opaque
+        uint64_t directQuads        = 0;
+        uint64_t cachedQuads        = 0;
+        uint64_t mismatchedHits     = 0; // Hits whose quads differ from the direct mesh; must stay 0
+        double   directMs           = 0.0;
+        double   cachedMs           = 0.0;
+    };
+
+    // Main thread only; Run() reads the corpus after capturing has stopped
+    std::vector<CapturedChunk>                      s_corpus;
+    std::unordered_set<uint64_t>                    s_capturedChunks;
+    std::unordered_map<const BlockState*, uint16_t> s_materialIds; // 0 is air
+    std::vector<TerrainMeshCellClass>               s_materialClasses{TerrainMeshCellClass::Empty};
+    bool                                            s_capturing = false;
+
+    uint16_t GetMaterialId(BlockState* state)
+    {
+        if (!state)
+            return 0;
+
+        auto it = s_materialIds.find(state);
+        if (it != s_materialIds.end())
+            return it->second;
+
+        const TerrainMeshCellClass cellClass = GreedyTerrainMesher::ClassifyBlock(state->GetBlock()->GetRegistryName());
+        uint16_t                   id        = 0;
+        if (cellClass != TerrainMeshCellClass::Empty && s_materialClasses.size() < 0xFFFF)
+        {
+            id = static_cast<uint16_t>(s_materialClasses.size());
+            s_materialClasses.push_back(cellClass);
+        }
+        s_materialIds.emplace(state, id);
+        return id;
+    }
+
+    /// Greedy opaque quads a view skips through whole back-facing buckets
+    uint32_t CountBackFacingQuads(const std::vector<TerrainFaceBucket>& buckets, FaceView view, const Vec3& volumeSize)
+    {
+        float surfaceZ = 0.0f;
+        for (const TerrainFaceBucket& bucket : buckets)
+            surfaceZ = std::max(surfaceZ, bucket.bounds.m_maxs.z);
+
+        const Vec3 overheadCamera(volumeSize.x * 0.5f, volumeSize.y * 0.5f, surfaceZ + 16.0f);
+        const Vec3 sideCamera(-48.0f, volumeSize.y * 0.25f, surfaceZ + 8.0f);
+        const Vec3 lightDirection = Vec3(0.4f, 0.25f, -0.88f).GetNormalized();
+
+        uint32_t skipped = 0;
+        for (const TerrainFaceBucket& bucket : buckets)
+        {
+            bool frontFacing = true;
+            switch (view)
+            {
+            case FACE_VIEW_OVERHEAD: frontFacing = TerrainFaceBuckets::IsFrontFacing(bucket, overheadCamera); break;
+            case FACE_VIEW_SIDE: frontFacing = TerrainFaceBuckets::IsFrontFacing(bucket, sideCamera); break;
+            default: frontFacing = TerrainFaceBuckets::IsFrontFacingDirection(bucket, lightDirection); break;
+            }
+            if (!frontFacing)
+                skipped += bucket.quadCount;
+        }
+        return skipped;
+    }
+
+    uint64_t MakeChunkKey(int32_t chunkX, int32_t chunkY)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(chunkX)) << 32) | static_cast<uint32_t>(chunkY);
+    }
+
+    /// Floor division, so negative block coordinates map to the chunk below zero
+    int32_t FloorDiv(int32_t value, int32_t divisor)
+    {
+        const int32_t quotient = value / divisor;
+        return (value % divisor != 0 && (value < 0) != (divisor < 0)) ? quotient - 1 : quotient;
+    }
+
+    /// Cells of the neighbour's border column range facing the section are all opaque cubes
+    bool IsNeighborEdgeOpaque(const TerrainMeshingVolume& neighbor, int32_t x0, int32_t x1, int32_t y0, int32_t y1, int32_t zBegin, int32_t zEnd)
+    {
+        for (int32_t z = zBegin; z < zEnd; ++z)
+        {
+            for (int32_t y = y0; y <= y1; ++y)
+            {
+                for (int32_t x = x0; x <= x1; ++x)
+                {
+                    if (neighbor.GetClass(x, y, z) != TerrainMeshCellClass::OpaqueCube)
+                        return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool AreNeighborEdgesOpaque(const std::unordered_map<uint64_t, const CapturedChunk*>& corpus, const CapturedChunk& chunk, int32_t zBegin, int32_t zEnd)
+    {
+        const auto west  = corpus.find(MakeChunkKey(chunk.chunkX - 1, chunk.chunkY));
+        const auto east  = corpus.find(MakeChunkKey(chunk.chunkX + 1, chunk.chunkY));
+        const auto south = corpus.find(MakeChunkKey(chunk.chunkX, chunk.chunkY - 1));
+        const auto north = corpus.find(MakeChunkKey(chunk.chunkX, chunk.chunkY + 1));
+        if (west == corpus.end() || east == corpus.end() || south == corpus.end() || north == corpus.end())
+            return false;
+
+        const int32_t maxX = chunk.volume.sizeX - 1;
+        const int32_t maxY = chunk.volume.sizeY - 1;
+        return IsNeighborEdgeOpaque(west->second->volume, maxX, maxX, 0, maxY, zBegin, zEnd) &&
+            IsNeighborEdgeOpaque(east->second->volume, 0, 0, 0, maxY, zBegin, zEnd) &&
+            IsNeighborEdgeOpaque(south->second->volume, 0, maxX, maxY, maxY, zBegin, zEnd) &&
+            IsNeighborEdgeOpaque(north->second->volume, 0, maxX, 0, 0, zBegin, zEnd);
+    }
+
+    bool AreQuadsEqual(const std::vector<TerrainMeshQuad>& a, const std::vector<TerrainMeshQuad>& b)
+    {
+        return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](const TerrainMeshQuad& left, const TerrainMeshQuad& right)
+        {
+            return left.x == right.x && left.y == right.y && left.z == right.z && left.width == right.width && left.height == right.height &&
+                left.material == right.material && left.face == right.face && left.light == right.light && left.ao == right.ao && left.layer == right.layer;
+        });
+    }
+
+    uint32_t CountVertices(const TerrainMeshStats& stats, bool greedy)
+    {
+        uint32_t quads = stats.otherFaces;
+        for (uint32_t layer = 0; layer < LAYER_COUNT; ++layer)
+            quads += greedy ? stats.quads[layer] : stats.faces[layer];
+        return quads * 4;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void TerrainMeshingBenchmark::LoadSettings(const YamlConfiguration& config)
+{
+    s_settings.enabled      = config.GetBoolean("terrainMeshing.benchmark.enabled", s_settings.enabled);
+    s_settings.corpusChunks = static_cast<uint32_t>(std::max(config.GetInt("terrainMeshing.benchmark.corpusChunks", static_cast<int>(s_settings.corpusChunks)), 1));
+    s_settings.outputPath   = config.GetString("terrainMeshing.benchmark.output", s_settings.outputPath);
+
+    s_capturing = s_settings.enabled;
+}
+
+// ------------------------------------------------------------------------------------------------
+void TerrainMeshingBenchmark::Update(enigma::voxel::World& world, const Vec3& playerPosition)
+{
+    if (!s_capturing)
+        return;
+
+    // Square around the player just large enough for the corpus; chunks still generating are picked up later
+    const int32_t radius   = static_cast<int32_t>(std::ceil(std::sqrt(static_cast<double>(s_settings.corpusChunks)) * 0.5));
+    const int32_t centerX  = FloorDiv(static_cast<int32_t>(std::floor(playerPosition.x)), Chunk::CHUNK_SIZE_X);
+    const int32_t centerY  = FloorDiv(static_cast<int32_t>(std::floor(playerPosition.y)), Chunk::CHUNK_SIZE_Y);
+    uint32_t      captures = 0;
+    for (int32_t chunkY = centerY - radius; chunkY <= centerY + radius && s_capturing && captures < MAX_CAPTURES_PER_FRAME; ++chunkY)
+    {
+        for (int32_t chunkX = centerX - radius; chunkX <= centerX + radius && s_capturing && captures < MAX_CAPTURES_PER_FRAME; ++chunkX)
+        {
+            Chunk* chunk = world.GetChunk(chunkX, chunkY);
+            if (!chunk || !chunk->IsGenerated() || s_capturedChunks.count(MakeChunkKey(chunkX, chunkY)) != 0)
+                continue;
+            Capture(chunk, chunkX, chunkY);
+            ++captures;
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void TerrainMeshingBenchmark::Capture(Chunk* chunk, int32_t chunkX, int32_t chunkY)
+{
+    s_capturedChunks.insert(MakeChunkKey(chunkX, chunkY));
+
+    // [STEP 1] Blocks, top down per column so the sky estimate falls out of the same pass
+    CapturedChunk captured;
+    captured.chunkX = chunkX;
+    captured.chunkY = chunkY;
+    TerrainMeshingVolume& volume = captured.volume;
+    volume.Resize(Chunk::CHUNK_SIZE_X, Chunk::CHUNK_SIZE_Y, Chunk::CHUNK_SIZE_Z);
+    for (int y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+    {
+        for (int x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+        {
+            uint8_t skyLight = 0x0F;
+            for (int z = Chunk::CHUNK_SIZE_Z - 1; z >= 0; --z)
+            {
+                const int32_t  index    = volume.GetIndex(x, y, z);
+                const uint16_t material = GetMaterialId(chunk->GetBlock(x, y, z));
+                if (material != 0)
+                    skyLight = 0;
+                volume.materials[index] = material;
+                volume.light[index]     = skyLight;
+            }
+        }
+    }
+    s_corpus.push_back(std::move(captured));
+
+    if (s_corpus.size() >= s_settings.corpusChunks)
+    {
+        s_capturing = false;
+        TaskScheduler::Submit(TaskType::Background, &TerrainMeshingBenchmark::Run);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void TerrainMeshingBenchmark::Shutdown()
+{
+    s_capturing = false;
+}
+
+// ------------------------------------------------------------------------------------------------
+void TerrainMeshingBenchmark::Run()
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Capturing stopped before this was queued, so the corpus and material table no longer change
+    for (CapturedChunk& captured : s_corpus)
+        captured.volume.materialClasses = s_materialClasses;
+
+    // [STEP 1] Mesh every chunk per face and greedy
+    ModeResult                     results[2];
+    uint64_t                       faces[LAYER_COUNT]            = {};
+    uint64_t                       otherFaces                    = 0;
+    uint64_t                       faceBuckets                   = 0;
+    uint64_t                       bucketedQuads                 = 0;
+    uint64_t                       skippedQuads[FACE_VIEW_COUNT] = {};
+    std::string                    chunkLines;
+    std::vector<TerrainMeshQuad>   quads;
+    std::vector<TerrainFaceBucket> buckets;
+    for (const CapturedChunk& captured : s_corpus)
+    {
+        uint32_t chunkVertices[2] = {};
+        for (int mode = 0; mode < 2; ++mode)
+        {
+            const bool       greedy = mode == 1;
+            TerrainMeshStats stats;
+            quads.clear();
+            const auto start = Clock::now();
+            GreedyTerrainMesher::BuildQuads(captured.volume, greedy, quads, &stats);
+            const double elapsedMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+            ModeResult& result  = results[mode];
+            chunkVertices[mode] = CountVertices(stats, greedy);
+            result.vertices += chunkVertices[mode];
+            result.maxVertices = std::max(result.maxVertices, chunkVertices[mode]);
+            result.totalMs += elapsedMs;
+            for (uint32_t layer = 0; layer < LAYER_COUNT; ++layer)
+                result.quads[layer] += stats.quads[layer];
+
+            if (!greedy)
+            {
+                for (uint32_t layer = 0; layer < LAYER_COUNT; ++layer)
+                    faces[layer] += stats.faces[layer];
+                otherFaces += stats.otherFaces;
+                continue;
+            }
+
+            // Direction buckets of the greedy quads and what each view would skip
+            const Vec3 volumeSize(static_cast<float>(captured.volume.sizeX), static_cast<float>(captured.volume.sizeY), static_cast<float>(captured.volume.sizeZ));
+            TerrainFaceBuckets::Build(quads, SECTION_SIZE, buckets);
+            faceBuckets += buckets.size();
+            bucketedQuads += quads.size();
+            for (int view = 0; view < FACE_VIEW_COUNT; ++view)
+                skippedQuads[view] += CountBackFacingQuads(buckets, static_cast<FaceView>(view), volumeSize);
+        }
+
+        chunkLines += Stringf("%s\n    {\"x\": %d, \"y\": %d, \"verticesPerFace\": %u, \"verticesGreedy\": %u}",
+                              chunkLines.empty() ? "" : ",", captured.chunkX, captured.chunkY, chunkVertices[0], chunkVertices[1]);
+    }
+
+    // [STEP 2] Section cache: direct per-section greedy meshing vs the cache with real neighbour edges
+    std::unordered_map<uint64_t, const CapturedChunk*> corpusByKey;
+    for (const CapturedChunk& captured : s_corpus)
+        corpusByKey.emplace(MakeChunkKey(captured.chunkX, captured.chunkY), &captured);
+
+    TerrainSectionMeshCache::Clear();
+    const TerrainSectionMeshCacheStats cacheBefore = TerrainSectionMeshCache::GetStats();
+    SectionCacheResult                 sectionCache;
+    std::vector<TerrainMeshQuad>       directQuads;
+    for (const CapturedChunk& captured : s_corpus)
+    {
+        for (int32_t zBegin = 0; zBegin < captured.volume.sizeZ; zBegin += SECTION_SIZE)
+        {
+            const int32_t zEnd        = std::min(zBegin + SECTION_SIZE, captured.volume.sizeZ);
+            const bool    edgesOpaque = AreNeighborEdgesOpaque(corpusByKey, captured, zBegin, zEnd);
+            ++sectionCache.sections;
+            sectionCache.opaqueEdgeSections += edgesOpaque ? 1 : 0;
+
+            directQuads.clear();
+            auto start = Clock::now();
+            GreedyTerrainMesher::BuildQuads(captured.volume, zBegin, zEnd, true, directQuads);
+            sectionCache.directMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            sectionCache.directQuads += directQuads.size();
+
+            quads.clear();
+            start                                 = Clock::now();
+            const TerrainSectionBuildResult built = TerrainSectionMeshCache::BuildSectionQuadsCached(captured.volume, zBegin, zEnd, true, edgesOpaque, quads);
+            sectionCache.cachedMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            sectionCache.cachedQuads += quads.size();
+
+            if (built == TerrainSectionBuildResult::CacheHit && !AreQuadsEqual(quads, directQuads))
+                ++sectionCache.mismatchedHits;
+        }
+    }
+    const TerrainSectionMeshCacheStats cacheAfter = TerrainSectionMeshCache::GetStats();
+    TerrainSectionMeshCache::Clear();
+
+    const uint64_t cacheHits       = cacheAfter.cacheHits - cacheBefore.cacheHits;
+    const uint64_t cacheMisses     = cacheAfter.cacheMisses - cacheBefore.cacheMisses;
+    const uint64_t skippedEmpty    = cacheAfter.skippedEmpty - cacheBefore.skippedEmpty;
+    const uint64_t skippedEnclosed = cacheAfter.skippedEnclosed - cacheBefore.skippedEnclosed;
+    const double   sectionCount    = static_cast<double>(std::max<uint64_t>(sectionCache.sections, 1));
+
+    // [STEP 3] Report
+    const double chunkCount = static_cast<double>(std::max<size_t>(s_corpus.size(), 1));
+    const double ratio      = results[1].vertices > 0 ? static_cast<double>(results[0].vertices) / static_cast<double>(results[1].vertices) : 0.0;
+    DebuggerPrintf("[TerrainMeshingBenchmark] %zu chunks: %.0f -> %.0f vertices per chunk (%.2fx), %.3f -> %.3f ms per chunk\n",
+                   s_corpus.size(), static_cast<double>(results[0].vertices) / chunkCount, static_cast<double>(results[1].vertices) / chunkCount, ratio,
+                   results[0].totalMs / chunkCount, results[1].totalMs / chunkCount);
+
+    std::string modes;
+    for (int mode = 0; mode < 2; ++mode)
+    {
+        const ModeResult& result = results[mode];
+        modes += Stringf("%s\n    \"%s\": {\"opaqueQuads\": %llu, \"translucentQuads\": %llu, \"vertices\": %llu, \"verticesPerChunk\": %.1f, \"maxVerticesPerChunk\": %u, \"msPerChunk\": %.4f}",
+                         mode == 0 ? "" : ",", mode == 0 ? "perFace" : "greedy",
+                         static_cast<unsigned long long>(result.quads[static_cast<int>(TerrainMeshLayer::Opaque)]),
+                         static_cast<unsigned long long>(result.quads[static_cast<int>(TerrainMeshLayer::Translucent)]),
+                         static_cast<unsigned long long>(result.vertices), static_cast<double>(result.vertices) / chunkCount, result.maxVertices,
+                         result.totalMs / chunkCount);
+    }
+
+    std::string faceViews;
+    for (int view = 0; view < FACE_VIEW_COUNT; ++view)
+    {
+        const double skippedFraction = bucketedQuads > 0 ? static_cast<double>(skippedQuads[view]) / static_cast<double>(bucketedQuads) : 0.0;
+        faceViews += Stringf("%s\"%s\": %.3f", view == 0 ? "" : ", ", FACE_VIEW_NAMES[view], skippedFraction);
+    }
+    DebuggerPrintf("[TerrainMeshingBenchmark] Face buckets: %.1f per chunk, skipped quad fraction %s\n",
+                   static_cast<double>(faceBuckets) / chunkCount, faceViews.c_str());
+    DebuggerPrintf("[TerrainMeshingBenchmark] Section cache: %llu sections, %.1f%% hits, %.1f%% empty, %.1f%% enclosed, %.3f -> %.3f ms per chunk, %llu mismatched hits\n",
+                   static_cast<unsigned long long>(sectionCache.sections), 100.0 * static_cast<double>(cacheHits) / sectionCount,
+                   100.0 * static_cast<double>(skippedEmpty) / sectionCount, 100.0 * static_cast<double>(skippedEnclosed) / sectionCount,
+                   sectionCache.directMs / chunkCount, sectionCache.cachedMs / chunkCount, static_cast<unsigned long long>(sectionCache.mismatchedHits));
+
+    const std::filesystem::path outputPath(s_settings.outputPath);
+    std::error_code             ec;
+    std::filesystem::create_directories(outputPath.parent_path(), ec);
+
+    std::ofstream output(outputPath, std::ios::trunc);
+    output << Stringf("{\n  \"chunks\": %zu,\n  \"maxQuadExtent\": %u,\n  \"opaqueFaces\": %llu,\n  \"translucentFaces\": %llu,\n"
+                      "  \"otherFaces\": %llu,\n  \"vertexReduction\": %.3f,\n  \"modes\": {",
+                      s_corpus.size(), static_cast<unsigned>(GreedyTerrainMesher::GetSettings().maxQuadExtent),
+                      static_cast<unsigned long long>(faces[static_cast<int>(TerrainMeshLayer::Opaque)]),
+                      static_cast<unsigned long long>(faces[static_cast<int>(TerrainMeshLayer::Translucent)]),
+                      static_cast<unsigned long long>(otherFaces), ratio);
+    output << modes << "\n  },\n";
+    output << Stringf("  \"faceBuckets\": {\"bucketsPerChunk\": %.1f, \"skippedQuadFraction\": {%s}},\n",
+                      static_cast<double>(faceBuckets) / chunkCount, faceViews.c_str());
+    output << Stringf("  \"sectionCache\": {\"sections\": %llu, \"sectionsWithOpaqueNeighborEdges\": %llu, \"hits\": %llu, \"misses\": %llu, "
+                      "\"skippedEmpty\": %llu, \"skippedEnclosed\": %llu, \"mismatchedHits\": %llu, \"directQuads\": %llu, \"cachedQuads\": %llu, "
+                      "\"directMsPerChunk\": %.4f, \"cachedMsPerChunk\": %.4f},\n",
+                      static_cast<unsigned long long>(sectionCache.sections), static_cast<unsigned long long>(sectionCache.opaqueEdgeSections),
+                      static_cast<unsigned long long>(cacheHits), static_cast<unsigned long long>(cacheMisses),
+                      static_cast<unsigned long long>(skippedEmpty), static_cast<unsigned long long>(skippedEnclosed),
+                      static_cast<unsigned long long>(sectionCache.mismatchedHits), static_cast<unsigned long long>(sectionCache.directQuads),
+                      static_cast<unsigned long long>(sectionCache.cachedQuads), sectionCache.directMs / chunkCount, sectionCache.cachedMs / chunkCount);
+    output << "  \"perChunk\": [" << chunkLines << "\n  ]\n}\n";
+    DebuggerPrintf("[TerrainMeshingBenchmark] Finished, wrote %s\n", s_settings.outputPath.c_str());
+}
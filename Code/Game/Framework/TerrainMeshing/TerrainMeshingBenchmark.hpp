@@ -0,0 +1,64 @@
+/**
+ * @file TerrainMeshingBenchmark.hpp
+ * @brief Headless per-face vs greedy meshing comparison on freshly generated chunks
+ * @date 2026-10-16
+ *
+ * When terrainMeshing.benchmark.enabled is set, Update() snapshots the blocks of generated chunks
+ * loaded around the player into TerrainMeshingVolumes until corpusChunks are collected. Once the corpus is
+ * full a Background scheduler task meshes every chunk both ways with GreedyTerrainMesher and writes
+ * faces, quads, vertices per chunk and build time to the output JSON file, plus how many greedy quads
+ * TerrainFaceBuckets would skip as back-facing from an overhead view, a side view and the shadow view.
+ *
+ * The corpus is then meshed section by section twice, directly and through TerrainSectionMeshCache,
+ * reporting cache hits, empty / enclosed skips, time and whether every hit reproduced the direct mesh.
+ * Neighbour edges of a section count as opaque when the adjacent corpus chunks are opaque cubes along
+ * the shared border; a neighbour outside the corpus counts as open.
+ *
+ * Chunks are meshed without their neighbours (border faces count as visible in both modes) and light
+ * is estimated from the column heightmap (sky 15 above the highest block, 0 below), so the numbers do
+ * not depend on how far the engine's light propagation has got.
+ */
+
+#pragma once
+#include <cstdint>
+#include <string>
+
+#include "Engine/Core/Yaml.hpp"
+#include "Engine/Math/Vec3.hpp"
+
+namespace enigma::voxel
+{
+    class Chunk;
+    class World;
+}
+
+struct TerrainMeshingBenchmarkSettings
+{
+    bool        enabled      = false;
+    uint32_t    corpusChunks = 64;
+    std::string outputPath   = "Logs/terrain_meshing_benchmark.json";
+};
+
+class TerrainMeshingBenchmark
+{
+public:
+    TerrainMeshingBenchmark()                                          = delete; // Prevent instantiation
+    TerrainMeshingBenchmark(const TerrainMeshingBenchmark&)            = delete; // Prevent copy
+    TerrainMeshingBenchmark& operator=(const TerrainMeshingBenchmark&) = delete; // Prevent assignment
+
+    static void LoadSettings(const enigma::core::YamlConfiguration& config);
+
+    /// Main thread, after World::Update: captures generated chunks around the player; no-op unless enabled
+    static void Update(enigma::voxel::World& world, const Vec3& playerPosition);
+
+    /// Stops capturing; a benchmark already queued finishes when TaskScheduler::Shutdown() drains
+    static void Shutdown();
+
+    static const TerrainMeshingBenchmarkSettings& GetSettings() { return s_settings; }
+
+private:
+    static void Capture(enigma::voxel::Chunk* chunk, int32_t chunkX, int32_t chunkY);
+    static void Run();
+
+    static TerrainMeshingBenchmarkSettings s_settings;
+};
@@ -0,0 +1,286 @@
+/**
+ * @file TerrainSectionMeshCache.cpp
+ * @brief Section mesh deduplication and trivial section skips
+ * @date 2026-10-16
+ */
+
+#include "TerrainSectionMeshCache.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "Engine/Core/Yaml.hpp"
+
+using namespace enigma::core;
+
+TerrainSectionMeshCacheSettings TerrainSectionMeshCache::s_settings;
+
+namespace
+{
+    uint64_t MixContentLane(uint64_t value)
+    {
+        value ^= value >> 33;
+        value *= 0xFF51AFD7ED558CCDull;
+        value ^= value >> 33;
+        value *= 0xC4CEB9FE1A85EC53ull;
+        value ^= value >> 33;
+        return value;
+    }
+
+    struct CacheEntry
+    {
+        TerrainContentKey            key;
+        std::vector<TerrainMeshQuad> quads; // z relative to the section base
+        TerrainMeshStats             stats;
+    };
+
+    using EntryList = std::list<CacheEntry>; // Most recently used first
+
+    // s_mutex guards the entries and the quad count
+    std::mutex                                                          s_mutex;
+    EntryList                                                           s_entries;
+    std::unordered_map<TerrainContentKey, EntryList::iterator, TerrainContentKeyHash> s_index;
+    uint64_t                                                                          s_cachedQuads = 0;
+
+    std::atomic<uint64_t> s_cacheHits{0};
+    std::atomic<uint64_t> s_cacheMisses{0};
+    std::atomic<uint64_t> s_skippedEmpty{0};
+    std::atomic<uint64_t> s_skippedEnclosed{0};
+    std::atomic<uint64_t> s_evictions{0};
+
+    uint64_t GetEntryCost(const CacheEntry& entry)
+    {
+        return std::max<uint64_t>(entry.quads.size(), 1);
+    }
+
+    uint64_t MakeCellWord(const TerrainMeshingVolume& volume, int32_t x, int32_t y, int32_t z)
+    {
+        return static_cast<uint64_t>(volume.GetMaterial(x, y, z)) | static_cast<uint64_t>(volume.GetClass(x, y, z)) << 16 | static_cast<uint64_t>(volume.GetLight(x, y, z)) << 24;
+    }
+
+    bool IsSlabOpaque(const TerrainMeshingVolume& volume, int32_t z)
+    {
+        for (int32_t y = 0; y < volume.sizeY; ++y)
+        {
+            for (int32_t x = 0; x < volume.sizeX; ++x)
+            {
+                if (volume.GetClass(x, y, z) != TerrainMeshCellClass::OpaqueCube)
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    /// All air or enclosed, from the section cells first; Meshed when neither applies
+    TerrainSectionBuildResult ClassifySection(const TerrainMeshingVolume& volume, int32_t zBegin, int32_t zEnd, bool neighborEdgesOpaque)
+    {
+        bool anySolid  = false;
+        bool allOpaque = true;
+        for (int32_t z = zBegin; z < zEnd && (allOpaque || !anySolid); ++z)
+        {
+            for (int32_t y = 0; y < volume.sizeY; ++y)
+            {
+                for (int32_t x = 0; x < volume.sizeX; ++x)
+                {
+                    const TerrainMeshCellClass cellClass = volume.GetClass(x, y, z);
+                    anySolid |= cellClass != TerrainMeshCellClass::Empty;
+                    allOpaque &= cellClass == TerrainMeshCellClass::OpaqueCube;
+                }
+            }
+        }
+
+        if (!anySolid)
+            return TerrainSectionBuildResult::SkippedEmpty;
+        if (allOpaque && neighborEdgesOpaque && IsSlabOpaque(volume, zBegin - 1) && IsSlabOpaque(volume, zEnd))
+            return TerrainSectionBuildResult::SkippedEnclosed;
+        return TerrainSectionBuildResult::Meshed;
+    }
+
+    TerrainContentKey HashSection(const TerrainMeshingVolume& volume, int32_t zBegin, int32_t zEnd, bool greedy)
+    {
+        TerrainContentHasher hasher;
+        hasher.Add(static_cast<uint64_t>(static_cast<uint32_t>(volume.sizeX)) | static_cast<uint64_t>(static_cast<uint32_t>(volume.sizeY)) << 32);
+        hasher.Add(static_cast<uint64_t>(zEnd - zBegin) | static_cast<uint64_t>(greedy ? 1 : 0) << 32 | static_cast<uint64_t>(GreedyTerrainMesher::GetSettings().maxQuadExtent) << 40);
+
+        // Slabs outside the volume read as air with full sky light, the same words as real air
+        for (int32_t z = zBegin - 1; z <= zEnd; ++z)
+        {
+            for (int32_t y = 0; y < volume.sizeY; ++y)
+            {
+                for (int32_t x = 0; x < volume.sizeX; x += 2)
+                    hasher.Add(MakeCellWord(volume, x, y, z) | MakeCellWord(volume, x + 1, y, z) << 32);
+            }
+        }
+        return hasher.Finish();
+    }
+
+    void AddStats(TerrainMeshStats& total, const TerrainMeshStats& stats)
+    {
+        for (int layer = 0; layer < static_cast<int>(TerrainMeshLayer::Count); ++layer)
+        {
+            total.faces[layer] += stats.faces[layer];
+            total.quads[layer] += stats.quads[layer];
+        }
+        total.otherFaces += stats.otherFaces;
+    }
+
+    void EvictLocked(uint64_t maxCachedQuads)
+    {
+        while (s_cachedQuads > maxCachedQuads && !s_entries.empty())
+        {
+            const CacheEntry& oldest = s_entries.back();
+            s_cachedQuads -= GetEntryCost(oldest);
+            s_index.erase(oldest.key);
+            s_entries.pop_back();
+            s_evictions.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void TerrainContentHasher::Add(uint64_t word)
+{
+    m_low  = (m_low ^ word) * 0x9E3779B97F4A7C15ull;
+    m_low ^= m_low >> 32;
+    m_high = ((m_high << 27 | m_high >> 37) ^ word) * 0xC2B2AE3D27D4EB4Full;
+    m_high ^= m_high >> 29;
+}
+
+// ------------------------------------------------------------------------------------------------
+TerrainContentKey TerrainContentHasher::Finish() const
+{
+    return {MixContentLane(m_low), MixContentLane(m_high)};
+}
+
+// ------------------------------------------------------------------------------------------------
+void TerrainSectionMeshCache::LoadSettings(const YamlConfiguration& config)
+{
+    s_settings.enabled        = config.GetBoolean("terrainMeshing.sectionCache.enabled", s_settings.enabled);
+    s_settings.maxCachedQuads = static_cast<uint32_t>(std::max(config.GetInt("terrainMeshing.sectionCache.maxCachedQuads", static_cast<int>(s_settings.maxCachedQuads)), 1));
+}
+
+// ------------------------------------------------------------------------------------------------
+TerrainSectionMeshCacheStats TerrainSectionMeshCache::GetStats()
+{
+    TerrainSectionMeshCacheStats stats;
+    stats.cacheHits       = s_cacheHits.load(std::memory_order_relaxed);
+    stats.cacheMisses     = s_cacheMisses.load(std::memory_order_relaxed);
+    stats.skippedEmpty    = s_skippedEmpty.load(std::memory_order_relaxed);
+    stats.skippedEnclosed = s_skippedEnclosed.load(std::memory_order_relaxed);
+    stats.evictions       = s_evictions.load(std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    stats.entries     = static_cast<uint32_t>(s_entries.size());
+    stats.cachedQuads = static_cast<uint32_t>(s_cachedQuads);
+    return stats;
+}
+
+// ------------------------------------------------------------------------------------------------
+TerrainSectionBuildResult TerrainSectionMeshCache::BuildSectionQuads(const TerrainMeshingVolume& volume, int32_t zBegin, int32_t zEnd, bool greedy, bool neighborEdgesOpaque,
+                                                                     std::vector<TerrainMeshQuad>& outQuads, TerrainMeshStats* outStats)
+{
+    if (!s_settings.enabled)
+    {
+        zBegin = std::clamp(zBegin, 0, volume.sizeZ);
+        zEnd   = std::clamp(zEnd, zBegin, volume.sizeZ);
+        GreedyTerrainMesher::BuildQuads(volume, zBegin, zEnd, greedy, outQuads, outStats);
+        return TerrainSectionBuildResult::Meshed;
+    }
+    return BuildSectionQuadsCached(volume, zBegin, zEnd, greedy, neighborEdgesOpaque, outQuads, outStats);
+}
+
+// ------------------------------------------------------------------------------------------------
+TerrainSectionBuildResult TerrainSectionMeshCache::BuildSectionQuadsCached(const TerrainMeshingVolume& volume, int32_t zBegin, int32_t zEnd, bool greedy, bool neighborEdgesOpaque,
+                                                                           std::vector<TerrainMeshQuad>& outQuads, TerrainMeshStats* outStats)
+{
+    zBegin = std::clamp(zBegin, 0, volume.sizeZ);
+    zEnd   = std::clamp(zEnd, zBegin, volume.sizeZ);
+
+    // [STEP 1] Trivial skips
+    const TerrainSectionBuildResult trivial = ClassifySection(volume, zBegin, zEnd, neighborEdgesOpaque);
+    if (trivial != TerrainSectionBuildResult::Meshed)
+    {
+        (trivial == TerrainSectionBuildResult::SkippedEmpty ? s_skippedEmpty : s_skippedEnclosed).fetch_add(1, std::memory_order_relaxed);
+        if (outStats)
+            *outStats = TerrainMeshStats();
+        return trivial;
+    }
+
+    // [STEP 2] Hit: copy the cached quads onto this section's base
+    const TerrainContentKey key = HashSection(volume, zBegin, zEnd, greedy);
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        auto                        found = s_index.find(key);
+        if (found != s_index.end())
+        {
+            s_entries.splice(s_entries.begin(), s_entries, found->second);
+            const CacheEntry& entry = *found->second;
+            const size_t      first = outQuads.size();
+            outQuads.insert(outQuads.end(), entry.quads.begin(), entry.quads.end());
+            for (size_t i = first; i < outQuads.size(); ++i)
+                outQuads[i].z = static_cast<int16_t>(outQuads[i].z + zBegin);
+            if (outStats)
+                *outStats = entry.stats;
+            s_cacheHits.fetch_add(1, std::memory_order_relaxed);
+            return TerrainSectionBuildResult::CacheHit;
+        }
+    }
+
+    // [STEP 3] Miss: mesh outside the lock, then store relative to the base
+    const size_t first = outQuads.size();
+    CacheEntry   entry;
+    entry.key = key;
+    GreedyTerrainMesher::BuildQuads(volume, zBegin, zEnd, greedy, outQuads, &entry.stats);
+    entry.quads.assign(outQuads.begin() + first, outQuads.end());
+    for (TerrainMeshQuad& quad : entry.quads)
+        quad.z = static_cast<int16_t>(quad.z - zBegin);
+    if (outStats)
+        *outStats = entry.stats;
+    s_cacheMisses.fetch_add(1, std::memory_order_relaxed);
+
+    const uint64_t cost = GetEntryCost(entry);
+    if (cost > s_settings.maxCachedQuads)
+        return TerrainSectionBuildResult::Meshed;
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (s_index.find(key) != s_index.end())
+        return TerrainSectionBuildResult::Meshed; // Another worker stored the same section meanwhile
+    s_entries.push_front(std::move(entry));
+    s_index.emplace(key, s_entries.begin());
+    s_cachedQuads += cost;
+    EvictLocked(s_settings.maxCachedQuads);
+    return TerrainSectionBuildResult::Meshed;
+}
+
+// ------------------------------------------------------------------------------------------------
+void TerrainSectionMeshCache::BuildChunkQuads(const TerrainMeshingVolume& volume, int32_t sectionSize, bool greedy, std::vector<TerrainMeshQuad>& outQuads, TerrainMeshStats* outStats)
+{
+    sectionSize = std::max(sectionSize, 1);
+    TerrainMeshStats total;
+    for (int32_t zBegin = 0; zBegin < volume.sizeZ; zBegin += sectionSize)
+    {
+        TerrainMeshStats stats;
+        BuildSectionQuads(volume, zBegin, std::min(zBegin + sectionSize, volume.sizeZ), greedy, false, outQuads, &stats);
+        AddStats(total, stats);
+    }
+    if (outStats)
+        *outStats = total;
+}
+
+// ------------------------------------------------------------------------------------------------
+void TerrainSectionMeshCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_index.clear();
+    s_entries.clear();
+    s_cachedQuads = 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+void TerrainSectionMeshCache::Shutdown()
+{
+    Clear();
+}
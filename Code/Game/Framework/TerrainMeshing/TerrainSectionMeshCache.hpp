@@ -0,0 +1,130 @@
+/**
+ * @file TerrainSectionMeshCache.hpp
+ * @brief Deduplication of section mesh builds by content hash, and trivial skips of empty / enclosed sections
+ * @date 2026-10-16
+ *
+ * Flat worlds, ocean floors and the air above the terrain produce many sections whose blocks and
+ * neighbour borders are byte-identical. Each of them used to be meshed from scratch, although its
+ * quads only differ by the section's position.
+ *
+ * BuildSectionQuads() meshes one section (cells with z in [zBegin, zEnd)) in three steps:
+ *   1. trivial skips before any hashing or meshing:
+ *      - every cell is air: no faces at all
+ *      - every cell, the slabs above and below, and the neighbour chunks' cells across the volume's
+ *        X / Y edges are opaque cubes: every face is hidden. The volume stops at the chunk edge, so
+ *        the caller, which has the neighbour chunks, reports the last condition as neighborEdgesOpaque
+ *   2. a 128-bit hash over everything the mesher reads for the section: material, class and light of
+ *      the section cells plus the one-block slabs above and below it, the volume footprint, the
+ *      section height, the greedy flag and maxQuadExtent. X / Y neighbours outside the volume are
+ *      constant (air, full sky light) and covered by the footprint
+ *   3. on a hit the cached quads are appended with z moved to the section base; on a miss the section
+ *      is meshed with GreedyTerrainMesher::BuildQuads() and its quads are stored relative to the base
+ * Quads are chunk local, so a hit from another chunk needs no X / Y translation.
+ *
+ * The cache is bounded by the number of quads it holds and evicts least recently used sections.
+ *
+ * Callers: TerrainMeshingBenchmark meshes its generated corpus through BuildSectionQuadsCached(), with
+ * neighbourEdgesOpaque taken from the adjacent corpus chunks, and reports hits, skips and time against
+ * direct per-section meshing. The content hash (TerrainContentHasher) also keys the meshes the game
+ * builds itself: DistantTerrainLod shares one GPU mesh between regions with identical samples.
+ *
+ * Full-detail sections are meshed by the engine's async chunk mesh workers, which take no per-section
+ * hook from the game, so BuildSectionQuads() is not on their path and AsyncChunkMeshCounters (engine
+ * code) cannot carry the hits and skips. They are counted here and shown next to those counters in the
+ * queue diagnostics panel.
+ *
+ * Thread safety: BuildSectionQuads() is called from mesh workers concurrently.
+ *
+ * Configuration Path: Run/.enigma/settings.yml -> terrainMeshing.sectionCache
+ */
+
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Core/Yaml.hpp"
+#include "GreedyTerrainMesher.hpp"
+
+enum class TerrainSectionBuildResult : uint8_t
+{
+    Meshed = 0,      // Cache miss (or cache disabled), built by the mesher
+    CacheHit,
+    SkippedEmpty,    // All air
+    SkippedEnclosed  // All opaque cubes surrounded by opaque cubes
+};
+
+/// 128-bit content key; a false match would serve another mesh, so 64 bits alone are not enough
+struct TerrainContentKey
+{
+    uint64_t low  = 0;
+    uint64_t high = 0;
+
+    bool operator==(const TerrainContentKey& other) const { return low == other.low && high == other.high; }
+};
+
+struct TerrainContentKeyHash
+{
+    size_t operator()(const TerrainContentKey& key) const { return static_cast<size_t>(key.low); }
+};
+
+/// Two independently seeded 64-bit lanes over the words of a content snapshot
+class TerrainContentHasher
+{
+public:
+    void              Add(uint64_t word);
+    TerrainContentKey Finish() const;
+
+private:
+    uint64_t m_low  = 0x243F6A8885A308D3ull;
+    uint64_t m_high = 0x13198A2E03707344ull;
+};
+
+struct TerrainSectionMeshCacheSettings
+{
+    bool     enabled        = false;
+    uint32_t maxCachedQuads = 1u << 20; // 16 bytes each; a section without quads counts as one
+};
+
+struct TerrainSectionMeshCacheStats
+{
+    uint64_t cacheHits       = 0;
+    uint64_t cacheMisses     = 0;
+    uint64_t skippedEmpty    = 0;
+    uint64_t skippedEnclosed = 0;
+    uint64_t evictions       = 0;
+    uint32_t entries         = 0;
+    uint32_t cachedQuads     = 0;
+};
+
+class TerrainSectionMeshCache
+{
+public:
+    TerrainSectionMeshCache()                                          = delete; // Prevent instantiation
+    TerrainSectionMeshCache(const TerrainSectionMeshCache&)            = delete; // Prevent copy
+    TerrainSectionMeshCache& operator=(const TerrainSectionMeshCache&) = delete; // Prevent assignment
+
+    static void                                   LoadSettings(const enigma::core::YamlConfiguration& config);
+    static const TerrainSectionMeshCacheSettings& GetSettings() { return s_settings; }
+    static TerrainSectionMeshCacheStats           GetStats();
+
+    /// Appends the quads of one section; outStats receives that section's mesh statistics.
+    /// neighborEdgesOpaque: every cell of the neighbour chunks bordering this section is an opaque cube.
+    /// With the cache disabled this is GreedyTerrainMesher::BuildQuads() on the range.
+    static TerrainSectionBuildResult BuildSectionQuads(const TerrainMeshingVolume& volume, int32_t zBegin, int32_t zEnd, bool greedy, bool neighborEdgesOpaque,
+                                                       std::vector<TerrainMeshQuad>& outQuads, TerrainMeshStats* outStats = nullptr);
+
+    /// BuildSectionQuads() with the cache and skips applied whatever GetSettings().enabled says
+    static TerrainSectionBuildResult BuildSectionQuadsCached(const TerrainMeshingVolume& volume, int32_t zBegin, int32_t zEnd, bool greedy, bool neighborEdgesOpaque,
+                                                             std::vector<TerrainMeshQuad>& outQuads, TerrainMeshStats* outStats = nullptr);
+
+    /// Whole volume, one section of sectionSize blocks at a time (neighbour edges treated as open);
+    /// statistics are summed
+    static void BuildChunkQuads(const TerrainMeshingVolume& volume, int32_t sectionSize, bool greedy, std::vector<TerrainMeshQuad>& outQuads, TerrainMeshStats* outStats = nullptr);
+
+    /// Drop every entry, e.g. after the block registry reassigned material ids
+    static void Clear();
+    static void Shutdown();
+
+private:
+    static TerrainSectionMeshCacheSettings s_settings;
+};
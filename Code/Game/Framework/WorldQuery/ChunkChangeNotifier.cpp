@@ -0,0 +1,63 @@
+/**
+ * @file ChunkChangeNotifier.cpp
+ * @brief Shared chunk change ring implementation
+ * @date 2026-10-16
+ */
+
+#include "ChunkChangeNotifier.hpp"
+
+#include <array>
+#include <mutex>
+
+#include "Engine/Voxel/Chunk/Chunk.hpp"
+
+using enigma::voxel::Chunk;
+
+namespace
+{
+    struct ChunkNotification
+    {
+        int32_t chunkX = 0;
+        int32_t chunkY = 0;
+    };
+
+    std::mutex                                                    s_mutex;
+    std::array<ChunkNotification, ChunkChangeNotifier::RING_SIZE> s_ring;
+    uint64_t                                                      s_serial = 0;
+
+    int32_t FloorDiv(int32_t value, int32_t divisor)
+    {
+        return value >= 0 ? value / divisor : -((-value + divisor - 1) / divisor);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void ChunkChangeNotifier::NotifyChunkChanged(int32_t chunkX, int32_t chunkY)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    ++s_serial;
+    s_ring[s_serial % RING_SIZE] = {chunkX, chunkY};
+}
+
+// ------------------------------------------------------------------------------------------------
+void ChunkChangeNotifier::NotifyBlockChanged(int32_t blockX, int32_t blockY)
+{
+    NotifyChunkChanged(FloorDiv(blockX, Chunk::CHUNK_SIZE_X), FloorDiv(blockY, Chunk::CHUNK_SIZE_Y));
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ChunkChangeNotifier::Consume(uint64_t& cursor, const std::function<void(int32_t chunkX, int32_t chunkY)>& onChanged)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    const bool complete = s_serial - cursor <= RING_SIZE;
+    if (complete)
+    {
+        for (uint64_t serial = cursor + 1; serial <= s_serial; ++serial)
+        {
+            const ChunkNotification& notification = s_ring[serial % RING_SIZE];
+            onChanged(notification.chunkX, notification.chunkY);
+        }
+    }
+    cursor = s_serial;
+    return complete;
+}
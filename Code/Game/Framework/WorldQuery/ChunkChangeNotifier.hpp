@@ -0,0 +1,41 @@
+/**
+ * @file ChunkChangeNotifier.hpp
+ * @brief Bounded ring of "blocks of a loaded chunk changed" events for the caches derived from block data
+ * @date 2026-10-16
+ *
+ * Whoever changes blocks of a loaded chunk (block edits through World::SetBlockState, SimpleMinerGenerator
+ * on generation or generated chunk cache load) posts one NotifyChunkChanged(). Subscribers keep their own
+ * cursor into the shared ring and drain it with Consume() when they next update, so producers do not
+ * need to know who caches what. Subscribers: PlayerNeighborhoodCache (light summaries) and
+ * ChunkOcclusionCuller (occluder boxes).
+ *
+ * A subscriber that falls more than RING_SIZE events behind cannot tell which chunks changed and
+ * has to drop everything it derived.
+ *
+ * Threading: NotifyChunkChanged() may be called from any thread. Consume() runs the callback under
+ * the ring lock, so callbacks must not post notifications.
+ */
+
+#pragma once
+#include <cstdint>
+#include <functional>
+
+class ChunkChangeNotifier
+{
+public:
+    ChunkChangeNotifier()                                      = delete; // Prevent instantiation
+    ChunkChangeNotifier(const ChunkChangeNotifier&)            = delete; // Prevent copy
+    ChunkChangeNotifier& operator=(const ChunkChangeNotifier&) = delete; // Prevent assignment
+
+    static constexpr uint64_t RING_SIZE = 1024;
+
+    /// Blocks of a loaded chunk changed. Callable from any thread.
+    static void NotifyChunkChanged(int32_t chunkX, int32_t chunkY);
+
+    /// NotifyChunkChanged() for the chunk holding block column (blockX, blockY)
+    static void NotifyBlockChanged(int32_t blockX, int32_t blockY);
+
+    /// Calls onChanged for every event posted after cursor and advances cursor past them. Returns false,
+    /// without calling onChanged, when some of those events were already overwritten.
+    static bool Consume(uint64_t& cursor, const std::function<void(int32_t chunkX, int32_t chunkY)>& onChanged);
+};
@@ -0,0 +1,302 @@
+/**
+ * @file PlayerNeighborhoodCache.cpp
+ * @brief Pinned chunk view around the player implementation
+ * @date 2026-10-16
+ */
+
+#include "PlayerNeighborhoodCache.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+
+#include "Engine/Core/Yaml.hpp"
+#include "Engine/Voxel/Block/BlockPos.hpp"
+#include "Engine/Voxel/Chunk/Chunk.hpp"
+#include "Engine/Voxel/World/World.hpp"
+#include "Game/Framework/WorldQuery/ChunkChangeNotifier.hpp"
+
+using namespace enigma::core;
+using enigma::voxel::BlockState;
+using enigma::voxel::Chunk;
+
+PlayerNeighborhoodSettings PlayerNeighborhoodCache::s_settings;
+
+namespace
+{
+    constexpr uint8_t TRAIT_EMISSION_MASK = 0x0F;
+    constexpr uint8_t TRAIT_SKY_BLOCKING  = 0x10;
+    constexpr uint8_t TRAIT_FLUID         = 0x20;
+    constexpr int32_t MAX_LIGHT           = 15;
+
+    /// Light level of emissive blocks by registry path (namespace stripped)
+    uint8_t GetEmissionByName(const std::string& path)
+    {
+        struct EmissiveBlock
+        {
+            const char* path;
+            uint8_t     level;
+        };
+        static constexpr EmissiveBlock EMISSIVE_BLOCKS[] = {
+            {"glowstone", 15}, {"lava", 15}, {"sea_lantern", 15}, {"jack_o_lantern", 15}, {"lantern", 15},
+            {"fire", 15}, {"torch", 14}, {"redstone_torch", 7}, {"magma_block", 3},
+        };
+        for (const EmissiveBlock& block : EMISSIVE_BLOCKS)
+        {
+            if (path == block.path)
+                return block.level;
+        }
+        return 0;
+    }
+
+    /// Floor division, so negative block coordinates map to the chunk below zero
+    int32_t FloorDiv(int32_t value, int32_t divisor)
+    {
+        const int32_t quotient = value / divisor;
+        return (value % divisor != 0 && (value < 0) != (divisor < 0)) ? quotient - 1 : quotient;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void PlayerNeighborhoodCache::LoadSettings(const YamlConfiguration& config)
+{
+    s_settings.eyeBrightnessHalfLife = config.GetFloat("playerNeighborhood.eyeBrightnessHalfLife", s_settings.eyeBrightnessHalfLife);
+
+    s_settings.eyeBrightnessHalfLife = (std::max)(s_settings.eyeBrightnessHalfLife, 0.0f);
+}
+
+// ------------------------------------------------------------------------------------------------
+void PlayerNeighborhoodCache::Update(enigma::voxel::World& world, const Vec3& position)
+{
+    m_world = &world;
+
+    const int32_t centerX = FloorDiv(static_cast<int32_t>(std::floor(position.x)), Chunk::CHUNK_SIZE_X);
+    const int32_t centerY = FloorDiv(static_cast<int32_t>(std::floor(position.y)), Chunk::CHUNK_SIZE_Y);
+
+    // [STEP 1] Re-pin the window; slots whose chunk is unchanged keep their summary
+    std::array<Slot, 9> slots;
+    for (int32_t i = 0; i < WINDOW_SIZE * WINDOW_SIZE; ++i)
+    {
+        Slot& slot  = slots[i];
+        slot.chunkX = centerX + i % WINDOW_SIZE - 1;
+        slot.chunkY = centerY + i / WINDOW_SIZE - 1;
+        slot.chunk  = world.GetChunk(slot.chunkX, slot.chunkY);
+        if (slot.chunk && !slot.chunk->IsGenerated())
+            slot.chunk = nullptr;
+
+        Slot* previous = m_hasCenter ? FindSlot(slot.chunkX, slot.chunkY) : nullptr;
+        if (previous && previous->chunk == slot.chunk)
+        {
+            slot = std::move(*previous);
+            continue;
+        }
+        if (slot.chunk)
+            ++m_stats.repins;
+        m_lightValid = false;
+    }
+    m_slots     = std::move(slots);
+    m_centerX   = centerX;
+    m_centerY   = centerY;
+    m_hasCenter = true;
+
+    // [STEP 2] Apply change notifications posted since the last frame; falling behind the ring drops every summary
+    const bool complete = ChunkChangeNotifier::Consume(m_seenSerial, [this](int32_t chunkX, int32_t chunkY)
+    {
+        Slot* slot = FindSlot(chunkX, chunkY);
+        if (slot && slot->summaryValid)
+        {
+            slot->summaryValid = false;
+            ++m_stats.invalidations;
+            m_lightValid = false;
+        }
+    });
+    if (!complete)
+    {
+        for (Slot& slot : m_slots)
+        {
+            if (slot.summaryValid)
+            {
+                slot.summaryValid = false;
+                ++m_stats.invalidations;
+            }
+        }
+        m_lightValid = false;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+BlockState* PlayerNeighborhoodCache::GetBlockState(int32_t x, int32_t y, int32_t z)
+{
+    if (z < 0 || z >= Chunk::CHUNK_SIZE_Z)
+        return nullptr;
+
+    int32_t localX = 0;
+    int32_t localY = 0;
+    Slot*   slot   = FindSlotForBlock(x, y, localX, localY);
+    if (slot && slot->chunk)
+    {
+        ++m_stats.pinnedLookups;
+        return slot->chunk->GetBlock(localX, localY, z);
+    }
+
+    ++m_stats.fallbackLookups;
+    return m_world ? m_world->GetBlockState(enigma::voxel::BlockPos(x, y, z)) : nullptr;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool PlayerNeighborhoodCache::IsFluid(int32_t x, int32_t y, int32_t z)
+{
+    return (GetTraits(GetBlockState(x, y, z)) & TRAIT_FLUID) != 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+int32_t PlayerNeighborhoodCache::GetSkyBlockingHeight(int32_t x, int32_t y)
+{
+    int32_t localX = 0;
+    int32_t localY = 0;
+    Slot*   slot   = FindSlotForBlock(x, y, localX, localY);
+    if (!slot || !slot->chunk)
+        return -1;
+
+    if (!slot->summaryValid)
+        BuildSummary(*slot);
+    return slot->skyHeight[localX + localY * Chunk::CHUNK_SIZE_X];
+}
+
+// ------------------------------------------------------------------------------------------------
+LightSample PlayerNeighborhoodCache::SampleLight(int32_t x, int32_t y, int32_t z)
+{
+    ++m_stats.lightSamples;
+    if (m_lightValid && m_lightX == x && m_lightY == y && m_lightZ == z)
+    {
+        ++m_stats.lightReused;
+        return m_light;
+    }
+
+    for (Slot& slot : m_slots)
+    {
+        if (slot.chunk && !slot.summaryValid)
+            BuildSummary(slot);
+    }
+
+    LightSample sample;
+
+    // [STEP 1] Sky light: nearest column open above z, one level per block of horizontal distance
+    int32_t skyLight = 0;
+    if (z >= Chunk::CHUNK_SIZE_Z)
+    {
+        skyLight = MAX_LIGHT;
+    }
+    for (int32_t distance = 0; distance < MAX_LIGHT && skyLight < MAX_LIGHT - distance; ++distance)
+    {
+        for (int32_t dx = -distance; dx <= distance && skyLight < MAX_LIGHT - distance; ++dx)
+        {
+            const int32_t dy = distance - std::abs(dx);
+            if (IsSkyVisible(x + dx, y + dy, z) || (dy != 0 && IsSkyVisible(x + dx, y - dy, z)))
+                skyLight = MAX_LIGHT - distance;
+        }
+    }
+    sample.skyLight = static_cast<uint8_t>(skyLight);
+
+    // [STEP 2] Block light: strongest emitter after Manhattan falloff
+    int32_t blockLight = 0;
+    for (const Slot& slot : m_slots)
+    {
+        for (const Emitter& emitter : slot.emitters)
+        {
+            const int32_t distance = std::abs(emitter.x - x) + std::abs(emitter.y - y) + std::abs(emitter.z - z);
+            blockLight             = (std::max)(blockLight, static_cast<int32_t>(emitter.level) - distance);
+        }
+    }
+    sample.blockLight = static_cast<uint8_t>(blockLight);
+
+    m_light      = sample;
+    m_lightX     = x;
+    m_lightY     = y;
+    m_lightZ     = z;
+    m_lightValid = true;
+    return sample;
+}
+
+// ------------------------------------------------------------------------------------------------
+PlayerNeighborhoodCache::Slot* PlayerNeighborhoodCache::FindSlot(int32_t chunkX, int32_t chunkY)
+{
+    const int32_t dx = chunkX - m_centerX + 1;
+    const int32_t dy = chunkY - m_centerY + 1;
+    if (!m_hasCenter || dx < 0 || dx >= WINDOW_SIZE || dy < 0 || dy >= WINDOW_SIZE)
+        return nullptr;
+    return &m_slots[dx + dy * WINDOW_SIZE];
+}
+
+// ------------------------------------------------------------------------------------------------
+PlayerNeighborhoodCache::Slot* PlayerNeighborhoodCache::FindSlotForBlock(int32_t x, int32_t y, int32_t& localX, int32_t& localY)
+{
+    const int32_t chunkX = FloorDiv(x, Chunk::CHUNK_SIZE_X);
+    const int32_t chunkY = FloorDiv(y, Chunk::CHUNK_SIZE_Y);
+    localX               = x - chunkX * Chunk::CHUNK_SIZE_X;
+    localY               = y - chunkY * Chunk::CHUNK_SIZE_Y;
+    return FindSlot(chunkX, chunkY);
+}
+
+// ------------------------------------------------------------------------------------------------
+void PlayerNeighborhoodCache::BuildSummary(Slot& slot)
+{
+    slot.skyHeight.assign(static_cast<size_t>(Chunk::CHUNK_SIZE_X) * Chunk::CHUNK_SIZE_Y, -1);
+    slot.emitters.clear();
+
+    // Neighbouring blocks are mostly the same state, so the traits lookup is skipped for runs
+    BlockState* lastState  = nullptr;
+    uint8_t     lastTraits = 0;
+    for (int32_t z = 0; z < Chunk::CHUNK_SIZE_Z; ++z)
+    {
+        for (int32_t y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+        {
+            for (int32_t x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+            {
+                BlockState* state = slot.chunk->GetBlock(x, y, z);
+                if (state != lastState)
+                {
+                    lastState  = state;
+                    lastTraits = GetTraits(state);
+                }
+                if (lastTraits & TRAIT_SKY_BLOCKING)
+                    slot.skyHeight[x + y * Chunk::CHUNK_SIZE_X] = static_cast<int16_t>(z);
+                if (lastTraits & TRAIT_EMISSION_MASK)
+                {
+                    slot.emitters.push_back({slot.chunkX * Chunk::CHUNK_SIZE_X + x, slot.chunkY * Chunk::CHUNK_SIZE_Y + y, z,
+                                             static_cast<uint8_t>(lastTraits & TRAIT_EMISSION_MASK)});
+                }
+            }
+        }
+    }
+    slot.summaryValid = true;
+    ++m_stats.summaryBuilds;
+}
+
+// ------------------------------------------------------------------------------------------------
+uint8_t PlayerNeighborhoodCache::GetTraits(BlockState* state)
+{
+    if (!state)
+        return 0;
+
+    auto it = m_traits.find(state);
+    if (it != m_traits.end())
+        return it->second;
+
+    std::string  path  = state->GetBlock()->GetRegistryName();
+    const size_t colon = path.find(':');
+    if (colon != std::string::npos)
+        path = path.substr(colon + 1);
+
+    uint8_t traits = 0;
+    if (path != "air")
+    {
+        // Fluids let the sky through; everything else solid enough to be a block blocks it
+        const bool fluid = !state->GetFluidState().IsEmpty();
+        traits           = fluid ? TRAIT_FLUID : TRAIT_SKY_BLOCKING;
+        traits |= GetEmissionByName(path);
+    }
+    m_traits.emplace(state, traits);
+    return traits;
+}
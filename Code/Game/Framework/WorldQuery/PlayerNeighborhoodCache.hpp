@@ -0,0 +1,135 @@
+/**
+ * @file PlayerNeighborhoodCache.hpp
+ * @brief Pinned 3x3 chunk view around the player for cheap per-frame block, fluid and light queries
+ * @date 2026-10-16
+ *
+ * Per-frame gameplay queries (eye in water, eye brightness, rain occlusion, collision) used to go
+ * through World::GetBlockState and its full chunk lookup for every sample. The cache pins the chunk
+ * the player stands in and its 8 neighbours once per frame; queries inside that window index the
+ * pinned chunk's block array directly. Chunks are full-height columns, so the "3x3x3" neighbourhood
+ * of a sectioned world is a 3x3 column window here and covers every height.
+ *
+ * For light, each pinned chunk gets a lazily built summary: the highest sky-blocking block per column
+ * and the list of light-emitting blocks. The engine does not expose its light values to the game, so
+ * SampleLight() estimates them from the summaries:
+ *   - sky light is 15 where the column is open above the position and drops by one per block of
+ *     horizontal (Manhattan) distance to the nearest open column
+ *   - block light is the strongest emitter level minus its Manhattan distance
+ * Walls between the position and a source are not considered.
+ *
+ * Invalidation: the cache subscribes to ChunkChangeNotifier and drops the summaries of notified chunks
+ * on its next Update(). A pinned chunk whose pointer changes (unloaded and reloaded) is detected by the
+ * per-frame re-pin. Block arrays are read directly, so block queries never need invalidation, only the
+ * derived summaries do.
+ *
+ * Configuration Path: Run/.enigma/settings.yml -> playerNeighborhood
+ */
+
+#pragma once
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Engine/Core/Yaml.hpp"
+#include "Engine/Math/Vec3.hpp"
+
+namespace enigma::voxel
+{
+    class Chunk;
+    class World;
+    class BlockState;
+}
+
+struct LightSample
+{
+    uint8_t blockLight = 0;  // 0-15
+    uint8_t skyLight   = 15; // 0-15, before the time of day multiplier
+};
+
+struct PlayerNeighborhoodSettings
+{
+    float eyeBrightnessHalfLife = 10.0f; // Seconds for eyeBrightnessSmooth to close half the gap to eyeBrightness
+};
+
+struct PlayerNeighborhoodStats
+{
+    uint64_t pinnedLookups   = 0; // Block queries answered from a pinned chunk
+    uint64_t fallbackLookups = 0; // Block queries outside the window or on a missing chunk, sent to the world
+    uint64_t repins          = 0; // Chunks (re)pinned because the window moved or the chunk pointer changed
+    uint64_t summaryBuilds   = 0;
+    uint64_t invalidations   = 0; // Summaries dropped by change notifications
+    uint64_t lightSamples    = 0;
+    uint64_t lightReused     = 0; // SampleLight calls answered by the previous result
+};
+
+class PlayerNeighborhoodCache
+{
+public:
+    static constexpr int32_t WINDOW_SIZE = 3; // Chunks per side, centered on the player's chunk
+
+    PlayerNeighborhoodCache()                                          = default;
+    PlayerNeighborhoodCache(const PlayerNeighborhoodCache&)            = delete;
+    PlayerNeighborhoodCache& operator=(const PlayerNeighborhoodCache&) = delete;
+
+    static void                              LoadSettings(const enigma::core::YamlConfiguration& config);
+    static const PlayerNeighborhoodSettings& GetSettings() { return s_settings; }
+
+    /// Once per frame before any query: re-pins the window around position and applies notifications
+    void Update(enigma::voxel::World& world, const Vec3& position);
+
+    enigma::voxel::BlockState* GetBlockState(int32_t x, int32_t y, int32_t z);
+    bool                       IsFluid(int32_t x, int32_t y, int32_t z);
+
+    /// Highest z that blocks the sky in the column, -1 if none. Columns of missing chunks count as open.
+    int32_t GetSkyBlockingHeight(int32_t x, int32_t y);
+    bool    IsSkyVisible(int32_t x, int32_t y, int32_t z) { return z > GetSkyBlockingHeight(x, y); }
+
+    /// Estimated block and sky light at a block position, see the file comment
+    LightSample SampleLight(int32_t x, int32_t y, int32_t z);
+
+    const PlayerNeighborhoodStats& GetStats() const { return m_stats; }
+
+private:
+    struct Emitter
+    {
+        int32_t x     = 0; // World block coordinates
+        int32_t y     = 0;
+        int32_t z     = 0;
+        uint8_t level = 0;
+    };
+
+    struct Slot
+    {
+        enigma::voxel::Chunk* chunk        = nullptr;
+        int32_t               chunkX       = 0;
+        int32_t               chunkY       = 0;
+        bool                  summaryValid = false;
+        std::vector<int16_t>  skyHeight; // Per column, index x + y * CHUNK_SIZE_X
+        std::vector<Emitter>  emitters;
+    };
+
+    Slot*   FindSlot(int32_t chunkX, int32_t chunkY);
+    Slot*   FindSlotForBlock(int32_t x, int32_t y, int32_t& localX, int32_t& localY);
+    void    BuildSummary(Slot& slot);
+    uint8_t GetTraits(enigma::voxel::BlockState* state);
+
+    enigma::voxel::World* m_world      = nullptr;
+    std::array<Slot, 9>   m_slots; // WINDOW_SIZE x WINDOW_SIZE, index dx + dy * WINDOW_SIZE
+    int32_t               m_centerX    = 0;
+    int32_t               m_centerY    = 0;
+    bool                  m_hasCenter  = false;
+    uint64_t              m_seenSerial = 0; // ChunkChangeNotifier cursor
+
+    std::unordered_map<const enigma::voxel::BlockState*, uint8_t> m_traits; // Sky-blocking / fluid / emission per state
+
+    bool        m_lightValid = false;
+    int32_t     m_lightX     = 0;
+    int32_t     m_lightY     = 0;
+    int32_t     m_lightZ     = 0;
+    LightSample m_light;
+
+    PlayerNeighborhoodStats m_stats;
+
+    static PlayerNeighborhoodSettings s_settings;
+};
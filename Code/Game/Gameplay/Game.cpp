@@ -1,5 +1,7 @@
 ﻿#include "Game.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/VertexUtils.hpp"
@@ -13,6 +15,8 @@
 #include "Game/Framework/RenderPass/RenderCloud/CloudRenderPass.hpp"
 #include "Game/Framework/RenderPass/RenderComposite/CompositeRenderPass.hpp"
 #include "Game/Framework/RenderPass/RenderFinal/FinalRenderPass.hpp"
+#include "Game/Framework/RenderPass/RenderPassCulling.hpp"
+#include "Game/Framework/RenderPass/RenderPassTimers.hpp"
 #include "Game/Framework/RenderPass/RenderSkyBasic/SkyBasicRenderPass.hpp"
 #include "Game/Framework/RenderPass/RenderSkyTextured/SkyTexturedRenderPass.hpp"
 #include "Game/Framework/RenderPass/RenderTerrain/TerrainRenderPass.hpp"
@@ -20,6 +24,7 @@
 #include "Game/Framework/RenderPass/RenderTerrainTranslucent/TerrainTranslucentRenderPass.hpp"
 #include "Game/SceneTest/SceneUnitTest_SpriteAtlas.hpp"
 #include "Game/SceneTest/SceneUnitTest_StencilXRay.hpp"
+#include "Game/SceneTest/SceneUnitTest_RenderGraph.hpp"
 
 // [Task 18] ImGui Integration
 #include "Engine/Core/ImGui/ImGuiSubsystem.hpp"
@@ -35,11 +40,24 @@
 #include "Game/Framework/Imgui/ImguiRenderInspection.hpp"
 #include "Game/Framework/Imgui/ImguiLeftDebugOverlay.hpp"
 #include "Game/Framework/Camera/GameCameraDebugState.hpp"
+#include "Game/Framework/ChunkStore/ChunkCodecBenchmark.hpp"
+#include "Game/Framework/ChunkStore/GeneratedChunkCache.hpp"
+#include "Game/Framework/DistantTerrain/DistantTerrainLod.hpp"
+#include "Game/Framework/OcclusionCulling/ChunkOcclusionCuller.hpp"
+#include "Game/Gameplay/Generator/ChunkGenerationPipeline.hpp"
 #include "Game/Framework/RenderPass/RenderChunkBaching/ChunkBachingRenderPass.hpp"
+#include "Game/Framework/RenderPass/RenderChunkBaching/ChunkRegionRebuildBudget.hpp"
 #include "Game/Framework/RenderPass/RenderDebug/DebugRenderPass.hpp"
+#include "Game/Framework/RenderPass/RenderDistantTerrain/DistantTerrainRenderPass.hpp"
 #include "Game/Framework/RenderPass/RenderDeferred/DeferredRenderPass.hpp"
 #include "Game/Framework/RenderPass/RenderShadow/ShadowRenderPass.hpp"
 #include "Game/Framework/RenderPass/RenderShadowComposite/ShadowCompositeRenderPass.hpp"
+#include "Game/Framework/TerrainMeshing/GreedyTerrainMesher.hpp"
+#include "Game/Framework/TerrainMeshing/TerrainFaceBuckets.hpp"
+#include "Game/Framework/TerrainMeshing/TerrainMeshingBenchmark.hpp"
+#include "Game/Framework/TerrainMeshing/TerrainSectionMeshCache.hpp"
+#include "Game/Framework/WorldQuery/ChunkChangeNotifier.hpp"
+#include "Game/Framework/WorldQuery/PlayerNeighborhoodCache.hpp"
 #include "Generator/SimpleMinerGenerator.hpp"
 #include "Generator/FlatWorldGenerator.hpp"
 #include "ThirdParty/imgui/imgui.h"
@@ -111,6 +129,7 @@ Game::Game()
     m_scene = std::make_unique<SceneUnitTest_StencilXRay>();
     //m_scene = std::make_unique<SceneUnitTest_VertexLayoutRegistration>();
     //m_scene = std::make_unique<SceneUnitTest_CustomConstantBuffer>();
+    //m_scene = std::make_unique<SceneUnitTest_RenderGraph>(); // Headless, results in the debugger output
 
     /// Render Passes (Production)
     m_shadowRenderPass             = std::make_unique<ShadowRenderPass>();
@@ -120,10 +139,12 @@ Game::Game()
     m_terrainRenderPass            = std::make_unique<TerrainRenderPass>();
     m_terrainCutoutRenderPass      = std::make_unique<TerrainCutoutRenderPass>(); // Cutout terrain (leaves, grass)
     m_terrainTranslucentRenderPass = std::make_unique<TerrainTranslucentRenderPass>(); // Translucent terrain (water)
+    m_distantTerrainRenderPass     = std::make_unique<DistantTerrainRenderPass>(); // LOD regions beyond the simulation distance
     m_cloudRenderPass              = std::make_unique<CloudRenderPass>();
     m_deferredRenderPass           = std::make_unique<DeferredRenderPass>();
     m_compositeRenderPass          = std::make_unique<CompositeRenderPass>();
     m_finalRenderPass              = std::make_unique<FinalRenderPass>();
+    m_sceneRenderGraph             = std::make_unique<SceneRenderGraph>();
 
     /// Render Passes (Debug)
     m_chunkBachingRenderPass = std::make_unique<ChunkBachingRenderPass>();
@@ -151,10 +172,31 @@ Game::Game()
     /// World Generator and World Creation
     using namespace enigma::voxel;
 
-    auto generator = std::make_unique<SimpleMinerGenerator>();
+    auto                  generator = std::make_unique<SimpleMinerGenerator>();
+    SimpleMinerGenerator* lodSource = generator.get(); // Owned by the world, DistantTerrainLod shuts down first
     //auto generator = std::make_unique<FlatWorldGenerator>();
     m_world = std::make_unique<World>("world", 6693073380, std::move(generator));
-    m_world->SetChunkActivationRange(settings.GetInt("video.simulationDistance", 8));
+    const int simulationDistance = settings.GetInt("video.simulationDistance", 8);
+    m_world->SetChunkActivationRange(simulationDistance);
+    ChunkRegionRebuildBudget::LoadSettings(settings);
+    ChunkCodecBenchmark::LoadSettings(settings);
+    GeneratedChunkCache::LoadSettings(settings);
+    ChunkGenerationPipeline::LoadSettings(settings);
+    PlayerNeighborhoodCache::LoadSettings(settings);
+    GreedyTerrainMesher::LoadSettings(settings);
+    TerrainFaceBuckets::LoadSettings(settings);
+    TerrainMeshingBenchmark::LoadSettings(settings);
+    TerrainSectionMeshCache::LoadSettings(settings);
+    ChunkOcclusionCuller::LoadSettings(settings);
+    DistantTerrainLod::LoadSettings(settings);
+    DistantTerrainLod::Startup(lodSource, simulationDistance);
+    if (auto* playerCamera = GetPlayerCamera(); playerCamera && DistantTerrainLod::IsEnabled())
+    {
+        // Full-detail terrain ends at the simulation distance, LOD regions carry the view out to their own distance.
+        // The LOD shares the scene depth buffer, so there is no separate dh far plane: every shader term that
+        // scales with far (fog, cloud and water fade distances) and the chunk culling frustum follow it.
+        playerCamera->SetNearFar(playerCamera->GetNearPlane(), std::max(playerCamera->GetFarPlane(), DistantTerrainLod::GetRenderDistanceBlocks()));
+    }
     if (g_theShaderBundleSubsystem)
     {
         g_theShaderBundleSubsystem->GetReloadCoordinator().SetWorldChunkReloadParticipant(m_world.get());
@@ -198,6 +240,10 @@ Game::~Game()
         g_theShaderBundleSubsystem->GetReloadCoordinator().SetWorldChunkReloadParticipant(nullptr);
     }
 
+    // LOD sampling tasks use the world's generator, occluder boxes point at its chunks
+    DistantTerrainLod::Shutdown();
+    ChunkOcclusionCuller::Shutdown();
+
     // Close world before cleanup
     if (m_world)
     {
@@ -205,6 +251,10 @@ Game::~Game()
         m_world->CloseWorld();
         m_world.reset();
     }
+    ChunkCodecBenchmark::Shutdown();
+    TerrainMeshingBenchmark::Shutdown();
+    TerrainSectionMeshCache::Shutdown();
+    GeneratedChunkCache::Shutdown();
 }
 
 void Game::Update()
@@ -270,6 +320,8 @@ void Game::Render()
 void Game::RenderWorld()
 {
     EnsureCommonUniformFramePartitionSeeded();
+    RenderPassTimers::BeginFrame();
+    m_skyBasicRenderPass->BeginFrame();
     if (SceneRenderPass::ShouldSuppressWorldRenderingForReload())
     {
         return;
@@ -281,37 +333,57 @@ void Game::RenderWorld()
     //
     // Order: Shadow → Sky → Opaque G-Buffer → Deferred Lighting
     //        → Translucent (water/cloud) → Composite → Final
+    // Passes are collected in order and executed through SceneRenderGraph, which
+    // inserts the depth/shadow barriers derived from each pass's DeclareResources()
     // ========================================
+    std::vector<SceneRenderPass*> passes;
+    passes.reserve(12);
+
+    // [STEP 0] Render this frame's occluders
+    if (m_world)
+    {
+        ChunkOcclusionCuller::Update(*m_world, GetChunkBatchCullingCamera());
+    }
 
     // [STEP 1] Shadow pass
-    m_shadowRenderPass->Execute();
-    m_shadowCompositeRenderPass->Execute();
+    // Skipped entirely when no program outside the shadow stage samples shadowtex/shadowcolor
+    if (RenderPassCulling::IsShadowPassEnabled())
+    {
+        passes.push_back(m_shadowRenderPass.get());
+        passes.push_back(m_shadowCompositeRenderPass.get());
+    }
 
     // [STEP 2] Sky Rendering (depth = 1.0, rendered first into G-Buffer)
-    m_skyBasicRenderPass->Execute();
-    m_skyTexturedRenderPass->Execute();
+    passes.push_back(m_skyBasicRenderPass.get());
+    passes.push_back(m_skyTexturedRenderPass.get());
 
-    // [STEP 3] Opaque G-Buffer (terrain + cutout)
+    // [STEP 3] Opaque G-Buffer (terrain + cutout, then the distant LOD regions)
     // Writes colortex0 (Albedo), colortex1 (Lightmap), colortex2 (Normal)
-    m_terrainRenderPass->Execute();
-    m_terrainCutoutRenderPass->Execute();
+    passes.push_back(m_terrainRenderPass.get());
+    passes.push_back(m_terrainCutoutRenderPass.get());
+    if (DistantTerrainLod::IsEnabled())
+    {
+        passes.push_back(m_distantTerrainRenderPass.get());
+    }
 
     // [STEP 4] Deferred Lighting + Atmosphere
     // Full-screen pass: reads G-Buffer, outputs lit scene to colortex0
     // Must run BEFORE translucents so water/cloud blend onto the lit scene
-    m_deferredRenderPass->Execute();
+    passes.push_back(m_deferredRenderPass.get());
 
     // [STEP 5] Translucent Rendering (water, ice, clouds)
     // Runs AFTER deferred so colortex0 contains the lit scene for correct blending
     // Water writes colortex4 (material mask) for composite SSR detection
-    m_terrainTranslucentRenderPass->Execute();
-    m_cloudRenderPass->Execute();
+    passes.push_back(m_terrainTranslucentRenderPass.get());
+    passes.push_back(m_cloudRenderPass.get());
 
     // [STEP 6] Composite passes (SSR, VL, tonemap)
-    m_compositeRenderPass->Execute();
+    passes.push_back(m_compositeRenderPass.get());
 
     // [STEP 7] Final output to backbuffer
-    m_finalRenderPass->Execute();
+    passes.push_back(m_finalRenderPass.get());
+
+    m_sceneRenderGraph->Execute(passes);
 }
 
 void Game::RenderDebug()
@@ -370,6 +442,7 @@ void Game::ProcessInputAction(float deltaSeconds)
         m_world->SetBlockState(BlockPos(-20, 2, 68), stoneBlock->GetDefaultState());
         m_world->SetBlockState(BlockPos(-20, 2, 69), stoneBlock->GetDefaultState());
         m_world->SetBlockState(BlockPos(-20, 2, 70), stoneBlock->GetDefaultState());
+        ChunkChangeNotifier::NotifyBlockChanged(-20, 2); // One column, one chunk
     }
 
     /// Reset Camera
@@ -409,7 +482,19 @@ void Game::UpdateWorld()
             m_world->SetPlayerPosition(m_player->m_position);
         }
 
-        m_world->Update(Clock::GetSystemClock().GetDeltaSeconds());
+        // World::Update performs the dirty region rebuilds; its duration and rebuild count feed the budget's cost fit
+        const float deltaSeconds = Clock::GetSystemClock().GetDeltaSeconds();
+        const auto  updateStart  = std::chrono::steady_clock::now();
+        m_world->Update(deltaSeconds);
+        const double updateMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - updateStart).count();
+        ChunkRegionRebuildBudget::Update(*m_world, GetChunkBatchCullingCamera(), deltaSeconds, updateMs);
+
+        if (m_player)
+        {
+            DistantTerrainLod::Update(m_player->m_position);
+            ChunkCodecBenchmark::Update(*m_world, m_player->m_position);
+            TerrainMeshingBenchmark::Update(*m_world, m_player->m_position);
+        }
     }
 }
 
@@ -6,6 +6,7 @@
 #include "Engine/Graphic/Shader/Uniform/MatricesUniforms.hpp"
 #include "Engine/Voxel/World/World.hpp"
 #include "Game/Framework/GameObject/PlayerCharacter.hpp"
+#include "Game/Framework/RenderGraph/SceneRenderGraph.hpp"
 #include "Game/Framework/RenderPass/SceneRenderPass.hpp"
 #include "Game/Framework/RenderPass/RenderTerrainTranslucent/TerrainTranslucentRenderPass.hpp"
 #include "Engine/Voxel/Time/WorldTimeProvider.hpp"
@@ -48,6 +49,7 @@ public:
     std::unique_ptr<SceneRenderPass> m_terrainRenderPass            = nullptr; // Terrain G-Buffer pass (solid)
     std::unique_ptr<SceneRenderPass> m_terrainCutoutRenderPass      = nullptr; // Terrain Cutout pass (leaves, grass)
     std::unique_ptr<SceneRenderPass> m_terrainTranslucentRenderPass = nullptr; // Translucent terrain (water)
+    std::unique_ptr<SceneRenderPass> m_distantTerrainRenderPass     = nullptr; // LOD regions beyond the simulation distance
     std::unique_ptr<SceneRenderPass> m_cloudRenderPass              = nullptr;
 
     std::unique_ptr<SceneRenderPass> m_deferredRenderPass  = nullptr;
@@ -57,6 +59,10 @@ public:
     std::unique_ptr<SceneRenderPass> m_chunkBachingRenderPass = nullptr;
     std::unique_ptr<SceneRenderPass> m_debugRenderPass = nullptr;
 
+    std::unique_ptr<SceneRenderGraph> m_sceneRenderGraph = nullptr; // Orders production passes and owns their depth/shadow barriers
+
+    const SceneRenderGraph* GetSceneRenderGraph() const { return m_sceneRenderGraph.get(); }
+
     void RenderWorld();
     void RenderDebug();
 #pragma endregion
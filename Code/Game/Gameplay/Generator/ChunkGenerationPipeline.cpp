@@ -0,0 +1,272 @@
+/**
+ * @file ChunkGenerationPipeline.cpp
+ * @brief Staged chunk generation with per-stage neighbor dependencies
+ * @date 2026-10-16
+ */
+
+#include "ChunkGenerationPipeline.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/Yaml.hpp"
+#include "Engine/Voxel/Chunk/Chunk.hpp"
+
+using namespace enigma::core;
+using namespace enigma::voxel;
+
+ChunkGenerationPipelineSettings ChunkGenerationPipeline::s_settings;
+
+namespace
+{
+    constexpr size_t STATUS_COUNT = static_cast<size_t>(ChunkGenStatus::Count);
+    constexpr int    COLUMN_COUNT = Chunk::CHUNK_SIZE_X * Chunk::CHUNK_SIZE_Y;
+    constexpr size_t SOLID_WORDS  = (static_cast<size_t>(COLUMN_COUNT) * Chunk::CHUNK_SIZE_Z + 63) / 64;
+
+    // Indexed by ChunkGenStatus
+    constexpr ChunkGenStage STAGES[STATUS_COUNT] = {
+        {ChunkGenStatus::Empty, "empty", 0, ChunkGenStatus::Empty, true},
+        {ChunkGenStatus::Noise, "noise", 0, ChunkGenStatus::Empty, true},
+        {ChunkGenStatus::Shape, "shape", 0, ChunkGenStatus::Empty, true},
+        {ChunkGenStatus::Surface, "surface", 0, ChunkGenStatus::Empty, false},
+        {ChunkGenStatus::Features, "features", 1, ChunkGenStatus::Shape, false}, // Trees read the neighbors' heightmaps
+    };
+
+    struct StageCounters
+    {
+        std::atomic<uint64_t> runs{0};
+        std::atomic<uint64_t> reused{0};
+        std::atomic<uint64_t> totalMicros{0};
+    };
+
+    std::array<StageCounters, STATUS_COUNT> s_stageCounters;
+
+    uint64_t MakeKey(int32_t chunkX, int32_t chunkY)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(chunkX)) << 32) | static_cast<uint32_t>(chunkY);
+    }
+
+    void RunTimed(ChunkGenStatus status, const ChunkGenerationPipeline::ProtoStageFn& stage, ProtoChunk& proto)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        stage(proto);
+        ChunkGenerationPipeline::RecordStageRun(status, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    }
+
+    /// Same search as SimpleMinerGenerator::GetGroundHeightAt(), probing solid bits instead of the density
+    void BuildHeightMap(ProtoChunk& proto)
+    {
+        proto.heightMap.assign(COLUMN_COUNT, -1);
+        for (int y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+        {
+            for (int x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+            {
+                int low  = 0;
+                int high = Chunk::CHUNK_SIZE_Z - 1;
+                while (low < high)
+                {
+                    const int mid = (low + high + 1) / 2;
+                    if (proto.IsSolid(x, y, mid))
+                        low = mid;
+                    else
+                        high = mid - 1;
+                }
+                if (low > 0 || proto.IsSolid(x, y, 0))
+                    proto.heightMap[x + y * Chunk::CHUNK_SIZE_X] = static_cast<int16_t>(low);
+            }
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ProtoChunk::IsSolid(int localX, int localY, int localZ) const
+{
+    const size_t bit = static_cast<size_t>(localX + localY * Chunk::CHUNK_SIZE_X) + static_cast<size_t>(localZ) * COLUMN_COUNT;
+    return (solid[bit >> 6] >> (bit & 63)) & 1ull;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ProtoChunk::SetSolid(int localX, int localY, int localZ)
+{
+    const size_t bit = static_cast<size_t>(localX + localY * Chunk::CHUNK_SIZE_X) + static_cast<size_t>(localZ) * COLUMN_COUNT;
+    solid[bit >> 6] |= 1ull << (bit & 63);
+}
+
+// ------------------------------------------------------------------------------------------------
+ChunkGenerationPipeline::ChunkGenerationPipeline(ProtoStageFn noiseStage, ProtoStageFn shapeStage)
+    : m_noiseStage(std::move(noiseStage))
+      , m_shapeStage(std::move(shapeStage))
+{
+}
+
+// ------------------------------------------------------------------------------------------------
+void ChunkGenerationPipeline::LoadSettings(const YamlConfiguration& config)
+{
+    s_settings.maxProtoChunks = static_cast<uint32_t>(std::max(config.GetInt("generationPipeline.maxProtoChunks", static_cast<int>(s_settings.maxProtoChunks)), 64));
+}
+
+// ------------------------------------------------------------------------------------------------
+const ChunkGenStage& ChunkGenerationPipeline::GetStage(ChunkGenStatus status)
+{
+    return STAGES[std::min(static_cast<size_t>(status), STATUS_COUNT - 1)];
+}
+
+// ------------------------------------------------------------------------------------------------
+ChunkGenStageStats ChunkGenerationPipeline::GetStageStats(ChunkGenStatus status)
+{
+    const StageCounters& counters = s_stageCounters[std::min(static_cast<size_t>(status), STATUS_COUNT - 1)];
+    ChunkGenStageStats   stats;
+    stats.runs    = counters.runs.load(std::memory_order_relaxed);
+    stats.reused  = counters.reused.load(std::memory_order_relaxed);
+    stats.totalMs = static_cast<double>(counters.totalMicros.load(std::memory_order_relaxed)) / 1000.0;
+    return stats;
+}
+
+// ------------------------------------------------------------------------------------------------
+const char* ChunkGenerationPipeline::GetStatusName(ChunkGenStatus status)
+{
+    return GetStage(status).name;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ChunkGenerationPipeline::RecordStageRun(ChunkGenStatus status, double elapsedMs)
+{
+    StageCounters& counters = s_stageCounters[std::min(static_cast<size_t>(status), STATUS_COUNT - 1)];
+    counters.runs.fetch_add(1, std::memory_order_relaxed);
+    counters.totalMicros.fetch_add(static_cast<uint64_t>(elapsedMs * 1000.0), std::memory_order_relaxed);
+}
+
+// ------------------------------------------------------------------------------------------------
+std::shared_ptr<ProtoChunk> ChunkGenerationPipeline::AcquireBlocks(int32_t chunkX, int32_t chunkY)
+{
+    std::shared_ptr<ProtoChunk> proto = GetOrCreate(chunkX, chunkY);
+    Advance(*proto, ChunkGenStatus::Shape, true);
+    return proto;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ChunkGenerationPipeline::RequireNeighbors(ChunkGenStatus stage, int32_t chunkX, int32_t chunkY)
+{
+    const ChunkGenStage& desc = GetStage(stage);
+    if (desc.neighborRadius <= 0)
+        return;
+    GUARANTEE_OR_DIE(GetStage(desc.neighborStatus).protoStage, "Neighbor dependencies must target a proto stage");
+
+    std::vector<std::shared_ptr<ProtoChunk>> pending;
+    for (int dy = -desc.neighborRadius; dy <= desc.neighborRadius; ++dy)
+    {
+        for (int dx = -desc.neighborRadius; dx <= desc.neighborRadius; ++dx)
+        {
+            if (dx == 0 && dy == 0)
+                continue;
+            std::shared_ptr<ProtoChunk> neighbor = GetOrCreate(chunkX + dx, chunkY + dy);
+            if (neighbor->status.load(std::memory_order_acquire) >= desc.neighborStatus)
+                s_stageCounters[static_cast<size_t>(desc.neighborStatus)].reused.fetch_add(1, std::memory_order_relaxed);
+            else
+                pending.push_back(std::move(neighbor));
+        }
+    }
+
+    // Inline on the calling generation worker: a nested scheduler wait here would hold an engine ChunkGen
+    // worker hostage to queue capacity. Proto stages have no neighbor dependencies of their own, so
+    // waiting on a neighbor's mutex only ever waits for that neighbor's shape to finish.
+    for (const std::shared_ptr<ProtoChunk>& neighbor : pending)
+    {
+        Advance(*neighbor, desc.neighborStatus, false);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+std::shared_ptr<const ProtoChunk> ChunkGenerationPipeline::Find(int32_t chunkX, int32_t chunkY) const
+{
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    const auto                  it = m_protos.find(MakeKey(chunkX, chunkY));
+    if (it == m_protos.end() || it->second.proto->status.load(std::memory_order_acquire) < ChunkGenStatus::Shape)
+        return nullptr;
+    m_lru.splice(m_lru.begin(), m_lru, it->second.lruIt);
+    return it->second.proto;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ChunkGenerationPipeline::ReleaseBlocks(const std::shared_ptr<ProtoChunk>& proto)
+{
+    if (!proto)
+        return;
+    std::lock_guard<std::mutex> lock(proto->mutex);
+    proto->solid.clear();
+    proto->solid.shrink_to_fit();
+    proto->hasBlocks = false;
+}
+
+// ------------------------------------------------------------------------------------------------
+uint32_t ChunkGenerationPipeline::GetProtoCount() const
+{
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    return static_cast<uint32_t>(m_protos.size());
+}
+
+// ------------------------------------------------------------------------------------------------
+std::shared_ptr<ProtoChunk> ChunkGenerationPipeline::GetOrCreate(int32_t chunkX, int32_t chunkY)
+{
+    const uint64_t              key = MakeKey(chunkX, chunkY);
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    const auto                  it = m_protos.find(key);
+    if (it != m_protos.end())
+    {
+        m_lru.splice(m_lru.begin(), m_lru, it->second.lruIt);
+        return it->second.proto;
+    }
+
+    auto proto    = std::make_shared<ProtoChunk>();
+    proto->chunkX = chunkX;
+    proto->chunkY = chunkY;
+    m_lru.push_front(key);
+    m_protos.emplace(key, CacheEntry{proto, m_lru.begin()});
+
+    // Workers still holding an evicted proto keep it alive until they are done with it
+    while (m_protos.size() > s_settings.maxProtoChunks)
+    {
+        m_protos.erase(m_lru.back());
+        m_lru.pop_back();
+    }
+    return proto;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ChunkGenerationPipeline::Advance(ProtoChunk& proto, ChunkGenStatus target, bool needBlocks)
+{
+    if (!needBlocks && proto.status.load(std::memory_order_acquire) >= target)
+    {
+        s_stageCounters[static_cast<size_t>(target)].reused.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(proto.mutex);
+    bool                        didWork = false;
+
+    // [STEP 1] Noise: per-column parameters, kept so a released shape can be rebuilt
+    if (proto.status.load(std::memory_order_relaxed) < ChunkGenStatus::Noise)
+    {
+        RunTimed(ChunkGenStatus::Noise, m_noiseStage, proto);
+        proto.status.store(ChunkGenStatus::Noise, std::memory_order_release);
+        didWork = true;
+    }
+
+    // [STEP 2] Shape: the solid bits, rebuilt when the chunk is generated again after ReleaseBlocks().
+    // heightMap is derived once and never rewritten, neighbors may be reading it.
+    const bool needShape = proto.status.load(std::memory_order_relaxed) < ChunkGenStatus::Shape || (needBlocks && !proto.hasBlocks);
+    if (target >= ChunkGenStatus::Shape && needShape)
+    {
+        proto.solid.assign(SOLID_WORDS, 0);
+        RunTimed(ChunkGenStatus::Shape, m_shapeStage, proto);
+        proto.hasBlocks = true;
+        if (proto.heightMap.empty())
+            BuildHeightMap(proto);
+        proto.status.store(ChunkGenStatus::Shape, std::memory_order_release);
+        didWork = true;
+    }
+
+    if (!didWork)
+        s_stageCounters[static_cast<size_t>(target)].reused.fetch_add(1, std::memory_order_relaxed);
+}
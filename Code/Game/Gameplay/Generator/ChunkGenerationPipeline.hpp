@@ -0,0 +1,157 @@
+/**
+ * @file ChunkGenerationPipeline.hpp
+ * @brief Staged chunk generation with per-stage neighbor dependencies (noise -> shape -> surface -> features)
+ * @date 2026-10-16
+ *
+ * Generation is split into status levels, each one a stage with a declared neighbor dependency:
+ *
+ *   Noise     per-column climate and terrain parameters            no neighbors
+ *   Shape     solid/air density field and heightmap                no neighbors
+ *   Surface   biome surface rules on the engine chunk              no neighbors
+ *   Features  trees, which cross chunk borders                     neighbors at Shape, radius 1
+ *
+ * Lighting is not a stage here: generated chunks are lit and meshed by the engine's own workers.
+ * Noise and Shape only depend on the seed, so they run on a ProtoChunk that does not need the
+ * engine chunk to exist. Protos are cached, so when Features needs the heightmaps of the 8
+ * neighbors, those neighbors are shaped once and the same shape work is reused when the neighbor
+ * itself is generated later.
+ *
+ * Scheduling: only the proto stages are independent units of work; any generation worker may run
+ * Noise / Shape for any chunk, and whichever gets there first does it. Surface and Features write
+ * into the engine chunk, whose states belong to the engine, so they run in order inside the one
+ * GenerateChunk() call the engine makes per chunk.
+ *
+ * Missing neighbors are shaped inline on the calling worker. The engine's ChunkGen workers are
+ * already busy with adjacent chunks and share their protos, so a worker never blocks on a nested
+ * scheduler job; at worst it waits on a neighbor's mutex while another worker shapes that neighbor.
+ *
+ * Thread safety: every call may come from any generation worker. A proto advances under its own
+ * mutex; neighbor dependencies are resolved before that mutex is taken, and a stage only depends
+ * on lower status levels, so two workers waiting on each other's protos cannot deadlock.
+ *
+ * Configuration Path: Run/.enigma/settings.yml -> generationPipeline
+ */
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "Engine/Core/Yaml.hpp"
+
+namespace enigma::voxel
+{
+    class Biome;
+}
+
+enum class ChunkGenStatus : uint8_t
+{
+    Empty = 0,
+    Noise,
+    Shape,
+    Surface,
+    Features,
+    Count
+};
+
+struct ChunkGenStage
+{
+    ChunkGenStatus status;
+    const char*    name;
+    int            neighborRadius; // Chebyshev radius in chunks that must reach neighborStatus first
+    ChunkGenStatus neighborStatus;
+    bool           protoStage;     // Runs on the ProtoChunk instead of the engine chunk
+};
+
+/// Seed-only intermediate data of one chunk column, shared by the chunk and its neighbors
+struct ProtoChunk
+{
+    int32_t chunkX = 0;
+    int32_t chunkY = 0;
+
+    std::atomic<ChunkGenStatus> status{ChunkGenStatus::Empty};
+    std::mutex                  mutex; // Held while a stage writes the data below
+
+    // Noise: one entry per column, index x + y * CHUNK_SIZE_X
+    std::vector<float>                                  heightOffset;
+    std::vector<float>                                  squashing;
+    std::vector<float>                                  erosion;
+    std::vector<std::shared_ptr<enigma::voxel::Biome>> biomes;
+
+    // Shape: one bit per block (x fastest, then y, then z) and the ground height per column (-1 = none).
+    // The shape stage only fills solid; the pipeline derives heightMap from it once, with the same binary
+    // search SimpleMinerGenerator::GetGroundHeightAt() runs on the density, so both give the same answer.
+    // The search assumes one solid/air transition per column and may land below an overhang.
+    std::vector<uint64_t> solid;
+    std::vector<int16_t>  heightMap;
+    bool                  hasBlocks = false; // false again after ReleaseBlocks() dropped solid
+
+    bool IsSolid(int localX, int localY, int localZ) const;
+    void SetSolid(int localX, int localY, int localZ);
+};
+
+struct ChunkGenerationPipelineSettings
+{
+    uint32_t maxProtoChunks = 2048; // Least recently used protos beyond this are dropped
+};
+
+struct ChunkGenStageStats
+{
+    uint64_t runs    = 0;
+    uint64_t reused  = 0; // Requests satisfied by work a neighbor already triggered
+    double   totalMs = 0.0;
+};
+
+class ChunkGenerationPipeline
+{
+public:
+    using ProtoStageFn = std::function<void(ProtoChunk&)>;
+
+    ChunkGenerationPipeline(ProtoStageFn noiseStage, ProtoStageFn shapeStage);
+
+    static void                                   LoadSettings(const enigma::core::YamlConfiguration& config);
+    static const ChunkGenerationPipelineSettings& GetSettings() { return s_settings; }
+    static const ChunkGenStage&                   GetStage(ChunkGenStatus status);
+    static ChunkGenStageStats                     GetStageStats(ChunkGenStatus status);
+    static const char*                            GetStatusName(ChunkGenStatus status);
+    static void                                   RecordStageRun(ChunkGenStatus status, double elapsedMs);
+
+    /// Proto of the chunk with its solid blocks, running Noise and Shape if they are missing
+    std::shared_ptr<ProtoChunk> AcquireBlocks(int32_t chunkX, int32_t chunkY);
+
+    /// Bring every neighbor within the stage's radius to its neighborStatus, on the calling thread
+    void RequireNeighbors(ChunkGenStatus stage, int32_t chunkX, int32_t chunkY);
+
+    /// Proto at status Shape or later without doing any work, nullptr if there is none
+    std::shared_ptr<const ProtoChunk> Find(int32_t chunkX, int32_t chunkY) const;
+
+    /// The chunk owns its blocks now; keep the heightmap and biomes for its neighbors only
+    void ReleaseBlocks(const std::shared_ptr<ProtoChunk>& proto);
+
+    uint32_t GetProtoCount() const;
+
+private:
+    std::shared_ptr<ProtoChunk> GetOrCreate(int32_t chunkX, int32_t chunkY);
+    void                        Advance(ProtoChunk& proto, ChunkGenStatus target, bool needBlocks);
+
+    ProtoStageFn m_noiseStage;
+    ProtoStageFn m_shapeStage;
+
+    struct CacheEntry
+    {
+        std::shared_ptr<ProtoChunk>   proto;
+        std::list<uint64_t>::iterator lruIt;
+    };
+
+    mutable std::mutex                       m_cacheMutex;
+    std::unordered_map<uint64_t, CacheEntry> m_protos;
+    mutable std::list<uint64_t>              m_lru; // Front = most recently used
+
+    static ChunkGenerationPipelineSettings s_settings;
+};
@@ -8,16 +8,96 @@
 #include "Engine/Math/SmoothNoise.hpp"
 #include <cmath>
 #include <algorithm>
+#include <array>
+#include <chrono>
 
 #include "Engine/Math/IntVec3.hpp"
 #include "Engine/Voxel/Function/ConstantDensityFunction.hpp"
 #include "Engine/Voxel/Function/SplineDensityFunction.hpp"
+#include "Game/Framework/ChunkStore/GeneratedChunkCache.hpp"
+#include "Game/Framework/WorldQuery/ChunkChangeNotifier.hpp"
 
 using namespace enigma::registry::block;
 using namespace enigma::voxel;
 
 DEFINE_LOG_CATEGORY(LogWorldGenerator);
 
+namespace
+{
+    /// Protos of the chunk generated on this thread and its 8 neighbors (index dx+1 + (dy+1)*3).
+    /// GetGroundHeightAt()/GetBiomeAt() answer from them instead of sampling noise again.
+    struct GenerationNeighborhood
+    {
+        const SimpleMinerGenerator*                       generator = nullptr;
+        int32_t                                           centerX   = 0;
+        int32_t                                           centerY   = 0;
+        uint32_t                                          seed      = 0;
+        std::shared_ptr<ProtoChunk>                       center;
+        std::array<std::shared_ptr<const ProtoChunk>, 9> protos;
+    };
+
+    thread_local GenerationNeighborhood* t_neighborhood = nullptr;
+
+    struct NeighborhoodScope
+    {
+        explicit NeighborhoodScope(GenerationNeighborhood* neighborhood) { t_neighborhood = neighborhood; }
+        ~NeighborhoodScope() { t_neighborhood = nullptr; }
+    };
+
+    /// Hands a proto's solid bits back to the pipeline on every exit path; the chunk owns its blocks by then
+    class ProtoBlocksLease
+    {
+    public:
+        ProtoBlocksLease(ChunkGenerationPipeline& pipeline, std::shared_ptr<ProtoChunk> proto)
+            : m_pipeline(pipeline)
+              , m_proto(std::move(proto))
+        {
+        }
+
+        ~ProtoBlocksLease() { m_pipeline.ReleaseBlocks(m_proto); }
+
+        ProtoBlocksLease(const ProtoBlocksLease&)            = delete;
+        ProtoBlocksLease& operator=(const ProtoBlocksLease&) = delete;
+
+        const std::shared_ptr<ProtoChunk>& Get() const { return m_proto; }
+
+    private:
+        ChunkGenerationPipeline&    m_pipeline;
+        std::shared_ptr<ProtoChunk> m_proto;
+    };
+
+    int FloorDiv(int value, int divisor)
+    {
+        return value >= 0 ? value / divisor : -((-value + divisor - 1) / divisor);
+    }
+
+    double ElapsedMs(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    /// Proto holding the column, with the column's index into it; nullptr outside the current neighborhood
+    const ProtoChunk* FindNeighborhoodColumn(const SimpleMinerGenerator* generator, int globalX, int globalY, int& outColumn)
+    {
+        const GenerationNeighborhood* neighborhood = t_neighborhood;
+        if (!neighborhood || neighborhood->generator != generator)
+            return nullptr;
+
+        const int chunkX = FloorDiv(globalX, Chunk::CHUNK_SIZE_X);
+        const int chunkY = FloorDiv(globalY, Chunk::CHUNK_SIZE_Y);
+        const int dx     = chunkX - neighborhood->centerX;
+        const int dy     = chunkY - neighborhood->centerY;
+        if (dx < -1 || dx > 1 || dy < -1 || dy > 1)
+            return nullptr;
+
+        const ProtoChunk* proto = neighborhood->protos[(dx + 1) + (dy + 1) * 3].get();
+        if (!proto)
+            return nullptr;
+        outColumn = (globalX - chunkX * Chunk::CHUNK_SIZE_X) + (globalY - chunkY * Chunk::CHUNK_SIZE_Y) * Chunk::CHUNK_SIZE_X;
+        return proto;
+    }
+}
+
 // ========== 构造函数实现 ==========
 SimpleMinerGenerator::SimpleMinerGenerator(uint32_t worldSeed)
     : TerrainGenerator("enigma_generator", "simpleminer")
@@ -132,6 +212,10 @@ SimpleMinerGenerator::SimpleMinerGenerator(uint32_t worldSeed)
     // 结果：ApplySurfaceRules 中 GetBiomeAt() 返回 null，表面方块无法应用
     InitializeBiomes();
 
+    m_pipeline = std::make_unique<ChunkGenerationPipeline>(
+        [this](ProtoChunk& proto) { RunNoiseStage(proto); },
+        [this](ProtoChunk& proto) { RunShapeStage(proto); });
+
     LogInfo(LogWorldGenerator, "SimpleMinerGenerator created with seed: %u", m_worldSeed);
 }
 
@@ -157,268 +241,62 @@ bool SimpleMinerGenerator::GenerateChunk(Chunk* chunk, int32_t chunkX, int32_t c
     // Use provided world seed or fallback to member seed
     uint32_t effectiveSeed = (worldSeed != 0) ? worldSeed : m_worldSeed;
 
-    // Establish world-space position and bounds of this chunk
-    IntVec3 chunkPosition(chunkX * Chunk::CHUNK_SIZE_X, chunkY * Chunk::CHUNK_SIZE_Y, 0);
-
-    // Allocate per-(x,y) maps
-    const int          mapSize = Chunk::CHUNK_SIZE_X * Chunk::CHUNK_SIZE_Y;
-    std::vector<int>   heightMapXY(mapSize);
-    std::vector<int>   dirtDepthXY(mapSize);
-    std::vector<float> humidityMapXY(mapSize);
-    std::vector<float> temperatureMapXY(mapSize);
-
-    for (int z = 0; z < Chunk::CHUNK_SIZE_Z; ++z)
+    // Revisited chunks that were never modified come from the generated chunk cache
+    const uint64_t configHash = GeneratedChunkCache::IsEnabled() ? GetConfigHash() : 0;
+    if (GeneratedChunkCache::TryLoad(chunk, chunkX, chunkY, effectiveSeed, configHash))
     {
-        // ===== Phase 3: 外层循环状态验证（Z坐标） =====
-        // 频率：每次迭代（256次/chunk）
-        if (chunk->GetState() != ChunkState::Generating)
-        {
-            LogDebug("SimpleMinerGenerator",
-                     "Chunk (%d, %d) state changed during Z iteration %d, abort generation",
-                     chunkX, chunkY, z);
-            return false;
-        }
-
-        for (int y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
-        {
-            // ===== Phase 3: 中层循环状态验证（Y坐标） =====
-            // 频率：每10次迭代检查一次（性能优化）
-            if (y % 10 == 0 && chunk->GetState() != ChunkState::Generating)
-            {
-                LogDebug("SimpleMinerGenerator",
-                         "Chunk (%d, %d) state changed at Y=%d Z=%d, abort generation",
-                         chunkX, chunkY, y, z);
-                return false;
-            }
-
-            for (int x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
-            {
-                int globalX = chunkX * Chunk::CHUNK_SIZE_X + x;
-                int globalY = chunkY * Chunk::CHUNK_SIZE_Y + y;
-                int globalZ = z;
-
-                // ========== Phase 2 & Phase 3 & Phase 4: 地形塑形流程 ==========
-                //
-                // 算法来源: Course Blog (Oct 17 - Continental; Oct 19 - Erosion; Oct 21 - Peaks/Valleys)
-                // 核心思想: 使用三层噪声协同控制地形形态
-                //
-                // 流程概述:
-                // 1. 采样大陆度噪声 (Continental) - 控制地形高度
-                // 2. 采样侵蚀度噪声 (Erosion) - 控制地形形态
-                // 3. 采样峰谷噪声 (PeaksValleys) - 控制峰谷细节
-                // 4. 通过样条曲线计算地形参数 (h, s, e, pv)
-                // 5. 计算3D密度场并添加垂直偏移(bias)
-                // 6. 应用高度偏移: density -= h
-                // 7. 计算动态基准高度和地形偏移: b, t
-                // 8. 应用挤压: density += s * t
-                // 9. 应用侵蚀: density += e * t
-                // 10. 应用峰谷: density += pv * abs(continentalness) * t
-                // 11. 放置方块: density < 0 → stone, density >= 0 → air
-
-                // 步骤1: 采样大陆度 (Continentalness) [-1, 1]
-                // 2D Perlin噪声，决定该位置是海洋(-1)还是大陆(+1)
-                float continentalness = SampleContinentalness(globalX, globalY);
-
-                // 步骤2: 采样侵蚀度 (Erosion) [-1, 1]
-                // 2D Perlin噪声，决定该位置是平坦(-1)还是崎岖(+1)
-                float erosion = SampleErosion(globalX, globalY);
-
-                // 步骤3: 采样峰谷度 (PeaksValleys) [-1, 1]
-                // 2D Perlin噪声，决定该位置是山峰(+1)还是山谷(-1)
-                float peaksValleys = SamplePeaksValleys(globalX, globalY);
-                UNUSED(peaksValleys)
-                // 步骤4: 通过样条曲线计算地形参数
-                // h (Height Offset): 高度偏移量，控制地形基准高度的上下浮动
-                //    海洋区域(c=-1): h=-0.6，降低基准高度，形成海底
-                //    大陆区域(c=+1): h=+0.6，抬升基准高度，形成陆地
-                float h = EvaluateHeightOffset(continentalness);
-
-                // s (Squashing): 挤压因子，控制地形的垂直拉伸/压缩
-                //    海洋区域(c=-1): s=0，不进行垂直变形
-                //    过渡区域(c=-0.25~0.25): s=2.0，增强垂直变化
-                //    大陆区域(c=+1): s=-1.5，压缩地形高度
-                float s = EvaluateSquashing(continentalness);
-
-                // e (Erosion Factor): 侵蚀因子，控制地形的粗糙度
-                //    平坦区域(e=-1): e=-0.3，减少垂直变化，形成平原
-                //    崎岖区域(e=+1): e=+0.6，增强垂直变化，形成峡谷
-                float e = EvaluateErosion(erosion);
-
-                // ========== 教授的 Density 计算公式 (1:1 复刻) ==========
-                // 来源: Course Blog (Oct 15 - Terrain Density and Bias; Oct 17 - Continents)
-                // 
-                // 核心设计理念:
-                //   1. 简洁性: 只使用 Continentalness 影响 terrain density
-                //   2. Erosion/PV: 仅用于 Biome 选择，不影响 density
-                //   3. 无 Height Gradient: 教授没有使用 Minecraft 1.18+ 的高度梯度机制
-                //   4. 无 Clamp: t 允许全范围影响，不限制范围
-                //
-                // 公式推导:
-                //   D(x, y, z) = N(x, y, z, s) + B(z)
-                //   B(z) = b × (z − t)
-                //   其中:
-                //     - N: 3D Perlin noise
-                //     - b: bias per block = 2 / CHUNK_SIZE_Z
-                //     - t: default terrain height = CHUNK_SIZE_Z / 2
-                //
-                // Continentalness 影响:
-                //   density -= h  (高度偏移)
-                //   density += s * t  (挤压因子)
-                //   其中 t = (z - b) / b，b 是动态基准高度
-
-                // 步骤 1: 基础 Density + Bias
-                float densityNoise = SampleNoise3D(globalX, globalY, globalZ);
-                float b_bias       = BIAS_PER_Z * (static_cast<float>(z) - TERRAIN_BASE_HEIGHT);
-                float density      = densityNoise + b_bias;
-
-                // 步骤 2: Continentalness Height Offset
-                // h ∈ [-0.6, 0.6]，通过样条曲线计算
-                // h > 0: 抬升地形(大陆)，h < 0: 降低地形(海洋)
-                density -= h;
-
-                // 步骤 3: Squashing Factor
-                // ⚠️ 修复说明 (2025-11-02)：
-                // 问题：当 h < 0（深海）时，b 可能变成负数，导致 t 计算错误
-                // 原因：b = 64 + (-1.0) × 128 = -64（负数！）
-                //       此时 t = (z - b) / b 会产生错误的符号和极端值
-                // 解决方案：确保 b > 0，防止除以零或负数
-                //
-                // 教授的公式：
-                // b = default_terrain_height + (h * (chunk_size_z / 2))
-                // t = (z - b) / b
-                // density -= s * t  （注意：教授用的是减法！）
-                //
-                // 但是，为了避免 b 变成负数，我们需要：
-                // 1. 使用绝对值确保 b > 0
-                // 2. 或者重新理解公式的含义
-
-                // 计算动态基准高度（考虑 continentalness 的影响）
-                float dynamic_base = TERRAIN_BASE_HEIGHT + (h * (static_cast<float>(Chunk::CHUNK_SIZE_Z) / 2.0f));
-
-                // 防止除以零或负数
-                if (dynamic_base <= 0.0f)
-                {
-                    dynamic_base = 1.0f; // 最小值为 1.0
-                }
+        chunk->SetGenerated(true);
+        chunk->MarkDirty();
+        ChunkChangeNotifier::NotifyChunkChanged(chunkX, chunkY);
+        LogDebug(LogWorldGenerator, "Loaded chunk (%d, %d) from the generated chunk cache", chunkX, chunkY);
+        return true;
+    }
 
-                // 计算归一化的垂直偏移
-                float t = (static_cast<float>(z) - dynamic_base) / dynamic_base;
-
-                // 应用 squashing factor
-                // s ∈ [-1.5, 2.0]，通过样条曲线计算
-                // s > 0: 拉伸地形(增强垂直变化)
-                // s < 0: 压缩地形(减弱垂直变化)
-                // 注意：教授的公式是 density -= s * t，但代码中使用 += 也能工作
-                // 因为样条曲线的符号已经调整过了
-                density += s * t;
-
-                // 步骤 4: Erosion Factor (Minecraft 1.18+ 官方实现)
-                // ⚠️ 新增功能 (2025-11-02): 应用 Erosion 因子到密度计算
-                // 原因：用户反馈平原和热带草原不够平坦
-                // 参考：Minecraft 1.18+ 地形生成系统
-                //
-                // Erosion 的作用：
-                // - e < 0 (低侵蚀): 减少垂直变化，形成平坦的平原
-                // - e > 0 (高侵蚀): 增强垂直变化，形成崎岖的山地和峡谷
-                //
-                // 公式：density += e * t
-                // 其中：
-                //   - e ∈ [-0.3, 0.6]（通过样条曲线从 Erosion 噪声映射）
-                //   - t: 归一化垂直偏移（已在上面计算）
-                //
-                // 效果：
-                //   - 平原 (e ≈ -0.3): density += (-0.3) * t，地形更平坦
-                //   - 山地 (e ≈ 0.6): density += 0.6 * t，地形更崎岖
-                density += e * t;
-
-                // 注意：PV (Peaks/Valleys) 在当前实现中只用于 Biome 选择
-                // 如果需要更精细的峰谷控制，可以添加：density += pv * |c| * t
-
-                // ===== Phase 3: 内层循环关键位置状态验证 =====
-                // 这是崩溃发生点，在访问 chunk 之前必须验证状态
-                // 频率：每次迭代（16 * 16 * 256 = 65536次/chunk）
-                if (chunk->GetState() != ChunkState::Generating)
-                {
-                    LogDebug("SimpleMinerGenerator",
-                             "Chunk (%d, %d) state changed at critical point X=%d Y=%d Z=%d, abort generation",
-                             chunkX, chunkY, x, y, z);
-                    return false; // 立即返回，不继续访问 chunk
-                }
+    // Stages run in status order; Noise/Shape may already be done because a neighbor needed them
+    GenerationNeighborhood neighborhood;
+    neighborhood.generator = this;
+    neighborhood.centerX   = chunkX;
+    neighborhood.centerY   = chunkY;
+    neighborhood.seed      = effectiveSeed;
+    NeighborhoodScope scope(&neighborhood);
+
+    // [STEP 1] Noise + Shape on the proto
+    ProtoBlocksLease blocks(*m_pipeline, m_pipeline->AcquireBlocks(chunkX, chunkY));
+    neighborhood.center    = blocks.Get();
+    neighborhood.protos[4] = neighborhood.center;
+    if (!GenerateTerrainShape(chunk, chunkX, chunkY))
+        return false;
 
-                // Set block type based on density
-                if (density < 0.0f)
-                {
-                    auto stoneBlock = GetCachedBlockById(m_stoneId);
-                    if (stoneBlock)
-                    {
-                        auto* blockState = stoneBlock->GetDefaultState();
-                        if (blockState)
-                        {
-                            chunk->SetBlock(x, y, z, blockState);
-                        }
-                    }
-                }
-                else
-                {
-                    auto airBlock = GetCachedBlockById(m_airId);
-                    if (airBlock)
-                    {
-                        auto* blockState = airBlock->GetDefaultState();
-                        if (blockState)
-                        {
-                            chunk->SetBlock(x, y, z, blockState);
-                        }
-                    }
-                }
-            }
-        }
+    // [STEP 2] Surface: biome surface rules (grass, sand, snow, etc.)
+    auto       stageStart = std::chrono::steady_clock::now();
+    const bool surfaceOk  = ApplySurfaceRules(chunk, chunkX, chunkY);
+    ChunkGenerationPipeline::RecordStageRun(ChunkGenStatus::Surface, ElapsedMs(stageStart));
+    if (!surfaceOk)
+        return false;
+    if (chunk->GetState() != ChunkState::Generating)
+    {
+        LogDebug("SimpleMinerGenerator", "Chunk (%d, %d) state changed after the surface stage, abort generation", chunkX, chunkY);
+        return false;
     }
 
-    // Fill water below sea level
-    auto waterBlock = GetCachedBlockById(m_waterId);
-    if (waterBlock)
+    // [STEP 3] Features: trees cross borders, so the neighbors' heightmaps must exist first
+    m_pipeline->RequireNeighbors(ChunkGenStatus::Features, chunkX, chunkY);
+    for (int i = 0; i < 9; ++i)
     {
-        auto* waterState = waterBlock->GetDefaultState();
-        if (waterState)
-        {
-            for (int z = 0; z < SEA_LEVEL; ++z)
-            {
-                // ===== Phase 3: 水填充循环状态验证 =====
-                if (chunk->GetState() != ChunkState::Generating)
-                {
-                    LogDebug("SimpleMinerGenerator",
-                             "Chunk (%d, %d) state changed during water fill at Z=%d, abort generation",
-                             chunkX, chunkY, z);
-                    return false;
-                }
-
-                for (int y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
-                {
-                    for (int x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
-                    {
-                        auto* currentBlock = chunk->GetBlock(x, y, z);
-                        if (currentBlock && currentBlock->GetBlock()->GetNumericId() == m_airId)
-                        {
-                            chunk->SetBlock(x, y, z, waterState);
-                        }
-                    }
-                }
-            }
-        }
+        if (i != 4)
+            neighborhood.protos[i] = m_pipeline->Find(chunkX + i % 3 - 1, chunkY + i / 3 - 1);
     }
+    stageStart            = std::chrono::steady_clock::now();
+    const bool featuresOk = GenerateFeatures(chunk, chunkX, chunkY);
+    ChunkGenerationPipeline::RecordStageRun(ChunkGenStatus::Features, ElapsedMs(stageStart));
+    if (!featuresOk)
+        return false;
 
-    // Apply biome surface rules (grass, sand, snow, etc.)
-    ApplySurfaceRules(chunk, chunkX, chunkY);
-
-    // Phase 7-9: Generate trees
-    // Create thread-local TreeGenerator instance to avoid race conditions
-    // Each thread gets its own instance with independent noise cache
-    auto treeGenerator = std::make_unique<SimpleMinerTreeGenerator>(effectiveSeed, this, this);
-    treeGenerator->GenerateTrees(chunk, chunkX, chunkY);
-
-    // Mark chunk as generated and dirty for mesh building
+    // Mark chunk as generated and dirty; the engine's workers light and mesh it
     chunk->SetGenerated(true);
     chunk->MarkDirty();
+    ChunkChangeNotifier::NotifyChunkChanged(chunkX, chunkY);
+    GeneratedChunkCache::Store(chunk, chunkX, chunkY, effectiveSeed, configHash);
     LogDebug(LogWorldGenerator, "Generated chunk (%d, %d) with SimpleMinerGenerator", chunkX, chunkY);
     return true;
 }
@@ -803,8 +681,16 @@ SimpleMinerGenerator::ErosionCategory SimpleMinerGenerator::ClassifyErosion(floa
     return ErosionCategory::E6;
 }
 
+std::shared_ptr<Biome> SimpleMinerGenerator::GetBiomeAt(int globalX, int globalY) const
+{
+    int column = 0;
+    if (const ProtoChunk* proto = FindNeighborhoodColumn(this, globalX, globalY, column))
+        return proto->biomes[column];
+    return SampleBiomeAt(globalX, globalY);
+}
+
 /**
- * @brief GetBiomeAt - 3层嵌套Biome查找表实现
+ * @brief SampleBiomeAt - 3层嵌套Biome查找表实现
  * 
  * 算法来源: Biomes.docx文档中的lookup table规则
  * 
@@ -837,7 +723,7 @@ SimpleMinerGenerator::ErosionCategory SimpleMinerGenerator::ClassifyErosion(floa
  * @param globalY 世界空间Y坐标 (注意：这里是2D平面，Y实际是Z)
  * @return 该位置对应的Biome实例
  */
-std::shared_ptr<Biome> SimpleMinerGenerator::GetBiomeAt(int globalX, int globalY) const
+std::shared_ptr<Biome> SimpleMinerGenerator::SampleBiomeAt(int globalX, int globalY) const
 {
     // Sample 5D climate parameters
     float T  = SampleNoise2D(globalX, globalY, NoiseType::Temperature);
@@ -1205,19 +1091,114 @@ float SimpleMinerGenerator::SampleNoise3D(int globalX, int globalY, int globalZ)
     );
 }
 
-// Multi-stage generation pipeline implementations
-// These methods are required by TerrainGenerator base class but currently unused.
-// All generation logic is handled in GenerateChunk() for now.
-// TODO: Refactor GenerateChunk() to use this 3-stage pipeline in future phases.
+// Generation pipeline stages, driven by GenerateChunk() in ChunkGenStatus order (see ChunkGenerationPipeline.hpp)
+
+void SimpleMinerGenerator::RunNoiseStage(ProtoChunk& proto) const
+{
+    const int columnCount = Chunk::CHUNK_SIZE_X * Chunk::CHUNK_SIZE_Y;
+    proto.heightOffset.resize(columnCount);
+    proto.squashing.resize(columnCount);
+    proto.erosion.resize(columnCount);
+    proto.biomes.resize(columnCount);
+
+    // The 2D terrain parameters used to be sampled again for every block of the column
+    for (int y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+    {
+        for (int x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+        {
+            const int   globalX         = proto.chunkX * Chunk::CHUNK_SIZE_X + x;
+            const int   globalY         = proto.chunkY * Chunk::CHUNK_SIZE_Y + y;
+            const int   column          = x + y * Chunk::CHUNK_SIZE_X;
+            const float continentalness = SampleContinentalness(globalX, globalY);
+            proto.heightOffset[column] = EvaluateHeightOffset(continentalness);
+            proto.squashing[column]    = EvaluateSquashing(continentalness);
+            proto.erosion[column]      = EvaluateErosion(SampleErosion(globalX, globalY));
+            proto.biomes[column]       = SampleBiomeAt(globalX, globalY);
+        }
+    }
+}
+
+void SimpleMinerGenerator::RunShapeStage(ProtoChunk& proto) const
+{
+    // Same operations in the same order as CalculateFinalDensity(), so GetGroundHeightAt() agrees with the blocks
+    for (int z = 0; z < Chunk::CHUNK_SIZE_Z; ++z)
+    {
+        const float bias = BIAS_PER_Z * (static_cast<float>(z) - TERRAIN_BASE_HEIGHT);
+        for (int y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+        {
+            for (int x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+            {
+                const int   column = x + y * Chunk::CHUNK_SIZE_X;
+                const float h      = proto.heightOffset[column];
+
+                float density = SampleNoise3D(proto.chunkX * Chunk::CHUNK_SIZE_X + x, proto.chunkY * Chunk::CHUNK_SIZE_Y + y, z) + bias;
+                density -= h;
+
+                float dynamic_base = TERRAIN_BASE_HEIGHT + (h * (static_cast<float>(Chunk::CHUNK_SIZE_Z) / 2.0f));
+                if (dynamic_base <= 0.0f)
+                {
+                    dynamic_base = 1.0f;
+                }
+                const float t = (static_cast<float>(z) - dynamic_base) / dynamic_base;
+                density += proto.squashing[column] * t;
+                density += proto.erosion[column] * t;
+
+                if (density < 0.0f)
+                {
+                    proto.SetSolid(x, y, z);
+                }
+            }
+        }
+    }
+}
 
 bool SimpleMinerGenerator::GenerateTerrainShape(Chunk* chunk, int32_t chunkX, int32_t chunkY)
 {
-    // Terrain shape generation (3D density field) is currently handled in GenerateChunk().
-    // This stub satisfies the TerrainGenerator interface requirement.
-    // Future refactoring will move density calculation logic here.
-    UNUSED(chunk);
-    UNUSED(chunkX);
-    UNUSED(chunkY);
+    if (!chunk)
+    {
+        LogError(LogWorldGenerator, "GenerateTerrainShape - null chunk provided");
+        return false;
+    }
+
+    // Called outside GenerateChunk() the blocks are acquired, and released again, here
+    const GenerationNeighborhood*     neighborhood = t_neighborhood;
+    const bool                        ownsProto    = neighborhood && neighborhood->generator == this && neighborhood->centerX == chunkX && neighborhood->centerY == chunkY;
+    std::unique_ptr<ProtoBlocksLease> lease        = ownsProto ? nullptr : std::make_unique<ProtoBlocksLease>(*m_pipeline, m_pipeline->AcquireBlocks(chunkX, chunkY));
+    const std::shared_ptr<ProtoChunk> proto        = ownsProto ? neighborhood->center : lease->Get();
+
+    auto  stoneBlock = GetCachedBlockById(m_stoneId);
+    auto  airBlock   = GetCachedBlockById(m_airId);
+    auto  waterBlock = GetCachedBlockById(m_waterId);
+    auto* stoneState = stoneBlock ? stoneBlock->GetDefaultState() : nullptr;
+    auto* airState   = airBlock ? airBlock->GetDefaultState() : nullptr;
+    auto* waterState = waterBlock ? waterBlock->GetDefaultState() : nullptr;
+
+    for (int z = 0; z < Chunk::CHUNK_SIZE_Z; ++z)
+    {
+        // Air below sea level becomes water in the same pass
+        auto* openState = (z < SEA_LEVEL && waterState) ? waterState : airState;
+        for (int y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+        {
+            // ===== Phase 3: 状态验证，chunk 可能在生成途中被卸载 =====
+            if (chunk->GetState() != ChunkState::Generating)
+            {
+                LogDebug("SimpleMinerGenerator",
+                         "Chunk (%d, %d) state changed at Y=%d Z=%d, abort generation",
+                         chunkX, chunkY, y, z);
+                return false;
+            }
+
+            for (int x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+            {
+                auto* blockState = proto->IsSolid(x, y, z) ? stoneState : openState;
+                if (blockState)
+                {
+                    chunk->SetBlock(x, y, z, blockState);
+                }
+            }
+        }
+    }
+
     return true;
 }
 
@@ -1389,13 +1370,19 @@ bool SimpleMinerGenerator::ApplySurfaceRules(Chunk* chunk, int32_t chunkX, int32
 
 bool SimpleMinerGenerator::GenerateFeatures(Chunk* chunk, int32_t chunkX, int32_t chunkY)
 {
-    // Feature generation (trees, ores, structures) is currently handled in GenerateChunk().
-    // This stub satisfies the TerrainGenerator interface requirement.
-    // Future refactoring will move feature placement logic here.
-    UNUSED(chunk);
-    UNUSED(chunkX);
-    UNUSED(chunkY);
-    return true;
+    if (!chunk)
+    {
+        LogError(LogWorldGenerator, "GenerateFeatures - null chunk provided");
+        return false;
+    }
+
+    // Phase 7-9: Generate trees
+    // Create thread-local TreeGenerator instance to avoid race conditions
+    // Each thread gets its own instance with independent noise cache
+    const GenerationNeighborhood* neighborhood  = t_neighborhood;
+    const uint32_t                seed          = (neighborhood && neighborhood->generator == this) ? neighborhood->seed : m_worldSeed;
+    auto                          treeGenerator = std::make_unique<SimpleMinerTreeGenerator>(seed, this, this);
+    return treeGenerator->GenerateTrees(chunk, chunkX, chunkY);
 }
 
 std::string SimpleMinerGenerator::GetConfigDescription() const
@@ -1403,6 +1390,38 @@ std::string SimpleMinerGenerator::GetConfigDescription() const
     return "SimpleMiner Terrain Generator - 3D Density-based terrain with biome system";
 }
 
+uint64_t SimpleMinerGenerator::GetConfigHash() const
+{
+    uint64_t   hash  = 14695981039346656037ull;
+    const auto mixIn = [&hash](const void* data, size_t size)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+    };
+
+    const float noiseScales[] = {
+        TEMPERATURE_NOISE_SCALE, HUMIDITY_NOISE_SCALE, CONTINENTAL_NOISE_SCALE, EROSION_NOISE_SCALE,
+        PEAKS_VALLEYS_NOISE_SCALE, DENSITY_NOISE_SCALE, TERRAIN_BASE_HEIGHT, BIAS_PER_Z
+    };
+    const unsigned int noiseOctaves[] = {
+        TEMPERATURE_NOISE_OCTAVES, HUMIDITY_NOISE_OCTAVES, CONTINENTAL_NOISE_OCTAVES, EROSION_NOISE_OCTAVES,
+        PEAKS_VALLEYS_NOISE_OCTAVES, DENSITY_NOISE_OCTAVES
+    };
+    const int         chunkSize[] = {Chunk::CHUNK_SIZE_X, Chunk::CHUNK_SIZE_Y, Chunk::CHUNK_SIZE_Z, SEA_LEVEL};
+    const std::string description = GetConfigDescription();
+
+    mixIn(&GENERATOR_VERSION, sizeof(GENERATOR_VERSION));
+    mixIn(noiseScales, sizeof(noiseScales));
+    mixIn(noiseOctaves, sizeof(noiseOctaves));
+    mixIn(chunkSize, sizeof(chunkSize));
+    mixIn(description.data(), description.size());
+    return hash;
+}
+
 float SimpleMinerGenerator::Compute2dPerlinNoise(float        x, float           y, float          scale, unsigned int octaves,
                                                  float        persistence, float octaveScale, bool renormalize,
                                                  unsigned int seed) const
@@ -1446,6 +1465,14 @@ float SimpleMinerGenerator::CalculateFinalDensity(int globalX, int globalY, int
 
 int SimpleMinerGenerator::GetGroundHeightAt(int globalX, int globalY) const
 {
+    // Around the chunk being generated the Shape stage heightmap holds the result of this same search
+    int column = 0;
+    if (const ProtoChunk* proto = FindNeighborhoodColumn(this, globalX, globalY, column))
+    {
+        const int16_t height = proto->heightMap[column];
+        return height >= 0 ? height : SEA_LEVEL;
+    }
+
     // 使用二分搜索查找地面高度
     // 搜索范围: [0, CHUNK_SIZE_Z - 1]
     // 当 density < 0.0f 时表示固体方块
@@ -4,6 +4,7 @@
 #include "Engine/Voxel/Function/SplineDensityFunction.hpp"
 #include "Engine/Math/IntVec2.hpp"
 #include "Engine/Core/Engine.hpp"
+#include "ChunkGenerationPipeline.hpp"
 #include <unordered_map>
 #include <memory>
 
@@ -65,6 +66,8 @@ private:
     static constexpr float BIAS_PER_Z          = 0.015f; // 每个Z单位的密度偏置
     static constexpr int   SEA_LEVEL           = 64; // 海平面高度
 
+    static constexpr uint32_t GENERATOR_VERSION = 1; // Part of GetConfigHash(), bump when the output changes
+
     // ========== Noise Type Enumeration ==========
     enum class NoiseType : unsigned int
     {
@@ -136,6 +139,9 @@ private:
     // World seed
     uint32_t m_worldSeed;
 
+    // Noise/shape protos shared between neighboring chunks, see ChunkGenerationPipeline.hpp
+    std::unique_ptr<ChunkGenerationPipeline> m_pipeline;
+
     // Phase 2-4: Spline Density Functions
     std::shared_ptr<SplineDensityFunction> m_heightOffsetSpline; // Height offset based on continentalness
     std::shared_ptr<SplineDensityFunction> m_squashingSpline; // Squashing factor based on continentalness
@@ -320,6 +326,21 @@ private:
      */
     float CalculateFinalDensity(int globalX, int globalY, int globalZ) const;
 
+    /**
+     * @brief Pipeline Noise stage: per-column height offset, squashing, erosion and biome
+     */
+    void RunNoiseStage(ProtoChunk& proto) const;
+
+    /**
+     * @brief Pipeline Shape stage: solid bits of the density field, same formula as CalculateFinalDensity()
+     */
+    void RunShapeStage(ProtoChunk& proto) const;
+
+    /**
+     * @brief Biome from the climate noise, without looking at pipeline protos
+     */
+    std::shared_ptr<enigma::voxel::Biome> SampleBiomeAt(int globalX, int globalY) const;
+
     /**
      * @brief Get cached block by name
      */
@@ -358,7 +379,7 @@ private:
     float SmoothStep3(float t) const;
 
     /**
-     * @brief Phase 2: Generate terrain shape using 3D density
+     * @brief Phase 2: Write the Shape stage's stone/air into the chunk and fill water below sea level
      */
     bool GenerateTerrainShape(Chunk* chunk, int32_t chunkX, int32_t chunkY) override;
 
@@ -368,7 +389,7 @@ private:
     bool ApplySurfaceRules(Chunk* chunk, int32_t chunkX, int32_t chunkY) override;
 
     /**
-     * @brief Phase 7-9: Generate features (ores, caves, trees)
+     * @brief Phase 7-9: Generate features (trees); expects the neighbors at Shape for their heightmaps
      */
     bool GenerateFeatures(Chunk* chunk, int32_t chunkX, int32_t chunkY) override;
 
@@ -407,12 +428,23 @@ public:
      */
     std::string GetConfigDescription() const override;
 
+    /**
+     * @brief Hash of everything that shapes the generated blocks apart from the seed
+     *
+     * Keys the generated chunk cache together with the seed. Bump GENERATOR_VERSION whenever a
+     * change to the generation code alters its output, so stale cached chunks are not served.
+     *
+     * @return 64-bit FNV-1a hash of GENERATOR_VERSION and the terrain constants
+     */
+    uint64_t GetConfigHash() const;
+
     /**
      * @brief Get ground height at specific world position using noise calculation
      * 
      * This method calculates the ground height at a given (x, y) position by sampling
      * the 3D density noise without accessing chunk data. It uses binary search to find
-     * the highest solid block (density < 0.0f) efficiently.
+     * the highest solid block (density < 0.0f) efficiently. Around the chunk being generated
+     * on the calling thread the Shape stage's heightmap, built by the same search, answers instead.
      * 
      * Thread-safe: Does not access chunk data, only uses noise calculations.
      * 
@@ -435,4 +467,9 @@ public:
      * @return Biome instance for this location
      */
     std::shared_ptr<enigma::voxel::Biome> GetBiomeAt(int globalX, int globalY) const;
+
+    /**
+     * @brief Sea level; columns whose ground is below it are filled with water up to it
+     */
+    int GetSeaLevel() const { return SEA_LEVEL; }
 };
@@ -37,10 +37,8 @@ void RunMessagePump()
 int WINAPI WinMain(HINSTANCE applicationInstanceHandle, HINSTANCE, LPSTR commandLineString, int)
 {
     UNUSED(applicationInstanceHandle)
-    UNUSED(commandLineString)
-    
     g_theApp = new App();
-    g_theApp->Startup(); // 通过基类指针调用虚函数
+    g_theApp->Startup(commandLineString); // 通过基类指针调用虚函数
     
     // Program main loop; keep running frames until it's time to quit
     while (!g_theApp->IsQuitting()) // #SD1ToDo: ...becomes:  !g_theApp->IsQuitting()
@@ -1,6 +1,23 @@
 ﻿#include "SceneUnitTest.hpp"
 
+#include "Engine/Core/ErrorWarningAssert.hpp"
+
 SceneRenderContextProvider::SceneRenderContext& SceneUnitTest::GetSceneRenderContext()
 {
     return m_context;
 }
+
+void SceneUnitTest::Check(bool condition, const char* description)
+{
+    ++m_checkCount;
+    if (!condition)
+    {
+        ++m_failedCheckCount;
+    }
+    DebuggerPrintf("  [%s] %s\n", condition ? "PASS" : "FAIL", description);
+}
+
+void SceneUnitTest::LogCheckSummary(const char* sceneName) const
+{
+    DebuggerPrintf("[%s] %d / %d checks passed\n", sceneName, m_checkCount - m_failedCheckCount, m_checkCount);
+}
@@ -8,6 +8,13 @@ public:
     virtual void        Update() = 0;
     SceneRenderContext& GetSceneRenderContext() override;
 
+protected:
+    // Headless scenes run their checks once on construction; results go to the debugger output
+    void Check(bool condition, const char* description);
+    void LogCheckSummary(const char* sceneName) const;
+
 private:
     SceneRenderContext m_context;
+    int                m_checkCount       = 0;
+    int                m_failedCheckCount = 0;
 };
@@ -0,0 +1,255 @@
+﻿#include "SceneUnitTest_RenderGraph.hpp"
+
+#include <algorithm>
+#include <memory>
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Graphic/Bundle/Integration/ShaderBundleSubsystem.hpp"
+#include "Game/GameCommon.hpp"
+#include "Game/Framework/RenderGraph/RenderGraph.hpp"
+#include "Game/Framework/RenderGraph/SceneRenderGraph.hpp"
+#include "Game/Framework/RenderPass/RenderPassCulling.hpp"
+#include "Game/Framework/RenderPass/RenderCloud/CloudRenderPass.hpp"
+#include "Game/Framework/RenderPass/RenderComposite/CompositeRenderPass.hpp"
+#include "Game/Framework/RenderPass/RenderDeferred/DeferredRenderPass.hpp"
+#include "Game/Framework/RenderPass/RenderDistantTerrain/DistantTerrainRenderPass.hpp"
+#include "Game/Framework/RenderPass/RenderFinal/FinalRenderPass.hpp"
+#include "Game/Framework/RenderPass/RenderShadow/ShadowRenderPass.hpp"
+#include "Game/Framework/RenderPass/RenderShadowComposite/ShadowCompositeRenderPass.hpp"
+#include "Game/Framework/RenderPass/RenderSkyBasic/SkyBasicRenderPass.hpp"
+#include "Game/Framework/RenderPass/RenderSkyTextured/SkyTexturedRenderPass.hpp"
+#include "Game/Framework/RenderPass/RenderTerrain/TerrainRenderPass.hpp"
+#include "Game/Framework/RenderPass/RenderTerrainCutout/TerrainCutoutRenderPass.hpp"
+#include "Game/Framework/RenderPass/RenderTerrainTranslucent/TerrainTranslucentRenderPass.hpp"
+
+namespace
+{
+    constexpr RenderGraphResource COLORTEX_1 = {RenderGraphResourceType::ColorTex, 1};
+    constexpr RenderGraphResource COLORTEX_2 = {RenderGraphResourceType::ColorTex, 2};
+    constexpr RenderGraphResource COLORTEX_3 = {RenderGraphResourceType::ColorTex, 3};
+    constexpr RenderGraphResource COLORTEX_4 = {RenderGraphResourceType::ColorTex, 4};
+    constexpr RenderGraphResource COLORTEX_5 = {RenderGraphResourceType::ColorTex, 5};
+    constexpr RenderGraphResource COLORTEX_6 = {RenderGraphResourceType::ColorTex, 6};
+    constexpr RenderGraphResource COLORTEX_7 = {RenderGraphResourceType::ColorTex, 7};
+    constexpr RenderGraphResource DEPTHTEX_0 = {RenderGraphResourceType::DepthTex, 0};
+    constexpr RenderGraphResource DEPTHTEX_1 = {RenderGraphResourceType::DepthTex, 1};
+
+    void DeclareTransient(RenderGraph& graph, const RenderGraphResource& resource, const char* formatKey)
+    {
+        RenderGraphResourceDesc desc;
+        desc.resource    = resource;
+        desc.frameAccess = RenderGraph::GetDefaultAccess(resource.type);
+        desc.formatKey   = formatKey;
+        desc.external    = false;
+        graph.DeclareResource(desc);
+    }
+
+    bool HasMessage(const RenderGraphCompileResult& result, RenderGraphMessageSeverity severity, int passIndex)
+    {
+        return std::any_of(result.messages.begin(), result.messages.end(), [&](const RenderGraphMessage& message)
+        {
+            return message.severity == severity && message.passIndex == passIndex;
+        });
+    }
+
+    const RenderGraphLifetime* FindLifetime(const RenderGraphCompileResult& result, const RenderGraphResource& resource)
+    {
+        for (const RenderGraphLifetime& lifetime : result.lifetimes)
+        {
+            if (lifetime.resource == resource)
+                return &lifetime;
+        }
+        return nullptr;
+    }
+}
+
+SceneUnitTest_RenderGraph::SceneUnitTest_RenderGraph()
+{
+    DebuggerPrintf("[SceneUnitTest_RenderGraph] Running\n");
+    TestBarrierMinimization();
+    TestOrderingValidation();
+    TestAliasGrouping();
+    TestBarrierReplay();
+    TestProductionPassList();
+    LogCheckSummary("SceneUnitTest_RenderGraph");
+}
+
+void SceneUnitTest_RenderGraph::Render()
+{
+}
+
+void SceneUnitTest_RenderGraph::Update()
+{
+}
+
+void SceneUnitTest_RenderGraph::TestBarrierMinimization()
+{
+    // gbuffer writes colortex1, two later passes sample it, colortex2 is declared twice in one pass
+    RenderGraph graph;
+    const int   gbuffer   = graph.AddPass("gbuffer");
+    const int   lighting  = graph.AddPass("lighting");
+    const int   composite = graph.AddPass("composite");
+    graph.Write(gbuffer, COLORTEX_1);
+    graph.Write(gbuffer, COLORTEX_2);
+    graph.Write(gbuffer, COLORTEX_2);
+    graph.Read(lighting, COLORTEX_1);
+    graph.Read(composite, COLORTEX_1);
+
+    const RenderGraphCompileResult result = graph.Compile();
+    Check(result.passes.size() == 3, "Barriers: every pass is compiled");
+    Check(result.passes[gbuffer].uses.size() == 2, "Barriers: duplicate declarations merge into one use");
+    Check(result.passes[gbuffer].barriers.empty(), "Barriers: writes in the frame-start state need no transition");
+    Check(result.passes[lighting].barriers.size() == 1 &&
+          result.passes[lighting].barriers[0].before == RenderGraphAccess::RenderTarget &&
+          result.passes[lighting].barriers[0].after == RenderGraphAccess::ShaderRead,
+          "Barriers: first read transitions RenderTarget -> ShaderRead");
+    Check(result.passes[composite].barriers.empty(), "Barriers: a second consecutive read reuses the state");
+    Check(result.endOfFrameBarriers.size() == 1 && result.endOfFrameBarriers[0].resource == COLORTEX_1,
+          "Barriers: frame state is restored once at frame end");
+    Check(result.barrierCount == 2, "Barriers: two transitions in total");
+    Check(result.perPassBarrierCount == 4, "Barriers: per-pass baseline counts in + out for each read");
+    Check(!result.HasErrors(), "Barriers: no errors");
+}
+
+void SceneUnitTest_RenderGraph::TestOrderingValidation()
+{
+    RenderGraph graph;
+    DeclareTransient(graph, COLORTEX_3, "RGBA16F");
+    DeclareTransient(graph, COLORTEX_7, "RGBA16F");
+    const int water     = graph.AddPass("water");
+    const int composite = graph.AddPass("composite");
+    const int taa       = graph.AddPass("taa");
+    graph.Read(water, DEPTHTEX_0);
+    graph.Write(water, DEPTHTEX_0);
+    graph.Read(composite, COLORTEX_3);
+    graph.Read(composite, COLORTEX_7);
+    graph.Write(taa, COLORTEX_7);
+
+    const RenderGraphCompileResult result = graph.Compile();
+    Check(result.HasErrors(), "Ordering: sampling and writing a depth target in one pass is an error");
+    Check(HasMessage(result, RenderGraphMessageSeverity::Error, water), "Ordering: the hazard is reported on the offending pass");
+    Check(HasMessage(result, RenderGraphMessageSeverity::Warning, composite), "Ordering: a declared target that is never written warns");
+
+    const RenderGraphLifetime* history = FindLifetime(result, COLORTEX_7);
+    Check(history && history->readsHistory && !history->transient, "Ordering: a read before the first write uses the previous frame and is not aliasable");
+    Check(HasMessage(result, RenderGraphMessageSeverity::Info, composite), "Ordering: previous-frame reads are reported");
+}
+
+void SceneUnitTest_RenderGraph::TestAliasGrouping()
+{
+    // colortex3 [0, 1] and colortex4 [2, 3] are disjoint; colortex6 [0, 3] overlaps both; colortex5 has another format
+    RenderGraph graph;
+    DeclareTransient(graph, COLORTEX_3, "RGBA16F");
+    DeclareTransient(graph, COLORTEX_4, "RGBA16F");
+    DeclareTransient(graph, COLORTEX_5, "R8");
+    DeclareTransient(graph, COLORTEX_6, "RGBA16F");
+    DeclareTransient(graph, DEPTHTEX_1, "D32");
+    const int gbuffer   = graph.AddPass("gbuffer");
+    const int lighting  = graph.AddPass("lighting");
+    const int bloom     = graph.AddPass("bloom");
+    const int finalPass = graph.AddPass("final");
+    graph.Write(gbuffer, COLORTEX_3);
+    graph.Write(gbuffer, COLORTEX_6);
+    graph.Write(gbuffer, DEPTHTEX_1);
+    graph.Read(lighting, COLORTEX_3);
+    graph.Write(lighting, COLORTEX_5);
+    graph.Write(bloom, COLORTEX_4);
+    graph.Read(finalPass, COLORTEX_4);
+    graph.Read(finalPass, COLORTEX_5);
+    graph.Read(finalPass, COLORTEX_6);
+    graph.Read(finalPass, DEPTHTEX_1);
+
+    const RenderGraphCompileResult result = graph.Compile();
+    Check(!result.HasErrors(), "Aliasing: graph compiles without errors");
+    Check(result.aliasGroups.size() == 1, "Aliasing: exactly one group with more than one member");
+    Check(result.aliasedTargetCount == 1, "Aliasing: one target borrows memory");
+    if (result.aliasGroups.size() == 1)
+    {
+        const RenderGraphAliasGroup& group = result.aliasGroups[0];
+        Check(group.formatKey == "RGBA16F", "Aliasing: group keeps its format key");
+        Check(group.members.size() == 2 && group.members[0] == COLORTEX_3 && group.members[1] == COLORTEX_4,
+              "Aliasing: disjoint lifetimes share a group, ordered by first use");
+    }
+
+    const RenderGraphLifetime* depth = FindLifetime(result, DEPTHTEX_1);
+    Check(depth && !depth->transient, "Aliasing: depth targets are never transient");
+    const RenderGraphLifetime* overlapping = FindLifetime(result, COLORTEX_6);
+    Check(overlapping && overlapping->transient && overlapping->firstPass == gbuffer && overlapping->lastPass == finalPass,
+          "Aliasing: overlapping transient keeps its own memory");
+}
+
+void SceneUnitTest_RenderGraph::TestBarrierReplay()
+{
+    // The scene chain in miniature: terrain writes depthtex0, deferred samples it, water writes it again
+    RenderGraph graph;
+    const int   terrain  = graph.AddPass("terrain");
+    const int   deferred = graph.AddPass("deferred");
+    const int   water    = graph.AddPass("water");
+    graph.Write(terrain, DEPTHTEX_0);
+    graph.Write(terrain, COLORTEX_1);
+    graph.Read(deferred, DEPTHTEX_0);
+    graph.Read(deferred, DEPTHTEX_1);
+    graph.Read(deferred, COLORTEX_1);
+    graph.Write(water, DEPTHTEX_0);
+    graph.Read(water, DEPTHTEX_1);
+
+    const RenderGraphCompileResult result = graph.Compile();
+    std::string                    problem;
+    Check(graph.VerifyBarriers(result, problem), "Replay: compiled barriers satisfy every declared use");
+
+    RenderGraphCompileResult missingTransition = result;
+    missingTransition.passes[deferred].barriers.clear();
+    Check(!graph.VerifyBarriers(missingTransition, problem), "Replay: a sampled depth target without its transition fails");
+
+    RenderGraphCompileResult missingRestore = result;
+    missingRestore.endOfFrameBarriers.clear();
+    Check(!graph.VerifyBarriers(missingRestore, problem), "Replay: a target left out of its frame state fails");
+
+    RenderGraphCompileResult missingPass = result;
+    missingPass.passes.pop_back();
+    Check(!graph.VerifyBarriers(missingPass, problem), "Replay: a compile result for another pass list fails");
+}
+
+void SceneUnitTest_RenderGraph::TestProductionPassList()
+{
+    // Every production pass in Game::Render order, including the shadow- and LOD-gated ones
+    std::vector<std::unique_ptr<SceneRenderPass>> owned;
+    owned.push_back(std::make_unique<ShadowRenderPass>());
+    owned.push_back(std::make_unique<ShadowCompositeRenderPass>());
+    owned.push_back(std::make_unique<SkyBasicRenderPass>());
+    owned.push_back(std::make_unique<SkyTexturedRenderPass>());
+    owned.push_back(std::make_unique<TerrainRenderPass>());
+    owned.push_back(std::make_unique<TerrainCutoutRenderPass>());
+    owned.push_back(std::make_unique<DistantTerrainRenderPass>());
+    owned.push_back(std::make_unique<DeferredRenderPass>());
+    owned.push_back(std::make_unique<TerrainTranslucentRenderPass>());
+    owned.push_back(std::make_unique<CloudRenderPass>());
+    owned.push_back(std::make_unique<CompositeRenderPass>());
+    owned.push_back(std::make_unique<FinalRenderPass>());
+
+    std::vector<SceneRenderPass*> passes;
+    for (const auto& pass : owned)
+    {
+        passes.push_back(pass.get());
+    }
+
+    auto compile = [this, &passes](const char* analysis)
+    {
+        SceneRenderGraph sceneGraph;
+        sceneGraph.Rebuild(passes);
+        const RenderGraphCompileResult& result = sceneGraph.GetCompileResult();
+        for (const RenderGraphMessage& message : result.messages)
+        {
+            if (message.severity == RenderGraphMessageSeverity::Error)
+                DebuggerPrintf("[SceneUnitTest_RenderGraph] %s: %s\n", analysis, message.text.c_str());
+        }
+        Check(result.passes.size() == passes.size(), "Production: every pass declares exactly one graph pass");
+        Check(!result.HasErrors(), "Production: the real pass list compiles without errors");
+    };
+
+    // Unscanned bundle first: every program is assumed to sample every texture
+    RenderPassCulling::Reload(nullptr);
+    compile("conservative");
+    RenderPassCulling::Reload(g_theShaderBundleSubsystem->GetCurrentShaderBundle().get());
+    compile("scanned");
+}
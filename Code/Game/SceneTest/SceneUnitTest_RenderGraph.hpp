@@ -0,0 +1,33 @@
+﻿#pragma once
+#include "SceneUnitTest.hpp"
+
+// ============================================================================
+// SceneUnitTest_RenderGraph
+//
+// Headless checks of the RenderGraph compiler (nothing is drawn or transitioned):
+// - Barrier minimization: consecutive reads share one transition, frame state is restored once
+// - Ordering validation: SRV + DSV hazard, read-never-written, previous-frame reads
+// - Alias grouping: disjoint transient lifetimes with matching format keys share a group
+// - Barrier replay: VerifyBarriers accepts the compiled list and rejects missing transitions
+// - Production passes: SceneRenderGraph::Rebuild over the real pass list, with the conservative and
+//   the scanned culling analysis, reports no errors (needs the shader bundle, so run after it loads)
+//
+// Expected Results:
+// - "[SceneUnitTest_RenderGraph] N / N checks passed" in the debugger output; nothing is drawn
+// ============================================================================
+class SceneUnitTest_RenderGraph : public SceneUnitTest
+{
+public:
+    SceneUnitTest_RenderGraph();
+    ~SceneUnitTest_RenderGraph() override = default;
+
+    void Render() override;
+    void Update() override;
+
+private:
+    void TestBarrierMinimization();
+    void TestOrderingValidation();
+    void TestAliasGrouping();
+    void TestBarrierReplay();
+    void TestProductionPassList();
+};
@@ -0,0 +1,74 @@
+/**
+ * @file terrainVertex.hlsl
+ * @brief Terrain vertex input (54-byte TerrainVertex), decoded to one attribute struct
+ *
+ * The engine mesher only writes TerrainVertex, so that is the only input layout. The 20-byte
+ * PackedTerrainVertex stays CPU-side until the mesher can emit it.
+ *
+ * Dependencies:
+ *   - include/settings.hlsl
+ */
+
+#ifndef LIB_TERRAIN_VERTEX_HLSL
+#define LIB_TERRAIN_VERTEX_HLSL
+
+#include "../include/settings.hlsl"
+
+// Index = TerrainVertexFace; dh_terrain decodes the LOD column faces with it too
+static const float3 TERRAIN_FACE_NORMALS[10] = {
+    float3(-1.0, 0.0, 0.0),
+    float3(1.0, 0.0, 0.0),
+    float3(0.0, -1.0, 0.0),
+    float3(0.0, 1.0, 0.0),
+    float3(0.0, 0.0, -1.0),
+    float3(0.0, 0.0, 1.0),
+    float3(0.70710678, 0.70710678, 0.0),
+    float3(-0.70710678, 0.70710678, 0.0),
+    float3(-0.70710678, -0.70710678, 0.0),
+    float3(0.70710678, -0.70710678, 0.0)
+};
+
+/**
+ * @brief Vertex shader input - matches TerrainVertex (Engine/Voxel/World/TerrainVertexLayout.hpp)
+ */
+struct VSInput_TerrainVertex
+{
+    float3 Position : POSITION; // Vertex position (local space)
+    float4 Color : COLOR0; // Vertex color (R8G8B8A8_UNORM unpacked)
+    float2 TexCoord : TEXCOORD0; // UV coordinates
+    float3 Normal : NORMAL; // Normal vector
+    float2 LightmapCoord: LIGHTMAP; // Lightmap (x=blocklight, y=skylight)
+    uint   entityId : TEXCOORD2; // Block entity ID (mc_Entity)
+    float2 midTexCoord : TEXCOORD3; // Texture center (mc_midTexCoord)
+};
+
+/**
+ * @brief Decoded terrain vertex
+ */
+struct TerrainVertexData
+{
+    float3 Position; // Local space (model matrix not applied)
+    float4 Color;
+    float2 TexCoord;
+    float3 Normal; // Local space, unit length
+    float2 LightmapCoord; // 0-1, x=blocklight, y=skylight
+    uint   entityId;
+    float2 midTexCoord;
+};
+
+TerrainVertexData DecodeTerrainVertex(VSInput_TerrainVertex input)
+{
+    TerrainVertexData vertex;
+    vertex.Color = input.Color;
+
+    vertex.Position      = input.Position;
+    vertex.Normal        = input.Normal;
+    vertex.TexCoord      = input.TexCoord;
+    vertex.LightmapCoord = input.LightmapCoord;
+    vertex.entityId      = input.entityId;
+    vertex.midTexCoord   = input.midTexCoord;
+
+    return vertex;
+}
+
+#endif // LIB_TERRAIN_VERTEX_HLSL
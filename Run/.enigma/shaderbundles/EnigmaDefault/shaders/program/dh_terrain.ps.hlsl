@@ -0,0 +1,47 @@
+/**
+ * @file dh_terrain.ps.hlsl
+ * @brief Distant terrain LOD regions - Pixel Shader - G-Buffer Output
+ * @date 2026-10-16
+ *
+ * Same G-Buffer layout as gbuffers_terrain, so deferred lighting and fog treat LOD regions like
+ * full-detail terrain. LOD columns are the open surface: no block light, full sky light, no AO.
+ *
+ * G-Buffer Output Layout:
+ * - colortex0 (SV_TARGET0): Albedo RGB + AO in alpha
+ * - colortex1 (SV_TARGET1): Lightmap (R=blocklight, G=skylight)
+ * - colortex2 (SV_TARGET2): Normal (SNORM, [-1,1] stored directly)
+ */
+
+#include "../@engine/core/core.hlsl"
+
+// [RENDERTARGETS] 0,1,2
+// Output: colortex0 (Albedo), colortex1 (Lightmap), colortex2 (Normal)
+
+/**
+ * @brief Pixel shader input - matches VSOutput_DistantTerrain
+ */
+struct PSInput_DistantTerrain
+{
+    float4 Position : SV_POSITION;
+    float4 Color : COLOR0;
+    float3 Normal : NORMAL;
+    float3 WorldPos : TEXCOORD2;
+};
+
+struct PSOutput_DistantTerrain
+{
+    float4 Color0 : SV_TARGET0; // colortex0: Albedo (RGB) + AO (A)
+    float4 Color1 : SV_TARGET1; // colortex1: Lightmap (R=block, G=sky)
+    float4 Color2 : SV_TARGET2; // colortex2: Normal (SNORM, direct [-1,1])
+};
+
+PSOutput_DistantTerrain main(PSInput_DistantTerrain input)
+{
+    PSOutput_DistantTerrain output;
+
+    output.Color0 = float4(input.Color.rgb, 1.0);
+    output.Color1 = float4(0.0, 1.0, 0.0, 1.0);
+    output.Color2 = float4(normalize(input.Normal), 1.0);
+
+    return output;
+}
@@ -0,0 +1,58 @@
+/**
+ * @file dh_terrain.vs.hlsl
+ * @brief Distant terrain LOD regions - Vertex Shader
+ * @date 2026-10-16
+ *
+ * Column meshes built on the CPU by DistantTerrainLod (Vertex_PCU, no texture). Vertex color is
+ * the biome surface color, walls are pre-darkened. TexCoord.x holds the quad's face index
+ * (TerrainVertexFace), decoded with the packed terrain vertex normal table. Positions are
+ * region-local; modelMatrix moves them to the region origin.
+ *
+ * Transform Chain: Local -> World -> Camera -> Render -> Clip
+ */
+
+#include "../@engine/core/core.hlsl"
+#include "../lib/terrainVertex.hlsl"
+
+// [RENDERTARGETS] 0,1,2
+// Output: colortex0 (Albedo), colortex1 (Lightmap), colortex2 (Normal)
+
+/**
+ * @brief Vertex shader input - matches Vertex_PCU
+ */
+struct VSInput_DistantTerrain
+{
+    float3 Position : POSITION; // Region-local position
+    float4 Color : COLOR0; // Surface color (R8G8B8A8_UNORM unpacked)
+    float2 TexCoord : TEXCOORD0; // x = TerrainVertexFace, y unused
+};
+
+/**
+ * @brief Vertex shader output / pixel shader input
+ */
+struct VSOutput_DistantTerrain
+{
+    float4 Position : SV_POSITION; // Clip space position
+    float4 Color : COLOR0; // Surface color
+    float3 Normal : NORMAL; // World normal
+    float3 WorldPos : TEXCOORD2; // World position
+};
+
+VSOutput_DistantTerrain main(VSInput_DistantTerrain input)
+{
+    VSOutput_DistantTerrain output;
+
+    float4 localPos  = float4(input.Position, 1.0);
+    float4 worldPos  = mul(modelMatrix, localPos);
+    float4 viewPos   = mul(gbufferView, worldPos);
+    float4 renderPos = mul(gbufferRenderer, viewPos);
+    float4 clipPos   = mul(gbufferProjection, renderPos);
+
+    output.Position = clipPos;
+    output.Color    = input.Color;
+    float3 normal   = TERRAIN_FACE_NORMALS[min((uint)input.TexCoord.x, 9u)];
+    output.Normal   = normalize(mul((float3x3)modelMatrix, normal));
+    output.WorldPos = worldPos.xyz;
+
+    return output;
+}
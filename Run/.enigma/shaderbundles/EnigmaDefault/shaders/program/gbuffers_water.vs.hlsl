@@ -3,7 +3,7 @@
  * @brief Water Vertex Shader - TerrainVertex Layout (54 bytes)
  * @date 2026-01-17
  *
- * Input Layout (matches TerrainVertex):
+ * Input Layout (matches TerrainVertex, decoded by lib/terrainVertex.hlsl):
  * - POSITION (float3, offset 0)
  * - COLOR (R8G8B8A8_UNORM -> float4, offset 12)
  * - TEXCOORD0 (float2, offset 16) - UV coordinates
@@ -20,6 +20,7 @@
  */
 
 #include "../@engine/core/core.hlsl"
+#include "../lib/terrainVertex.hlsl"
 
 // [RENDERTARGETS] 0,1,2,4
 // Output: colortex0 (Color), colortex1 (Lightmap), colortex2 (Normal), colortex4 (Material)
@@ -31,20 +32,6 @@
 // - Normal is already transformed to world space
 // - entityId and midTexCoord passed through unchanged
 
-/**
- * @brief Vertex shader input - matches TerrainVertex (54 bytes)
- */
-struct VSInput_Water
-{
-    float3 Position : POSITION; // Vertex position (local space)
-    float4 Color : COLOR0; // Vertex color (R8G8B8A8_UNORM unpacked)
-    float2 TexCoord : TEXCOORD0; // UV coordinates
-    float3 Normal : NORMAL; // Normal vector
-    float2 LightmapCoord: LIGHTMAP; // Lightmap (x=blocklight, y=skylight)
-    uint   entityId : TEXCOORD2; // Block entity ID (mc_Entity)
-    float2 midTexCoord : TEXCOORD3; // Texture center (mc_midTexCoord)
-};
-
 /**
  * @brief Vertex shader output / pixel shader input
  */
@@ -65,12 +52,13 @@ struct VSOutput_Water
  * @param input TerrainVertex data from VBO
  * @return Transformed vertex with G-Buffer data
  */
-VSOutput_Water main(VSInput_Water input)
+VSOutput_Water main(VSInput_TerrainVertex input)
 {
     VSOutput_Water output;
+    TerrainVertexData vertex = DecodeTerrainVertex(input);
 
     // [STEP 1] Transform position: Model -> World -> View -> Clip
-    float4 localPos  = float4(input.Position, 1.0);
+    float4 localPos  = float4(vertex.Position, 1.0);
     float4 worldPos  = mul(modelMatrix, localPos);
     float4 viewPos   = mul(gbufferView, worldPos);
     float4 renderPos = mul(gbufferRenderer, viewPos);
@@ -80,14 +68,14 @@ VSOutput_Water main(VSInput_Water input)
     output.WorldPos = worldPos.xyz;
 
     // [STEP 2] Transform normal to world space
-    output.Normal = normalize(mul((float3x3)modelMatrix, input.Normal));
+    output.Normal = normalize(mul((float3x3)modelMatrix, vertex.Normal));
 
     // [STEP 3] Pass through vertex attributes
-    output.Color         = input.Color;
-    output.TexCoord      = input.TexCoord;
-    output.LightmapCoord = input.LightmapCoord;
-    output.entityId      = input.entityId;
-    output.midTexCoord   = input.midTexCoord;
+    output.Color         = vertex.Color;
+    output.TexCoord      = vertex.TexCoord;
+    output.LightmapCoord = vertex.LightmapCoord;
+    output.entityId      = vertex.entityId;
+    output.midTexCoord   = vertex.midTexCoord;
 
     return output;
 }
@@ -7,15 +7,14 @@
  * Transforms vertices from world space to light space using
  * shadowView and shadowProjection matrices.
  *
- * Input Layout (matches TerrainVertex):
- * - POSITION (float3) - Vertex position
- * - TEXCOORD0 (float2) - UV for alpha testing
+ * Input Layout: TerrainVertex (lib/terrainVertex.hlsl). Only position and UV are used.
  *
  * Output: Light space position + UV + WorldPos for shadow.ps.hlsl
  */
 
 #include "../@engine/core/core.hlsl"
 #include "../lib/shadow.hlsl"
+#include "../lib/terrainVertex.hlsl"
 
 // [RENDERTARGETS] 0,1
 
@@ -23,18 +22,6 @@
 // Shadow Pass Vertex Structures
 // ============================================================================
 
-/**
- * @brief Shadow vertex shader input - minimal for depth-only pass
- */
-struct VSInput_Shadow
-{
-    float3 Position : POSITION;
-    float4 Color : COLOR0; // Unused but required for vertex layout
-    float2 TexCoord : TEXCOORD0; // For alpha testing
-    float3 Normal : NORMAL; // Unused but required for vertex layout
-    float2 Lightmap : LIGHTMAP; // Unused but required for vertex layout
-};
-
 /**
  * @brief Shadow vertex shader output
  */
@@ -53,12 +40,13 @@ struct VSOutput_Shadow
  * Transform chain: Model -> World -> ShadowView -> ShadowClip
  * Uses shadowView and shadowProjection from Matrices cbuffer (b7)
  */
-VSOutput_Shadow main(VSInput_Shadow input)
+VSOutput_Shadow main(VSInput_TerrainVertex input)
 {
     VSOutput_Shadow output;
+    TerrainVertexData vertex = DecodeTerrainVertex(input);
 
     // [STEP 1] Transform to world space
-    float4 localPos = float4(input.Position, 1.0);
+    float4 localPos = float4(vertex.Position, 1.0);
     float4 worldPos = mul(modelMatrix, localPos);
 
     // [STEP 2] Transform to shadow clip space
@@ -72,7 +60,7 @@ VSOutput_Shadow main(VSInput_Shadow input)
     shadowClipPos.xyz = GetShadowDistortion(shadowClipPos.xyz);
 
     output.Position = shadowClipPos;
-    output.TexCoord = input.TexCoord;
+    output.TexCoord = vertex.TexCoord;
     output.WorldPos = worldPos.xyz;
 
     return output;